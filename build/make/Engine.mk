@@ -31,6 +31,7 @@ OBJS       = Core/AABB.o \
              Core/AttributeFactory.o \
              Core/AttributeSet.o \
              Core/AttributeSettings.o \
+             Core/BlockMath.o \
              Core/ByteArray.o \
              Core/Color.o \
              Core/Counter.o \
@@ -52,6 +53,7 @@ OBJS       = Core/AABB.o \
              Core/ThreadHandler.o \
              Core/Time.o \
              Core/Version.o \
+             Core/WorkerPool.o \
              Devices/ABM/AbmDevices.o \
              Devices/Audio/AudioDevices.o \
              Devices/Audio/AudioNodes.o \
@@ -84,6 +86,8 @@ OBJS       = Core/AABB.o \
              DSP/ChannelFileWriter.o \
              DSP/ChannelProcessor.o \
              DSP/ChannelReader.o \
+             DSP/ChannelSnapshot.o \
+             DSP/ChannelTimeIndex.o \
              DSP/ClockGenerator.o \
              DSP/Epoch.o \
              DSP/FFT_FFTW.o \
@@ -93,13 +97,21 @@ OBJS       = Core/AABB.o \
              DSP/FilterGenerator.o \
              DSP/FrequencyBand.o \
              DSP/Histogram.o \
+             DSP/HrvFrequencyDomain.o \
              DSP/HrvProcessor.o \
              DSP/HrvTimeDomain.o \
              DSP/LinearFilterProcessor.o \
+             DSP/LombScargle.o \
+             DSP/MinMaxPyramid.o \
              DSP/MultiChannel.o \
+             DSP/MultiChannelBlock.o \
              DSP/MultiChannelReader.o \
+             DSP/PolyphaseResampler.o \
              DSP/ResampleProcessor.o \
+             DSP/SignalGenerator.o \
+             DSP/SpatialFilter.o \
              DSP/Spectrum.o \
+             DSP/SpectrumAnalyzerService.o \
              DSP/SpectrumAnalyzerSettings.o \
              DSP/StatisticsProcessor.o \
              DSP/WindowFunction.o \
@@ -203,8 +215,11 @@ OBJS       = Core/AABB.o \
              Graph/SunControlNode.o \
              Graph/CloudsControlNode.o \
              Graph/FogControlNode.o \
+             Graph/GraphTemplateCache.o \
              Graph/RainControlNode.o \
+             Graph/SpatialFilterNode.o \
              Graph/VignetteControlNode.o \
+             Networking/OscBundleQueue.o \
              Networking/OscFeedbackPacket.o \
              Networking/OscMessageParser.o \
              Networking/OscMessageQueue.o \
@@ -221,6 +236,7 @@ OBJS       = Core/AABB.o \
              DeviceManager.o \
              EEGElectrodes.o \
              EngineManager.o \
+             EngineThreadHandler.o \
              Experience.o \
              License.o \
              Sensor.o \
@@ -182,6 +182,7 @@ OBJS       = AttributeWidgets/AttributeSetGridWidget.o \
              Networking/NetworkMessageEvent.o \
              Networking/NetworkServer.o \
              Networking/NetworkServerClient.o \
+             Networking/OscBundleSender.o \
              Networking/OscServer.o \
              Networking/WebsocketServer.o \
              PluginSystem/Plugin.o \
@@ -290,6 +290,7 @@ OBJS       = Devices/ABM/AbmDriver.o \
              Plugins/Graph/GraphRenderer.o \
              Plugins/Graph/GraphRendererState.o \
              Plugins/Graph/GraphShared.o \
+             Plugins/Graph/GraphSpatialIndex.o \
              Plugins/Graph/GraphTextPixmapCache.o \
              Plugins/Graph/GraphWidget.o \
              Plugins/Graph/StateMachinePlugin.o \
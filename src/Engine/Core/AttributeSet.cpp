@@ -168,13 +168,16 @@ bool AttributeSet::HasAttribute(Attribute* attribute) const
 }
 
 
-// find an attribute by its name
-uint32 AttributeSet::FindAttributeIndexByInternalName(const char* name) const
+// find an attribute by its internal name
+uint32 AttributeSet::FindAttributeIndexByInternalName(const NameKey& key) const
 {
 	const uint32 numAttributes = mAttributes.Size();
 	for (uint32 i=0; i<numAttributes; ++i)
-		if (mAttributes[i].mSettings->GetInternalNameString() == name)
+	{
+		const AttributeSettings* settings = mAttributes[i].mSettings;
+		if (settings->GetInternalNameHash() == key.mHash && settings->GetInternalNameString() == key.mName)
 			return i;
+	}
 
 	return CORE_INVALIDINDEX32;
 }
@@ -183,24 +186,28 @@ uint32 AttributeSet::FindAttributeIndexByInternalName(const char* name) const
 // find an attribute by its name
 uint32 AttributeSet::FindAttributeIndexByName(const char* name) const
 {
+	const uint32 hash = String::CalcHash(name);
+
 	const uint32 numAttributes = mAttributes.Size();
 	for (uint32 i=0; i<numAttributes; ++i)
-		if (mAttributes[i].mSettings->GetNameString() == name)
+	{
+		const AttributeSettings* settings = mAttributes[i].mSettings;
+		if (settings->GetNameHash() == hash && settings->GetNameString() == name)
 			return i;
+	}
 
 	return CORE_INVALIDINDEX32;
 }
 
 
 // find the attribute settings based on the internal name
-AttributeSettings* AttributeSet::FindAttributeSettingsByInternalName(const char* internalName) const
+AttributeSettings* AttributeSet::FindAttributeSettingsByInternalName(const NameKey& key) const
 {
-	const uint32 numAttributes = mAttributes.Size();
-	for (uint32 i=0; i<numAttributes; ++i)
-		if (mAttributes[i].mSettings->GetInternalNameString().IsEqual(internalName) == true)
-			return mAttributes[i].mSettings;
+	const uint32 index = FindAttributeIndexByInternalName(key);
+	if (index == CORE_INVALIDINDEX32)
+		return NULL;
 
-	return NULL;
+	return mAttributes[index].mSettings;
 }
 
 
@@ -45,6 +45,15 @@ class Stream;
 class ENGINE_API AttributeSet
 {
 	public:
+		// attribute name with precalculated hash, to look up the same name in many attribute sets without hashing it again
+		struct NameKey
+		{
+			explicit NameKey(const char* name) : mName(name), mHash(String::CalcHash(name))	{}
+			NameKey(const char* name, uint32 hash) : mName(name), mHash(hash)					{}
+			const char*	mName;
+			uint32		mHash;
+		};
+
 		AttributeSet()																{}
 		virtual ~AttributeSet()														{ RemoveAllAttributes(); }
 
@@ -60,14 +69,17 @@ class ENGINE_API AttributeSet
 		void RemoveAllAttributes(bool delFromMem=true);
 		void Resize(uint32 numAttributes)											{ mAttributes.Resize( numAttributes ); }
 
-		uint32 FindAttributeIndexByInternalName(const char* name) const;
+		// name lookups only compare the strings of attributes with a matching name hash (see AttributeSettings::GetInternalNameHash())
+		uint32 FindAttributeIndexByInternalName(const char* name) const				{ return FindAttributeIndexByInternalName(NameKey(name)); }
+		uint32 FindAttributeIndexByInternalName(const NameKey& key) const;
 		uint32 FindAttributeIndexByName(const char* name) const;
 
 		bool HasAttribute(Attribute* attribute) const;
 		bool HasAttributeWithInternalName(const char* name) const					{ return (FindAttributeIndexByInternalName(name) != CORE_INVALIDINDEX32); }
 		bool HasAttributeWithName(const char* name) const							{ return (FindAttributeIndexByName(name) != CORE_INVALIDINDEX32); }
 
-		AttributeSettings* FindAttributeSettingsByInternalName(const char* internalName) const;
+		AttributeSettings* FindAttributeSettingsByInternalName(const char* internalName) const	{ return FindAttributeSettingsByInternalName(NameKey(internalName)); }
+		AttributeSettings* FindAttributeSettingsByInternalName(const NameKey& key) const;
 
 		// register attribute
 		AttributeSettings* RegisterAttribute(const char* name, const char* internalName, const char* description, uint32 interfaceType);
@@ -42,6 +42,8 @@ AttributeSettings::AttributeSettings()
 	mDefaultValue	= NULL;
 	mIsEnabled		= true;
 	mIsVisible		= true;
+	mNameHash		= String::CalcHash(NULL);
+	mInternalNameHash	= mNameHash;
 }
 
 
@@ -53,6 +55,8 @@ AttributeSettings::AttributeSettings(const char* internalName)
 	mDefaultValue	= NULL;
 	mInternalName	= internalName;
 	mName			= mInternalName;
+	mInternalNameHash	= mInternalName.CalcHash();
+	mNameHash		= mInternalNameHash;
 }
 
 
@@ -64,8 +68,8 @@ AttributeSettings::~AttributeSettings()
 }
 
 
-void AttributeSettings::SetInternalName(const char* internalName)					{ mInternalName = internalName; }
-void AttributeSettings::SetName(const char* name)									{ mName = name; }
+void AttributeSettings::SetInternalName(const char* internalName)					{ mInternalName = internalName; mInternalNameHash = mInternalName.CalcHash(); }
+void AttributeSettings::SetName(const char* name)									{ mName = name; mNameHash = mName.CalcHash(); }
 const char* AttributeSettings::GetInternalName() const								{ return mInternalName.AsChar(); }
 const char* AttributeSettings::GetName() const										{ return mName.AsChar(); }
 const char* AttributeSettings::GetComboValue(uint32 index) const					{ return mComboValues[index].AsChar(); }
@@ -87,6 +91,8 @@ AttributeSettings& AttributeSettings::operator=(const AttributeSettings& other)
 	// copy the rest			
 	mName			= other.mName;
 	mInternalName	= other.mInternalName;
+	mNameHash		= other.mNameHash;
+	mInternalNameHash	= other.mInternalNameHash;
 	mDescription	= other.mDescription;
 	mInterfaceType	= other.mInterfaceType;
 	mComboValues	= other.mComboValues;
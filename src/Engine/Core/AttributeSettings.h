@@ -78,6 +78,8 @@ class ENGINE_API AttributeSettings
 		uint32 GetInterfaceType() const									{ return mInterfaceType; }
 		const String& GetInternalNameString() const;
 		const String& GetNameString() const;
+		uint32 GetInternalNameHash() const								{ return mInternalNameHash; }
+		uint32 GetNameHash() const										{ return mNameHash; }
 		const String& GetDescriptionString() const						{ return mDescription; }
 
 		// enabled state
@@ -120,6 +122,8 @@ class ENGINE_API AttributeSettings
 		String			mDescription;	
 		Core::String	mName;			
 		Core::String	mInternalName;	
+		uint32			mNameHash;		// hashes of the names (kept in sync by the setters, used by the attribute set lookups)
+		uint32			mInternalNameHash;
 		uint32			mInterfaceType;	
 		bool			mIsEnabled;
 		bool			mIsVisible;
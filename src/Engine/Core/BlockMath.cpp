@@ -0,0 +1,691 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "BlockMath.h"
+
+#if defined(NEUROMORE_CPU_X86ORX64)
+	#include <immintrin.h>
+	#if CORE_COMPILER == CORE_COMPILER_MSVC
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#elif defined(NEUROMORE_CPU_ARM64)
+	#include <arm_neon.h>
+#endif
+
+
+// which kernels are compiled in
+#if defined(NEUROMORE_CPU_X86ORX64)
+	#define BLOCKMATH_HAS_SSE2
+	#define BLOCKMATH_HAS_AVX2
+	#if CORE_COMPILER != CORE_COMPILER_MSVC || _MSC_VER >= 1911
+		#define BLOCKMATH_HAS_AVX512
+	#endif
+#elif defined(NEUROMORE_CPU_ARM64)
+	#define BLOCKMATH_HAS_NEON
+#endif
+
+// gcc and clang need the instruction set enabled per function, msvc allows using all intrinsics anywhere
+#if CORE_COMPILER == CORE_COMPILER_GCC
+	#define BLOCKMATH_TARGET_SSE2	__attribute__((target("sse2")))
+	#define BLOCKMATH_TARGET_AVX2	__attribute__((target("avx2")))
+	#define BLOCKMATH_TARGET_AVX512	__attribute__((target("avx512f")))
+#else
+	#define BLOCKMATH_TARGET_SSE2
+	#define BLOCKMATH_TARGET_AVX2
+	#define BLOCKMATH_TARGET_AVX512
+#endif
+
+
+namespace Core
+{
+
+// constants for the polynomial sine: the argument is reduced to [-pi/2, pi/2] by subtracting multiples of pi (split into three parts, so the
+// products with the multiple stay exact), the sine of the remainder is its Taylor series up to x^21 (truncation error below 1e-18).
+// The cosine is the sine shifted by half a multiple of pi; the shift is applied to the multiple, not to the argument, so it does not lose precision.
+namespace BlockMathSin
+{
+	static const double invPi		= 0.318309886183790671538;
+	static const double pi1			= 3.14159250259399414062;
+	static const double pi2			= 1.50995788317231927067e-7;
+	static const double pi3			= 1.07806057163162381058e-14;
+	static const double roundMagic	= 6755399441055744.0;		// 1.5 * 2^52: adding and subtracting it rounds to the nearest integer
+	static const double c3			= -1.0 / 6.0;
+	static const double c5			= 1.0 / 120.0;
+	static const double c7			= -1.0 / 5040.0;
+	static const double c9			= 1.0 / 362880.0;
+	static const double c11			= -1.0 / 39916800.0;
+	static const double c13			= 1.0 / 6227020800.0;
+	static const double c15			= -1.0 / 1307674368000.0;
+	static const double c17			= 1.0 / 355687428096000.0;
+	static const double c19			= -1.0 / 121645100408832000.0;
+	static const double c21			= 1.0 / 51090942171709440000.0;
+}
+
+
+//
+// scalar kernels (reference implementation)
+//
+
+namespace BlockMathScalar
+{
+	static void Add(const double* a, const double* b, double* out, uint32 numValues)		{ for (uint32 i=0; i<numValues; ++i) out[i] = a[i] + b[i]; }
+	static void Subtract(const double* a, const double* b, double* out, uint32 numValues)	{ for (uint32 i=0; i<numValues; ++i) out[i] = a[i] - b[i]; }
+	static void Multiply(const double* a, const double* b, double* out, uint32 numValues)	{ for (uint32 i=0; i<numValues; ++i) out[i] = a[i] * b[i]; }
+	static void Offset(const double* in, double offset, double* out, uint32 numValues)		{ for (uint32 i=0; i<numValues; ++i) out[i] = in[i] + offset; }
+	static void Scale(const double* in, double factor, double* out, uint32 numValues)		{ for (uint32 i=0; i<numValues; ++i) out[i] = in[i] * factor; }
+	static void AddScaled(const double* in, double factor, double* out, uint32 numValues)	{ for (uint32 i=0; i<numValues; ++i) out[i] += in[i] * factor; }
+	static void Abs(const double* in, double* out, uint32 numValues)						{ for (uint32 i=0; i<numValues; ++i) out[i] = fabs(in[i]); }
+	static void Square(const double* in, double* out, uint32 numValues)					{ for (uint32 i=0; i<numValues; ++i) out[i] = in[i] * in[i]; }
+	static void Sqrt(const double* in, double* out, uint32 numValues)						{ for (uint32 i=0; i<numValues; ++i) out[i] = sqrt(in[i]); }
+
+	static double Sum(const double* values, uint32 numValues)
+	{
+		double sum = 0.0;
+		for (uint32 i=0; i<numValues; ++i)
+			sum += values[i];
+		return sum;
+	}
+
+	static double Dot(const double* a, const double* b, uint32 numValues)
+	{
+		double sum = 0.0;
+		for (uint32 i=0; i<numValues; ++i)
+			sum += a[i] * b[i];
+		return sum;
+	}
+
+	static double SumOfSquares(const double* values, uint32 numValues)
+	{
+		return Dot(values, values, numValues);
+	}
+
+	// sin(x + shift * pi)
+	static inline double SinPoly(double x, double shift)
+	{
+		using namespace BlockMathSin;
+
+		// x + shift * pi = k * pi + r, sin(x + shift * pi) = (-1)^k * sin(r)
+		const double k = (x * invPi + shift + roundMagic) - roundMagic;
+		const double m = k - shift;
+		const double r = ((x - m * pi1) - m * pi2) - m * pi3;
+		const double halfK = (k * 0.5 + roundMagic) - roundMagic;
+		const double sign = 1.0 - 2.0 * fabs(k - 2.0 * halfK);
+
+		const double r2 = r * r;
+		double p = c21;
+		p = p * r2 + c19;
+		p = p * r2 + c17;
+		p = p * r2 + c15;
+		p = p * r2 + c13;
+		p = p * r2 + c11;
+		p = p * r2 + c9;
+		p = p * r2 + c7;
+		p = p * r2 + c5;
+		p = p * r2 + c3;
+
+		return sign * (r + r * r2 * p);
+	}
+
+	static void FastSin(const double* in, double* out, uint32 numValues)					{ for (uint32 i=0; i<numValues; ++i) out[i] = SinPoly(in[i], 0.0); }
+	static void FastCos(const double* in, double* out, uint32 numValues)					{ for (uint32 i=0; i<numValues; ++i) out[i] = SinPoly(in[i], 0.5); }
+
+	static void MinMax(const double* values, uint32 numValues, double* outMin, double* outMax)
+	{
+		double minValue = DBL_MAX;
+		double maxValue = -DBL_MAX;
+		for (uint32 i=0; i<numValues; ++i)
+		{
+			minValue = (values[i] < minValue) ? values[i] : minValue;
+			maxValue = (values[i] > maxValue) ? values[i] : maxValue;
+		}
+
+		*outMin = minValue;
+		*outMax = maxValue;
+	}
+}
+
+
+//
+// SSE2 kernels
+//
+
+#ifdef BLOCKMATH_HAS_SSE2
+namespace BlockMathSSE2
+{
+	typedef __m128d Vector;
+	static const uint32 width = 2;
+
+	BLOCKMATH_TARGET_SSE2 static inline Vector VZero()								{ return _mm_setzero_pd(); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VSet1(double x)						{ return _mm_set1_pd(x); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VLoad(const double* p)				{ return _mm_loadu_pd(p); }
+	BLOCKMATH_TARGET_SSE2 static inline void VStore(double* p, Vector v)			{ _mm_storeu_pd(p, v); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VAdd(Vector a, Vector b)				{ return _mm_add_pd(a, b); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VSub(Vector a, Vector b)				{ return _mm_sub_pd(a, b); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VMul(Vector a, Vector b)				{ return _mm_mul_pd(a, b); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VMin(Vector a, Vector b)				{ return _mm_min_pd(a, b); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VMax(Vector a, Vector b)				{ return _mm_max_pd(a, b); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VSqrt(Vector v)						{ return _mm_sqrt_pd(v); }
+	BLOCKMATH_TARGET_SSE2 static inline Vector VAbs(Vector v)						{ return _mm_andnot_pd(_mm_set1_pd(-0.0), v); }
+	BLOCKMATH_TARGET_SSE2 static inline double VReduceAdd(Vector v)					{ return _mm_cvtsd_f64( _mm_add_sd(v, _mm_unpackhi_pd(v, v)) ); }
+	BLOCKMATH_TARGET_SSE2 static inline double VReduceMin(Vector v)					{ return _mm_cvtsd_f64( _mm_min_sd(v, _mm_unpackhi_pd(v, v)) ); }
+	BLOCKMATH_TARGET_SSE2 static inline double VReduceMax(Vector v)					{ return _mm_cvtsd_f64( _mm_max_sd(v, _mm_unpackhi_pd(v, v)) ); }
+
+	#define BLOCKMATH_TARGET BLOCKMATH_TARGET_SSE2
+	#include "BlockMathKernels.inl"
+	#undef BLOCKMATH_TARGET
+}
+#endif
+
+
+//
+// AVX2 kernels
+//
+
+#ifdef BLOCKMATH_HAS_AVX2
+namespace BlockMathAVX2
+{
+	typedef __m256d Vector;
+	static const uint32 width = 4;
+
+	BLOCKMATH_TARGET_AVX2 static inline Vector VZero()								{ return _mm256_setzero_pd(); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VSet1(double x)						{ return _mm256_set1_pd(x); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VLoad(const double* p)				{ return _mm256_loadu_pd(p); }
+	BLOCKMATH_TARGET_AVX2 static inline void VStore(double* p, Vector v)			{ _mm256_storeu_pd(p, v); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VAdd(Vector a, Vector b)				{ return _mm256_add_pd(a, b); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VSub(Vector a, Vector b)				{ return _mm256_sub_pd(a, b); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VMul(Vector a, Vector b)				{ return _mm256_mul_pd(a, b); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VMin(Vector a, Vector b)				{ return _mm256_min_pd(a, b); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VMax(Vector a, Vector b)				{ return _mm256_max_pd(a, b); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VSqrt(Vector v)						{ return _mm256_sqrt_pd(v); }
+	BLOCKMATH_TARGET_AVX2 static inline Vector VAbs(Vector v)						{ return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v); }
+
+	// reduce to the 128 bit halves first
+	BLOCKMATH_TARGET_AVX2 static inline double VReduceAdd(Vector v)
+	{
+		const __m128d half = _mm_add_pd( _mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1) );
+		return _mm_cvtsd_f64( _mm_add_sd(half, _mm_unpackhi_pd(half, half)) );
+	}
+
+	BLOCKMATH_TARGET_AVX2 static inline double VReduceMin(Vector v)
+	{
+		const __m128d half = _mm_min_pd( _mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1) );
+		return _mm_cvtsd_f64( _mm_min_sd(half, _mm_unpackhi_pd(half, half)) );
+	}
+
+	BLOCKMATH_TARGET_AVX2 static inline double VReduceMax(Vector v)
+	{
+		const __m128d half = _mm_max_pd( _mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1) );
+		return _mm_cvtsd_f64( _mm_max_sd(half, _mm_unpackhi_pd(half, half)) );
+	}
+
+	#define BLOCKMATH_TARGET BLOCKMATH_TARGET_AVX2
+	#include "BlockMathKernels.inl"
+	#undef BLOCKMATH_TARGET
+}
+#endif
+
+
+//
+// AVX-512 kernels
+//
+
+#ifdef BLOCKMATH_HAS_AVX512
+namespace BlockMathAVX512
+{
+	typedef __m512d Vector;
+	static const uint32 width = 8;
+
+	BLOCKMATH_TARGET_AVX512 static inline Vector VZero()							{ return _mm512_setzero_pd(); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VSet1(double x)					{ return _mm512_set1_pd(x); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VLoad(const double* p)				{ return _mm512_loadu_pd(p); }
+	BLOCKMATH_TARGET_AVX512 static inline void VStore(double* p, Vector v)			{ _mm512_storeu_pd(p, v); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VAdd(Vector a, Vector b)			{ return _mm512_add_pd(a, b); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VSub(Vector a, Vector b)			{ return _mm512_sub_pd(a, b); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VMul(Vector a, Vector b)			{ return _mm512_mul_pd(a, b); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VMin(Vector a, Vector b)			{ return _mm512_min_pd(a, b); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VMax(Vector a, Vector b)			{ return _mm512_max_pd(a, b); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VSqrt(Vector v)					{ return _mm512_sqrt_pd(v); }
+	BLOCKMATH_TARGET_AVX512 static inline Vector VAbs(Vector v)						{ return _mm512_abs_pd(v); }
+	BLOCKMATH_TARGET_AVX512 static inline double VReduceAdd(Vector v)				{ return _mm512_reduce_add_pd(v); }
+	BLOCKMATH_TARGET_AVX512 static inline double VReduceMin(Vector v)				{ return _mm512_reduce_min_pd(v); }
+	BLOCKMATH_TARGET_AVX512 static inline double VReduceMax(Vector v)				{ return _mm512_reduce_max_pd(v); }
+
+	#define BLOCKMATH_TARGET BLOCKMATH_TARGET_AVX512
+	#include "BlockMathKernels.inl"
+	#undef BLOCKMATH_TARGET
+}
+#endif
+
+
+//
+// NEON kernels
+//
+
+#ifdef BLOCKMATH_HAS_NEON
+namespace BlockMathNEON
+{
+	typedef float64x2_t Vector;
+	static const uint32 width = 2;
+
+	static inline Vector VZero()													{ return vdupq_n_f64(0.0); }
+	static inline Vector VSet1(double x)											{ return vdupq_n_f64(x); }
+	static inline Vector VLoad(const double* p)										{ return vld1q_f64(p); }
+	static inline void VStore(double* p, Vector v)									{ vst1q_f64(p, v); }
+	static inline Vector VAdd(Vector a, Vector b)									{ return vaddq_f64(a, b); }
+	static inline Vector VSub(Vector a, Vector b)									{ return vsubq_f64(a, b); }
+	static inline Vector VMul(Vector a, Vector b)									{ return vmulq_f64(a, b); }
+	static inline Vector VMin(Vector a, Vector b)									{ return vminq_f64(a, b); }
+	static inline Vector VMax(Vector a, Vector b)									{ return vmaxq_f64(a, b); }
+	static inline Vector VSqrt(Vector v)											{ return vsqrtq_f64(v); }
+	static inline Vector VAbs(Vector v)												{ return vabsq_f64(v); }
+	static inline double VReduceAdd(Vector v)										{ return vaddvq_f64(v); }
+	static inline double VReduceMin(Vector v)										{ return vminvq_f64(v); }
+	static inline double VReduceMax(Vector v)										{ return vmaxvq_f64(v); }
+
+	#define BLOCKMATH_TARGET
+	#include "BlockMathKernels.inl"
+	#undef BLOCKMATH_TARGET
+}
+#endif
+
+
+//
+// kernel dispatch
+//
+
+struct BlockMathKernels
+{
+	BlockMath::EInstructionSet	mInstructionSet;
+
+	void	(*mAdd)(const double* a, const double* b, double* out, uint32 numValues);
+	void	(*mSubtract)(const double* a, const double* b, double* out, uint32 numValues);
+	void	(*mMultiply)(const double* a, const double* b, double* out, uint32 numValues);
+	void	(*mOffset)(const double* in, double offset, double* out, uint32 numValues);
+	void	(*mScale)(const double* in, double factor, double* out, uint32 numValues);
+	void	(*mAddScaled)(const double* in, double factor, double* out, uint32 numValues);
+	void	(*mAbs)(const double* in, double* out, uint32 numValues);
+	void	(*mSquare)(const double* in, double* out, uint32 numValues);
+	void	(*mSqrt)(const double* in, double* out, uint32 numValues);
+	void	(*mFastSin)(const double* in, double* out, uint32 numValues);
+	void	(*mFastCos)(const double* in, double* out, uint32 numValues);
+	double	(*mSum)(const double* values, uint32 numValues);
+	double	(*mSumOfSquares)(const double* values, uint32 numValues);
+	double	(*mDot)(const double* a, const double* b, uint32 numValues);
+	void	(*mMinMax)(const double* values, uint32 numValues, double* outMin, double* outMax);
+};
+
+#define BLOCKMATH_KERNELS(INSTRUCTIONSET, NAMESPACE)	{ INSTRUCTIONSET, NAMESPACE::Add, NAMESPACE::Subtract, NAMESPACE::Multiply, NAMESPACE::Offset, NAMESPACE::Scale, NAMESPACE::AddScaled, NAMESPACE::Abs, NAMESPACE::Square, NAMESPACE::Sqrt, NAMESPACE::FastSin, NAMESPACE::FastCos, NAMESPACE::Sum, NAMESPACE::SumOfSquares, NAMESPACE::Dot, NAMESPACE::MinMax }
+
+static const BlockMathKernels gBlockMathKernels[] =
+{
+	BLOCKMATH_KERNELS( BlockMath::INSTRUCTIONSET_SCALAR, BlockMathScalar ),
+#ifdef BLOCKMATH_HAS_SSE2
+	BLOCKMATH_KERNELS( BlockMath::INSTRUCTIONSET_SSE2, BlockMathSSE2 ),
+#endif
+#ifdef BLOCKMATH_HAS_AVX2
+	BLOCKMATH_KERNELS( BlockMath::INSTRUCTIONSET_AVX2, BlockMathAVX2 ),
+#endif
+#ifdef BLOCKMATH_HAS_AVX512
+	BLOCKMATH_KERNELS( BlockMath::INSTRUCTIONSET_AVX512, BlockMathAVX512 ),
+#endif
+#ifdef BLOCKMATH_HAS_NEON
+	BLOCKMATH_KERNELS( BlockMath::INSTRUCTIONSET_NEON, BlockMathNEON ),
+#endif
+};
+
+#undef BLOCKMATH_KERNELS
+
+
+// find the compiled in kernels for the given instruction set
+static const BlockMathKernels* FindBlockMathKernels(BlockMath::EInstructionSet instructionSet)
+{
+	const uint32 numKernels = sizeof(gBlockMathKernels) / sizeof(BlockMathKernels);
+	for (uint32 i=0; i<numKernels; ++i)
+	{
+		if (gBlockMathKernels[i].mInstructionSet == instructionSet)
+			return &gBlockMathKernels[i];
+	}
+
+	return NULL;
+}
+
+
+// the active kernels, selected on first use
+static const BlockMathKernels*& GetBlockMathKernels()
+{
+	static const BlockMathKernels* kernels = FindBlockMathKernels( BlockMath::DetectInstructionSet() );
+	return kernels;
+}
+
+
+#if defined(NEUROMORE_CPU_X86ORX64)
+
+// cpuid registers eax, ebx, ecx, edx
+static void CpuId(uint32 leaf, uint32 subLeaf, uint32* registers)
+{
+#if CORE_COMPILER == CORE_COMPILER_MSVC
+	int values[4];
+	__cpuidex(values, leaf, subLeaf);
+	for (uint32 i=0; i<4; ++i)
+		registers[i] = values[i];
+#else
+	__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+
+// the register states the operating system saves on context switches
+static uint64 GetEnabledRegisterStates()
+{
+#if CORE_COMPILER == CORE_COMPILER_MSVC
+	return _xgetbv(0);
+#else
+	uint32 eax, edx;
+	__asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((uint64)edx << 32) | eax;
+#endif
+}
+
+#endif
+
+
+// the best instruction set supported by the CPU (and compiled in)
+BlockMath::EInstructionSet BlockMath::DetectInstructionSet()
+{
+#if defined(NEUROMORE_CPU_X86ORX64)
+	uint32 registers[4];
+	CpuId(0, 0, registers);
+	const uint32 maxLeaf = registers[0];
+
+	CpuId(1, 0, registers);
+	const bool hasSSE2		= (registers[3] & (1 << 26)) != 0;
+	const bool hasOSXSave	= (registers[2] & (1 << 27)) != 0;
+	const bool hasAVX		= (registers[2] & (1 << 28)) != 0;
+
+	if (hasSSE2 == false)
+		return INSTRUCTIONSET_SCALAR;
+
+	// the AVX registers must be enabled by the operating system
+	if (hasOSXSave == false || hasAVX == false || maxLeaf < 7)
+		return INSTRUCTIONSET_SSE2;
+
+	const uint64 registerStates = GetEnabledRegisterStates();
+	const bool hasYMMState = (registerStates & 0x06) == 0x06;	// SSE and AVX state
+	const bool hasZMMState = (registerStates & 0xE6) == 0xE6;	// additionally opmask and upper ZMM state
+
+	CpuId(7, 0, registers);
+	const bool hasAVX2		= (registers[1] & (1 << 5)) != 0;
+	const bool hasAVX512F	= (registers[1] & (1 << 16)) != 0;
+
+#ifdef BLOCKMATH_HAS_AVX512
+	if (hasAVX512F == true && hasZMMState == true)
+		return INSTRUCTIONSET_AVX512;
+#endif
+
+	if (hasAVX2 == true && hasYMMState == true)
+		return INSTRUCTIONSET_AVX2;
+
+	return INSTRUCTIONSET_SSE2;
+
+#elif defined(BLOCKMATH_HAS_NEON)
+	// NEON is mandatory on ARM64
+	return INSTRUCTIONSET_NEON;
+#else
+	return INSTRUCTIONSET_SCALAR;
+#endif
+}
+
+
+BlockMath::EInstructionSet BlockMath::GetInstructionSet()
+{
+	return GetBlockMathKernels()->mInstructionSet;
+}
+
+
+const char* BlockMath::GetInstructionSetName(EInstructionSet instructionSet)
+{
+	switch (instructionSet)
+	{
+		case INSTRUCTIONSET_SCALAR:	return "Scalar";
+		case INSTRUCTIONSET_SSE2:	return "SSE2";
+		case INSTRUCTIONSET_AVX2:	return "AVX2";
+		case INSTRUCTIONSET_AVX512:	return "AVX-512";
+		case INSTRUCTIONSET_NEON:	return "NEON";
+		default:					return "Unknown";
+	}
+}
+
+
+// force the given instruction set
+bool BlockMath::SetInstructionSet(EInstructionSet instructionSet)
+{
+	// do not allow instruction sets that are better than the detected one (the CPU may not support them)
+	if (instructionSet != INSTRUCTIONSET_SCALAR && instructionSet > DetectInstructionSet())
+		return false;
+
+	const BlockMathKernels* kernels = FindBlockMathKernels(instructionSet);
+	if (kernels == NULL)
+		return false;
+
+	GetBlockMathKernels() = kernels;
+	return true;
+}
+
+
+//
+// element-wise operations
+//
+
+void BlockMath::Add(const double* a, const double* b, double* out, uint32 numValues)				{ GetBlockMathKernels()->mAdd(a, b, out, numValues); }
+void BlockMath::Subtract(const double* a, const double* b, double* out, uint32 numValues)			{ GetBlockMathKernels()->mSubtract(a, b, out, numValues); }
+void BlockMath::Multiply(const double* a, const double* b, double* out, uint32 numValues)			{ GetBlockMathKernels()->mMultiply(a, b, out, numValues); }
+void BlockMath::Offset(const double* in, double offset, double* out, uint32 numValues)				{ GetBlockMathKernels()->mOffset(in, offset, out, numValues); }
+void BlockMath::Scale(const double* in, double factor, double* out, uint32 numValues)				{ GetBlockMathKernels()->mScale(in, factor, out, numValues); }
+void BlockMath::AddScaled(const double* in, double factor, double* out, uint32 numValues)			{ GetBlockMathKernels()->mAddScaled(in, factor, out, numValues); }
+void BlockMath::Abs(const double* in, double* out, uint32 numValues)								{ GetBlockMathKernels()->mAbs(in, out, numValues); }
+void BlockMath::Square(const double* in, double* out, uint32 numValues)								{ GetBlockMathKernels()->mSquare(in, out, numValues); }
+void BlockMath::Sqrt(const double* in, double* out, uint32 numValues)								{ GetBlockMathKernels()->mSqrt(in, out, numValues); }
+
+void BlockMath::Sin(const double* in, double* out, uint32 numValues)								{ for (uint32 i=0; i<numValues; ++i) out[i] = sin(in[i]); }
+void BlockMath::Cos(const double* in, double* out, uint32 numValues)								{ for (uint32 i=0; i<numValues; ++i) out[i] = cos(in[i]); }
+void BlockMath::Exp(const double* in, double* out, uint32 numValues)								{ for (uint32 i=0; i<numValues; ++i) out[i] = exp(in[i]); }
+void BlockMath::Log(const double* in, double* out, uint32 numValues)								{ for (uint32 i=0; i<numValues; ++i) out[i] = log(in[i]); }
+
+void BlockMath::FastSin(const double* in, double* out, uint32 numValues)							{ GetBlockMathKernels()->mFastSin(in, out, numValues); }
+void BlockMath::FastCos(const double* in, double* out, uint32 numValues)							{ GetBlockMathKernels()->mFastCos(in, out, numValues); }
+
+
+//
+// reductions
+//
+
+double BlockMath::Sum(const double* values, uint32 numValues)										{ return GetBlockMathKernels()->mSum(values, numValues); }
+double BlockMath::SumOfSquares(const double* values, uint32 numValues)								{ return GetBlockMathKernels()->mSumOfSquares(values, numValues); }
+double BlockMath::Dot(const double* a, const double* b, uint32 numValues)							{ return GetBlockMathKernels()->mDot(a, b, numValues); }
+
+
+double BlockMath::Min(const double* values, uint32 numValues)
+{
+	double minValue, maxValue;
+	MinMax(values, numValues, &minValue, &maxValue);
+	return minValue;
+}
+
+
+double BlockMath::Max(const double* values, uint32 numValues)
+{
+	double minValue, maxValue;
+	MinMax(values, numValues, &minValue, &maxValue);
+	return maxValue;
+}
+
+
+void BlockMath::MinMax(const double* values, uint32 numValues, double* outMin, double* outMax)
+{
+	if (numValues == 0)
+	{
+		*outMin = 0.0;
+		*outMax = 0.0;
+		return;
+	}
+
+	GetBlockMathKernels()->mMinMax(values, numValues, outMin, outMax);
+}
+
+
+//
+// self test
+//
+
+// compare a result with the one of the scalar kernel
+static bool BlockMathCheck(const BlockMathKernels* kernels, const char* kernelName, uint32 numValues, double value, double reference, double tolerance)
+{
+	if (fabs(value - reference) <= tolerance)
+		return true;
+
+	LogError("BlockMath: %s kernel %s deviates from the scalar one for %i values (%.17g instead of %.17g)", BlockMath::GetInstructionSetName(kernels->mInstructionSet), kernelName, numValues, value, reference);
+	return false;
+}
+
+
+// compare the outputs of an element-wise kernel with the ones of the scalar kernel (tolerance relative to the values)
+static bool BlockMathCheck(const BlockMathKernels* kernels, const char* kernelName, uint32 numValues, const double* values, const double* reference, double tolerance)
+{
+	for (uint32 i=0; i<numValues; ++i)
+	{
+		if (BlockMathCheck(kernels, kernelName, numValues, values[i], reference[i], tolerance * Core::Max(fabs(reference[i]), 1.0)) == false)
+			return false;
+	}
+
+	return true;
+}
+
+
+// compare the kernels of all supported instruction sets with the scalar reference
+bool BlockMath::SelfTest()
+{
+	const uint32 maxNumValues = 70;
+	const BlockMathKernels* reference = FindBlockMathKernels(INSTRUCTIONSET_SCALAR);
+
+	// pseudo random inputs in [-100, 100], one element off so the vector loads are unaligned
+	double bufferA[maxNumValues+1], bufferB[maxNumValues+1], bufferPositive[maxNumValues+1], bufferAngles[maxNumValues+1];
+	double* a			= bufferA + 1;
+	double* b			= bufferB + 1;
+	double* positive	= bufferPositive + 1;
+	double* angles		= bufferAngles + 1;
+
+	uint32 seed = 0x2545F491;
+	for (uint32 i=0; i<maxNumValues; ++i)
+	{
+		seed = seed * 1664525 + 1013904223;
+		a[i] = (seed >> 8) / 16777216.0 * 200.0 - 100.0;
+		seed = seed * 1664525 + 1013904223;
+		b[i] = (seed >> 8) / 16777216.0 * 200.0 - 100.0;
+
+		positive[i]	= fabs(a[i]);
+		angles[i]	= a[i] * b[i] * 10.0;		// up to 1e5, far outside the range of a single period
+	}
+
+	// element-wise operations round each value only once, the polynomial sine differs in the order of the operations only
+	const double elementTolerance	= 4.0 * DBL_EPSILON;
+	const double sinTolerance		= 1e-15;
+
+	double out[maxNumValues], referenceOut[maxNumValues];
+
+	bool result = true;
+	const uint32 numKernels = sizeof(gBlockMathKernels) / sizeof(BlockMathKernels);
+	for (uint32 k=0; k<numKernels; ++k)
+	{
+		const BlockMathKernels* kernels = &gBlockMathKernels[k];
+		if (kernels == reference || kernels->mInstructionSet > DetectInstructionSet())
+			continue;
+
+		for (uint32 n=0; n<maxNumValues; ++n)
+		{
+			#define BLOCKMATH_CHECK_ELEMENTWISE(KERNEL, ...)												\
+				kernels->KERNEL(__VA_ARGS__, out, n);														\
+				reference->KERNEL(__VA_ARGS__, referenceOut, n);											\
+				result &= BlockMathCheck(kernels, #KERNEL, n, out, referenceOut, elementTolerance);
+
+			BLOCKMATH_CHECK_ELEMENTWISE( mAdd, a, b );
+			BLOCKMATH_CHECK_ELEMENTWISE( mSubtract, a, b );
+			BLOCKMATH_CHECK_ELEMENTWISE( mMultiply, a, b );
+			BLOCKMATH_CHECK_ELEMENTWISE( mOffset, a, 0.25 );
+			BLOCKMATH_CHECK_ELEMENTWISE( mScale, a, -3.5 );
+			BLOCKMATH_CHECK_ELEMENTWISE( mAbs, a );
+			BLOCKMATH_CHECK_ELEMENTWISE( mSquare, a );
+			BLOCKMATH_CHECK_ELEMENTWISE( mSqrt, positive );
+			#undef BLOCKMATH_CHECK_ELEMENTWISE
+
+			// accumulates into the output
+			for (uint32 i=0; i<n; ++i)
+				out[i] = referenceOut[i] = b[i];
+			kernels->mAddScaled(a, 0.75, out, n);
+			reference->mAddScaled(a, 0.75, referenceOut, n);
+			result &= BlockMathCheck(kernels, "mAddScaled", n, out, referenceOut, elementTolerance);
+
+			kernels->mFastSin(angles, out, n);
+			reference->mFastSin(angles, referenceOut, n);
+			result &= BlockMathCheck(kernels, "mFastSin", n, out, referenceOut, sinTolerance);
+
+			kernels->mFastCos(angles, out, n);
+			reference->mFastCos(angles, referenceOut, n);
+			result &= BlockMathCheck(kernels, "mFastCos", n, out, referenceOut, sinTolerance);
+
+			// the reductions sum up in a different order: allow rounding errors relative to the magnitude of the summands
+			double sumOfMagnitudes = 0.0, sumOfSquareMagnitudes = 0.0, dotMagnitudes = 0.0;
+			for (uint32 i=0; i<n; ++i)
+			{
+				sumOfMagnitudes			+= fabs(a[i]);
+				sumOfSquareMagnitudes	+= a[i] * a[i];
+				dotMagnitudes			+= fabs(a[i] * b[i]);
+			}
+
+			const double sumTolerance = n * DBL_EPSILON;
+			result &= BlockMathCheck(kernels, "mSum", n, kernels->mSum(a, n), reference->mSum(a, n), sumTolerance * sumOfMagnitudes);
+			result &= BlockMathCheck(kernels, "mSumOfSquares", n, kernels->mSumOfSquares(a, n), reference->mSumOfSquares(a, n), sumTolerance * sumOfSquareMagnitudes);
+			result &= BlockMathCheck(kernels, "mDot", n, kernels->mDot(a, b, n), reference->mDot(a, b, n), sumTolerance * dotMagnitudes);
+
+			// min and max pick one of the values
+			if (n > 0)
+			{
+				double minValue, maxValue, referenceMin, referenceMax;
+				kernels->mMinMax(a, n, &minValue, &maxValue);
+				reference->mMinMax(a, n, &referenceMin, &referenceMax);
+				result &= BlockMathCheck(kernels, "mMinMax (min)", n, minValue, referenceMin, 0.0);
+				result &= BlockMathCheck(kernels, "mMinMax (max)", n, maxValue, referenceMax, 0.0);
+			}
+		}
+	}
+
+	return result;
+}
+
+}	// namespace Core
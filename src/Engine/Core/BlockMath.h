@@ -0,0 +1,106 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __CORE_BLOCKMATH_H
+#define __CORE_BLOCKMATH_H
+
+//  include required headers
+#include "StandardHeaders.h"
+
+
+namespace Core
+{
+
+// Array versions of the common math functions and reductions, for processing blocks of samples at once.
+// The kernels are selected at runtime depending on the instruction sets the CPU supports (SSE2/AVX2/AVX-512 on x86, NEON on ARM64).
+// The scalar kernels are the reference implementation. Note that the vectorized reductions sum up in a different order, so their results
+// may differ from the scalar ones in the last bits.
+class ENGINE_API BlockMath
+{
+	public:
+		enum EInstructionSet
+		{
+			INSTRUCTIONSET_SCALAR	= 0,
+			INSTRUCTIONSET_SSE2		= 1,
+			INSTRUCTIONSET_AVX2		= 2,
+			INSTRUCTIONSET_AVX512	= 3,
+			INSTRUCTIONSET_NEON		= 4
+		};
+
+		// the kernels that are currently used
+		static EInstructionSet GetInstructionSet();
+		static const char* GetInstructionSetName(EInstructionSet instructionSet);
+
+		// the best instruction set supported by the CPU (and compiled in)
+		static EInstructionSet DetectInstructionSet();
+
+		// force the given instruction set (e.g. scalar for comparing against the reference); returns false and keeps the current kernels if it is not supported
+		// NOTE: not thread safe, only call this before processing starts
+		static bool SetInstructionSet(EInstructionSet instructionSet);
+
+		// compare the kernels of all instruction sets the CPU supports with the scalar reference, on unaligned blocks of 0..69 values (the main loops
+		// and all remainders of every vector width); logs the deviations and returns false if there are any
+		static bool SelfTest();
+
+		//
+		// element-wise operations (the output may be the same array as one of the inputs)
+		//
+
+		static void Add(const double* a, const double* b, double* out, uint32 numValues);				// out = a + b
+		static void Subtract(const double* a, const double* b, double* out, uint32 numValues);			// out = a - b
+		static void Multiply(const double* a, const double* b, double* out, uint32 numValues);			// out = a * b
+		static void Offset(const double* in, double offset, double* out, uint32 numValues);			// out = in + offset
+		static void Scale(const double* in, double factor, double* out, uint32 numValues);				// out = in * factor
+		static void AddScaled(const double* in, double factor, double* out, uint32 numValues);			// out = out + in * factor
+		static void Abs(const double* in, double* out, uint32 numValues);
+		static void Square(const double* in, double* out, uint32 numValues);
+		static void Sqrt(const double* in, double* out, uint32 numValues);
+
+		// transcendental functions (evaluated with the libm functions element by element, so they give the same results as Math::SinD() etc.)
+		static void Sin(const double* in, double* out, uint32 numValues);
+		static void Cos(const double* in, double* out, uint32 numValues);
+		static void Exp(const double* in, double* out, uint32 numValues);
+		static void Log(const double* in, double* out, uint32 numValues);
+
+		// vectorized polynomial approximations of sin and cos (absolute error below 1e-15 for |x| < 1e6); use these where speed matters more
+		// than results identical to libm, e.g. for signal synthesis
+		static void FastSin(const double* in, double* out, uint32 numValues);
+		static void FastCos(const double* in, double* out, uint32 numValues);
+
+		//
+		// reductions (all return 0 for empty arrays)
+		//
+
+		static double Sum(const double* values, uint32 numValues);
+		static double SumOfSquares(const double* values, uint32 numValues);
+		static double Dot(const double* a, const double* b, uint32 numValues);
+		static double Min(const double* values, uint32 numValues);
+		static double Max(const double* values, uint32 numValues);
+		static void MinMax(const double* values, uint32 numValues, double* outMin, double* outMax);
+};
+
+}	// namespace Core
+
+
+#endif
@@ -0,0 +1,259 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// Vectorized BlockMath kernels. This file is included once per instruction set by BlockMath.cpp, inside a namespace that defines
+// the vector type, its width, the vector primitives (VLoad, VAdd, ...) and BLOCKMATH_TARGET (the compiler target attribute).
+
+BLOCKMATH_TARGET static void Add(const double* a, const double* b, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VAdd(VLoad(a+i), VLoad(b+i)) );
+	for (; i<numValues; ++i)
+		out[i] = a[i] + b[i];
+}
+
+
+BLOCKMATH_TARGET static void Subtract(const double* a, const double* b, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VSub(VLoad(a+i), VLoad(b+i)) );
+	for (; i<numValues; ++i)
+		out[i] = a[i] - b[i];
+}
+
+
+BLOCKMATH_TARGET static void Multiply(const double* a, const double* b, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VMul(VLoad(a+i), VLoad(b+i)) );
+	for (; i<numValues; ++i)
+		out[i] = a[i] * b[i];
+}
+
+
+BLOCKMATH_TARGET static void Offset(const double* in, double offset, double* out, uint32 numValues)
+{
+	const Vector offsetVector = VSet1(offset);
+
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VAdd(VLoad(in+i), offsetVector) );
+	for (; i<numValues; ++i)
+		out[i] = in[i] + offset;
+}
+
+
+BLOCKMATH_TARGET static void Scale(const double* in, double factor, double* out, uint32 numValues)
+{
+	const Vector factorVector = VSet1(factor);
+
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VMul(VLoad(in+i), factorVector) );
+	for (; i<numValues; ++i)
+		out[i] = in[i] * factor;
+}
+
+
+BLOCKMATH_TARGET static void AddScaled(const double* in, double factor, double* out, uint32 numValues)
+{
+	const Vector factorVector = VSet1(factor);
+
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VAdd(VLoad(out+i), VMul(VLoad(in+i), factorVector)) );
+	for (; i<numValues; ++i)
+		out[i] += in[i] * factor;
+}
+
+
+BLOCKMATH_TARGET static void Abs(const double* in, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VAbs(VLoad(in+i)) );
+	for (; i<numValues; ++i)
+		out[i] = fabs(in[i]);
+}
+
+
+BLOCKMATH_TARGET static void Square(const double* in, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+	{
+		const Vector value = VLoad(in+i);
+		VStore( out+i, VMul(value, value) );
+	}
+	for (; i<numValues; ++i)
+		out[i] = in[i] * in[i];
+}
+
+
+BLOCKMATH_TARGET static void Sqrt(const double* in, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VSqrt(VLoad(in+i)) );
+	for (; i<numValues; ++i)
+		out[i] = sqrt(in[i]);
+}
+
+
+// polynomial sin(x + shift * pi) of a vector (see BlockMathSin for the constants)
+BLOCKMATH_TARGET static inline Vector VSinPoly(Vector x, double shift)
+{
+	using namespace BlockMathSin;
+
+	const Vector magic = VSet1(roundMagic);
+
+	// x + shift * pi = k * pi + r, sin(x + shift * pi) = (-1)^k * sin(r)
+	const Vector k = VSub( VAdd(VAdd(VMul(x, VSet1(invPi)), VSet1(shift)), magic), magic );
+	const Vector m = VSub( k, VSet1(shift) );
+	Vector r = VSub( x, VMul(m, VSet1(pi1)) );
+	r = VSub( r, VMul(m, VSet1(pi2)) );
+	r = VSub( r, VMul(m, VSet1(pi3)) );
+	const Vector halfK = VSub( VAdd(VMul(k, VSet1(0.5)), magic), magic );
+	const Vector sign = VSub( VSet1(1.0), VMul(VSet1(2.0), VAbs(VSub(k, VAdd(halfK, halfK)))) );
+
+	const Vector r2 = VMul(r, r);
+	Vector p = VSet1(c21);
+	p = VAdd( VMul(p, r2), VSet1(c19) );
+	p = VAdd( VMul(p, r2), VSet1(c17) );
+	p = VAdd( VMul(p, r2), VSet1(c15) );
+	p = VAdd( VMul(p, r2), VSet1(c13) );
+	p = VAdd( VMul(p, r2), VSet1(c11) );
+	p = VAdd( VMul(p, r2), VSet1(c9) );
+	p = VAdd( VMul(p, r2), VSet1(c7) );
+	p = VAdd( VMul(p, r2), VSet1(c5) );
+	p = VAdd( VMul(p, r2), VSet1(c3) );
+
+	return VMul( sign, VAdd(r, VMul(VMul(r, r2), p)) );
+}
+
+
+BLOCKMATH_TARGET static void FastSin(const double* in, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VSinPoly(VLoad(in+i), 0.0) );
+	for (; i<numValues; ++i)
+		out[i] = BlockMathScalar::SinPoly(in[i], 0.0);
+}
+
+
+BLOCKMATH_TARGET static void FastCos(const double* in, double* out, uint32 numValues)
+{
+	uint32 i = 0;
+	for (; i+width<=numValues; i+=width)
+		VStore( out+i, VSinPoly(VLoad(in+i), 0.5) );
+	for (; i<numValues; ++i)
+		out[i] = BlockMathScalar::SinPoly(in[i], 0.5);
+}
+
+
+// the reductions use two accumulators to hide the latency of the additions
+BLOCKMATH_TARGET static double Sum(const double* values, uint32 numValues)
+{
+	Vector sum0 = VZero();
+	Vector sum1 = VZero();
+
+	uint32 i = 0;
+	for (; i+2*width<=numValues; i+=2*width)
+	{
+		sum0 = VAdd( sum0, VLoad(values+i) );
+		sum1 = VAdd( sum1, VLoad(values+i+width) );
+	}
+	for (; i+width<=numValues; i+=width)
+		sum0 = VAdd( sum0, VLoad(values+i) );
+
+	double result = VReduceAdd( VAdd(sum0, sum1) );
+	for (; i<numValues; ++i)
+		result += values[i];
+
+	return result;
+}
+
+
+BLOCKMATH_TARGET static double Dot(const double* a, const double* b, uint32 numValues)
+{
+	Vector sum0 = VZero();
+	Vector sum1 = VZero();
+
+	uint32 i = 0;
+	for (; i+2*width<=numValues; i+=2*width)
+	{
+		sum0 = VAdd( sum0, VMul(VLoad(a+i), VLoad(b+i)) );
+		sum1 = VAdd( sum1, VMul(VLoad(a+i+width), VLoad(b+i+width)) );
+	}
+	for (; i+width<=numValues; i+=width)
+		sum0 = VAdd( sum0, VMul(VLoad(a+i), VLoad(b+i)) );
+
+	double result = VReduceAdd( VAdd(sum0, sum1) );
+	for (; i<numValues; ++i)
+		result += a[i] * b[i];
+
+	return result;
+}
+
+
+BLOCKMATH_TARGET static double SumOfSquares(const double* values, uint32 numValues)
+{
+	return Dot(values, values, numValues);
+}
+
+
+BLOCKMATH_TARGET static void MinMax(const double* values, uint32 numValues, double* outMin, double* outMax)
+{
+	double minValue = DBL_MAX;
+	double maxValue = -DBL_MAX;
+
+	uint32 i = 0;
+	if (numValues >= width)
+	{
+		Vector minVector = VLoad(values);
+		Vector maxVector = minVector;
+		for (i=width; i+width<=numValues; i+=width)
+		{
+			const Vector value = VLoad(values+i);
+			minVector = VMin( minVector, value );
+			maxVector = VMax( maxVector, value );
+		}
+
+		minValue = VReduceMin(minVector);
+		maxValue = VReduceMax(maxVector);
+	}
+
+	for (; i<numValues; ++i)
+	{
+		minValue = (values[i] < minValue) ? values[i] : minValue;
+		maxValue = (values[i] > maxValue) ? values[i] : maxValue;
+	}
+
+	*outMin = minValue;
+	*outMax = maxValue;
+}
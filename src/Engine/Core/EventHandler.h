@@ -46,12 +46,16 @@ namespace Core
 class ENGINE_API EventHandler
 {
 	public:
-		EventHandler() : mEventSystemAcceptEvents(true) {}
+		EventHandler() : mEventSystemAcceptEvents(true), mIsMainThreadOnly(false) {}
 		virtual ~EventHandler() {}
 
 		void SetAcceptEvents(bool accept = true)		{ mEventSystemAcceptEvents = accept; }
 		bool GetAcceptEvents() const					{ return mEventSystemAcceptEvents; }
 
+		// handlers that must only be called from the main thread (e.g. user interface); events raised on other threads are deferred (see EventManager::ProcessDeferredEvents())
+		void SetIsMainThreadOnly(bool mainThreadOnly = true)	{ mIsMainThreadOnly = mainThreadOnly; }
+		bool IsMainThreadOnly() const							{ return mIsMainThreadOnly; }
+
 		//
 		// Core Events
 		//  Frequently used events in the core are implemented with their own callback functions which reduces the calling overhead.
@@ -160,6 +164,9 @@ class ENGINE_API EventHandler
 		// enable/disable all events
 		bool mEventSystemAcceptEvents;
 
+		// defer events that are raised on other threads
+		bool mIsMainThreadOnly;
+
 };
 
 } // namespace Core
@@ -37,6 +37,7 @@ namespace Core
 EventManager::EventManager()
 {
 	mEventLogger = NULL;
+	mMainThreadID = std::this_thread::get_id();
 
 #ifdef CORE_DEBUG
 	// enable event logging
@@ -87,10 +88,71 @@ bool EventManager::RemoveEventHandler(EventHandler* eventHandler, bool delFromMe
 
 void EventManager::RemoveEventHandler(uint32 index, bool delFromMem)
 {
+	EventHandler* eventHandler = mEventHandlers[index];
+
+	// drop the deferred events of the handler
+	mDeferredEventsLock.Lock();
+	for (uint32 i=0; i<mDeferredEvents.size(); )
+	{
+		if (mDeferredEvents[i].mHandler == eventHandler)
+			mDeferredEvents.erase( mDeferredEvents.begin() + i );
+		else
+			++i;
+	}
+	mDeferredEventsLock.Unlock();
+
 	if (delFromMem == true)
-		delete mEventHandlers[index];
+		delete eventHandler;
 
 	mEventHandlers.Remove(index);
 }
 
+
+// queue an event for a main-thread-only handler
+void EventManager::DeferEvent(EventHandler* handler, const std::function<void()>& function)
+{
+	DeferredEvent deferredEvent;
+	deferredEvent.mHandler	= handler;
+	deferredEvent.mFunction	= function;
+
+	mDeferredEventsLock.Lock();
+	mDeferredEvents.push_back(deferredEvent);
+	mDeferredEventsLock.Unlock();
+}
+
+
+bool EventManager::HasDeferredEvents()
+{
+	mDeferredEventsLock.Lock();
+	const bool result = (mDeferredEvents.empty() == false);
+	mDeferredEventsLock.Unlock();
+
+	return result;
+}
+
+
+// deliver all deferred events
+void EventManager::ProcessDeferredEvents()
+{
+	CORE_ASSERT( IsMainThread() == true );
+
+	// deliver the events one by one (handlers may raise new events or remove handlers while processing)
+	while (true)
+	{
+		mDeferredEventsLock.Lock();
+		if (mDeferredEvents.empty() == true)
+		{
+			mDeferredEventsLock.Unlock();
+			break;
+		}
+
+		DeferredEvent deferredEvent = mDeferredEvents.front();
+		mDeferredEvents.erase( mDeferredEvents.begin() );
+		mDeferredEventsLock.Unlock();
+
+		if (deferredEvent.mHandler->GetAcceptEvents() == true)
+			deferredEvent.mFunction();
+	}
+}
+
 } // namespace Core
@@ -31,6 +31,10 @@
 #include "EventHandler.h"
 #include "EventLogger.h"
 #include "EventManagerHelpers.h"
+#include "Mutex.h"
+#include <functional>
+#include <thread>
+#include <vector>
 
 // forward declaration
 class Graph;
@@ -58,6 +62,21 @@ class ENGINE_API EventManager
 
 		//---------------------------------------------------------------------
 
+		//
+		// Threading
+		//  Handlers that are flagged as main-thread-only do not get called directly when an event is raised on another thread (e.g. the engine thread).
+		//  The event is queued instead, and delivered once the main thread calls ProcessDeferredEvents().
+
+		// the thread that constructed the event manager is the main thread by default
+		void SetMainThread()									{ mMainThreadID = std::this_thread::get_id(); }
+		bool IsMainThread() const								{ return std::this_thread::get_id() == mMainThreadID; }
+
+		// deliver all deferred events (call this from the main thread only)
+		void ProcessDeferredEvents();
+		bool HasDeferredEvents();
+
+		//---------------------------------------------------------------------
+
 		//
 		// Core Events
 		//  Frequently used events in the core are implemented with their own callback functions which reduces the calling overhead.
@@ -66,21 +85,37 @@ class ENGINE_API EventManager
 		// Progress View Events
 		void OnProgressStart( bool showProgressText, bool showProgressValue, bool showSubProgressText, bool showSubProgressValue )
 		{
+			const bool isMainThread = IsMainThread();
 			const uint32 numEventHandlers = mEventHandlers.Size();
 			for (uint32 i = 0; i < numEventHandlers; ++i)
 			{
-				mEventHandlers[i]->OnProgressStart( showProgressText, showProgressValue, showSubProgressText, showSubProgressValue );
-				mEventHandlers[i]->OnProgressValue( 0.0f );
+				EventHandler* handler = mEventHandlers[i];
+				if (isMainThread == false && handler->IsMainThreadOnly() == true)
+				{
+					DeferEvent( handler, [=]() { handler->OnProgressStart( showProgressText, showProgressValue, showSubProgressText, showSubProgressValue ); handler->OnProgressValue( 0.0f ); } );
+					continue;
+				}
+
+				handler->OnProgressStart( showProgressText, showProgressValue, showSubProgressText, showSubProgressValue );
+				handler->OnProgressValue( 0.0f );
 			}
 		}
 
 		void OnProgressEnd()
 		{
+			const bool isMainThread = IsMainThread();
 			const uint32 numEventHandlers = mEventHandlers.Size();
 			for (uint32 i = 0; i<numEventHandlers; ++i)
 			{
-				mEventHandlers[i]->OnProgressValue( 100.0f ); 
-				mEventHandlers[i]->OnProgressEnd();
+				EventHandler* handler = mEventHandlers[i];
+				if (isMainThread == false && handler->IsMainThreadOnly() == true)
+				{
+					DeferEvent( handler, [handler]() { handler->OnProgressValue( 100.0f ); handler->OnProgressEnd(); } );
+					continue;
+				}
+
+				handler->OnProgressValue( 100.0f ); 
+				handler->OnProgressEnd();
 			}
 		}
 
@@ -166,8 +201,22 @@ class ENGINE_API EventManager
 		EVENT_CREATE_NOTIFY_FUNCTION_0( OnHideTextInput );
 
 	private:
+		// queue an event for a main-thread-only handler
+		void DeferEvent(EventHandler* handler, const std::function<void()>& function);
+
+		struct DeferredEvent
+		{
+			EventHandler*				mHandler;
+			std::function<void()>		mFunction;
+		};
+
 		Core::Array<EventHandler*>			mEventHandlers;
 		EventLogger*						mEventLogger;
+
+		// deferred events
+		std::thread::id						mMainThreadID;
+		std::vector<DeferredEvent>			mDeferredEvents;
+		Mutex								mDeferredEventsLock;
 };
 
 } // namespace Core
@@ -24,52 +24,135 @@
 #ifndef __CORE_EVENTMANAGERHELPERS_H
 #define __CORE_EVENTMANAGERHELPERS_H
 
+// include the required headers
+#include "String.h"
+#include <type_traits>
+
+
+namespace Core
+{
+
+// copy of an event argument for deferred events (strings are copied, everything else is stored by value)
+template<class T>
+class EventArgument
+{
+	public:
+		EventArgument(T value) : mValue(value)			{}
+		T Get() const									{ return mValue; }
+
+	private:
+		typename std::decay<T>::type mValue;
+};
+
+template<>
+class EventArgument<const char*>
+{
+	public:
+		EventArgument(const char* value) : mValue(value)	{}
+		const char* Get() const								{ return mValue.AsChar(); }
+
+	private:
+		Core::String mValue;
+};
+
+}	// namespace Core
+
+
 /**
  * Helper macros for implementing the notify functions (contain loops that call all registered EventHandlers) in the EventManager. 
  * They allow us to implement event callbacks with zero overhead which is useful for frequently used core events,
  * but on the flipside disallow us to selectively disable/block them.
+ * Events that are raised outside of the main thread are deferred for handlers that are flagged as main-thread-only (see EventHandler::SetIsMainThreadOnly()).
  */
-#define EVENT_CREATE_NOTIFY_FUNCTION_0(FNAME)					\
-	void FNAME() {												\
-		const uint32 size = mEventHandlers.Size();			\
-		for (uint32 i = 0; i<size; ++i)							\
-			if (mEventHandlers[i]->GetAcceptEvents() == true)	\
-				mEventHandlers[i]->FNAME(); }
-
-#define EVENT_CREATE_NOTIFY_FUNCTION_1(FNAME, TYPE1, VNAME1)	\
-	void FNAME(TYPE1 VNAME1) {									\
-		const uint32 size = mEventHandlers.Size();			\
-		for (uint32 i = 0; i<size; ++i)							\
-			if (mEventHandlers[i]->GetAcceptEvents() == true)	\
-				mEventHandlers[i]->FNAME( VNAME1 );		  }
-
-#define EVENT_CREATE_NOTIFY_FUNCTION_2(FNAME, TYPE1, VNAME1, TYPE2, VNAME2)	\
-	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2) {								\
-		const uint32 size = mEventHandlers.Size();						\
-		for (uint32 i = 0; i<size; ++i)										\
-			if (mEventHandlers[i]->GetAcceptEvents() == true)				\
-				mEventHandlers[i]->FNAME( VNAME1, VNAME2 );			}
-
-#define EVENT_CREATE_NOTIFY_FUNCTION_3(FNAME, TYPE1, VNAME1, TYPE2, VNAME2, TYPE3, VNAME3)	\
-	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2, TYPE3 VNAME3)	{								\
-		const uint32 size = mEventHandlers.Size();										\
-		for (uint32 i = 0; i<size; ++i)														\
-			if (mEventHandlers[i]->GetAcceptEvents() == true)								\
-				mEventHandlers[i]->FNAME( VNAME1, VNAME2, VNAME3 );		}
-
-#define EVENT_CREATE_NOTIFY_FUNCTION_4(FNAME, TYPE1, VNAME1, TYPE2, VNAME2, TYPE3, VNAME3, TYPE4, VNAME4)	\
-	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2, TYPE3 VNAME3, TYPE4 VNAME4)	{									\
-		const uint32 size = mEventHandlers.Size();														\
-		for (uint32 i = 0; i<size; ++i)																		\
-			if (mEventHandlers[i]->GetAcceptEvents() == true)												\
-				mEventHandlers[i]->FNAME( VNAME1, VNAME2, VNAME3, VNAME4 ); }
+#define EVENT_CREATE_NOTIFY_FUNCTION_0(FNAME)																	\
+	void FNAME() {																								\
+		const bool isMainThread = IsMainThread();																\
+		const uint32 size = mEventHandlers.Size();															\
+		for (uint32 i = 0; i<size; ++i)																			\
+		{																										\
+			EventHandler* handler = mEventHandlers[i];															\
+			if (handler->GetAcceptEvents() == false)															\
+				continue;																						\
+			if (isMainThread == false && handler->IsMainThreadOnly() == true)									\
+				DeferEvent( handler, [handler]() { handler->FNAME(); } );										\
+			else																								\
+				handler->FNAME();																				\
+		} }
+
+#define EVENT_CREATE_NOTIFY_FUNCTION_1(FNAME, TYPE1, VNAME1)													\
+	void FNAME(TYPE1 VNAME1) {																					\
+		const bool isMainThread = IsMainThread();																\
+		const uint32 size = mEventHandlers.Size();															\
+		for (uint32 i = 0; i<size; ++i)																			\
+		{																										\
+			EventHandler* handler = mEventHandlers[i];															\
+			if (handler->GetAcceptEvents() == false)															\
+				continue;																						\
+			if (isMainThread == false && handler->IsMainThreadOnly() == true)									\
+				DeferEvent( handler, [handler, a1 = EventArgument<TYPE1>(VNAME1)]() { handler->FNAME( a1.Get() ); } );	\
+			else																								\
+				handler->FNAME( VNAME1 );																		\
+		} }
+
+#define EVENT_CREATE_NOTIFY_FUNCTION_2(FNAME, TYPE1, VNAME1, TYPE2, VNAME2)										\
+	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2) {																	\
+		const bool isMainThread = IsMainThread();																\
+		const uint32 size = mEventHandlers.Size();															\
+		for (uint32 i = 0; i<size; ++i)																			\
+		{																										\
+			EventHandler* handler = mEventHandlers[i];															\
+			if (handler->GetAcceptEvents() == false)															\
+				continue;																						\
+			if (isMainThread == false && handler->IsMainThreadOnly() == true)									\
+				DeferEvent( handler, [handler, a1 = EventArgument<TYPE1>(VNAME1), a2 = EventArgument<TYPE2>(VNAME2)]() { handler->FNAME( a1.Get(), a2.Get() ); } );	\
+			else																								\
+				handler->FNAME( VNAME1, VNAME2 );																\
+		} }
+
+#define EVENT_CREATE_NOTIFY_FUNCTION_3(FNAME, TYPE1, VNAME1, TYPE2, VNAME2, TYPE3, VNAME3)						\
+	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2, TYPE3 VNAME3) {														\
+		const bool isMainThread = IsMainThread();																\
+		const uint32 size = mEventHandlers.Size();															\
+		for (uint32 i = 0; i<size; ++i)																			\
+		{																										\
+			EventHandler* handler = mEventHandlers[i];															\
+			if (handler->GetAcceptEvents() == false)															\
+				continue;																						\
+			if (isMainThread == false && handler->IsMainThreadOnly() == true)									\
+				DeferEvent( handler, [handler, a1 = EventArgument<TYPE1>(VNAME1), a2 = EventArgument<TYPE2>(VNAME2), a3 = EventArgument<TYPE3>(VNAME3)]() { handler->FNAME( a1.Get(), a2.Get(), a3.Get() ); } );	\
+			else																								\
+				handler->FNAME( VNAME1, VNAME2, VNAME3 );														\
+		} }
+
+#define EVENT_CREATE_NOTIFY_FUNCTION_4(FNAME, TYPE1, VNAME1, TYPE2, VNAME2, TYPE3, VNAME3, TYPE4, VNAME4)		\
+	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2, TYPE3 VNAME3, TYPE4 VNAME4) {										\
+		const bool isMainThread = IsMainThread();																\
+		const uint32 size = mEventHandlers.Size();															\
+		for (uint32 i = 0; i<size; ++i)																			\
+		{																										\
+			EventHandler* handler = mEventHandlers[i];															\
+			if (handler->GetAcceptEvents() == false)															\
+				continue;																						\
+			if (isMainThread == false && handler->IsMainThreadOnly() == true)									\
+				DeferEvent( handler, [handler, a1 = EventArgument<TYPE1>(VNAME1), a2 = EventArgument<TYPE2>(VNAME2), a3 = EventArgument<TYPE3>(VNAME3), a4 = EventArgument<TYPE4>(VNAME4)]() { handler->FNAME( a1.Get(), a2.Get(), a3.Get(), a4.Get() ); } );	\
+			else																								\
+				handler->FNAME( VNAME1, VNAME2, VNAME3, VNAME4 );												\
+		} }
 
 #define EVENT_CREATE_NOTIFY_FUNCTION_5(FNAME, TYPE1, VNAME1, TYPE2, VNAME2, TYPE3, VNAME3, TYPE4, VNAME4, TYPE5, VNAME5)	\
-	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2, TYPE3 VNAME3, TYPE4 VNAME4, TYPE5 VNAME5)	{									\
-		const uint32 size = mEventHandlers.Size();																		\
-		for (uint32 i = 0; i<size; ++i)																						\
-			if (mEventHandlers[i]->GetAcceptEvents() == true)																\
-				mEventHandlers[i]->FNAME( VNAME1, VNAME2, VNAME3, VNAME4, VNAME5 ); }
+	void FNAME(TYPE1 VNAME1, TYPE2 VNAME2, TYPE3 VNAME3, TYPE4 VNAME4, TYPE5 VNAME5) {							\
+		const bool isMainThread = IsMainThread();																\
+		const uint32 size = mEventHandlers.Size();															\
+		for (uint32 i = 0; i<size; ++i)																			\
+		{																										\
+			EventHandler* handler = mEventHandlers[i];															\
+			if (handler->GetAcceptEvents() == false)															\
+				continue;																						\
+			if (isMainThread == false && handler->IsMainThreadOnly() == true)									\
+				DeferEvent( handler, [handler, a1 = EventArgument<TYPE1>(VNAME1), a2 = EventArgument<TYPE2>(VNAME2), a3 = EventArgument<TYPE3>(VNAME3), a4 = EventArgument<TYPE4>(VNAME4), a5 = EventArgument<TYPE5>(VNAME5)]() { handler->FNAME( a1.Get(), a2.Get(), a3.Get(), a4.Get(), a5.Get() ); } );	\
+			else																								\
+				handler->FNAME( VNAME1, VNAME2, VNAME3, VNAME4, VNAME5 );										\
+		} }
 
 
 #endif
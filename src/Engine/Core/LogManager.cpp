@@ -28,11 +28,128 @@
 #include "LogManager.h"
 #include "../EngineManager.h"
 #include "Time.h"
+#include "Thread.h"
+#include "ThreadHandler.h"
 
 
 namespace Core
 {
 
+// a formatted log message waiting for the log thread
+struct LogRecord
+{
+	ELogLevel	mLogLevel;
+	Time		mTime;
+	char		mText[1024];					// longer messages get truncated
+};
+
+
+// bounded lock-free queue for log records (many producers, one consumer)
+// each cell carries a sequence number that tells producers and the consumer whether the cell is free, being written or ready to read
+class LogRecordQueue
+{
+	public:
+		LogRecordQueue(uint32 numCells) : mEnqueuePos(0), mDequeuePos(0), mNumDropped(0)
+		{
+			CORE_ASSERT((numCells & (numCells - 1)) == 0);
+			mMask = numCells - 1;
+			mCells = new Cell[numCells];
+			for (uint32 i=0; i<numCells; ++i)
+				mCells[i].mSequence.store(i, std::memory_order_relaxed);
+		}
+
+		~LogRecordQueue()												{ delete[] mCells; }
+
+		// producer: reserve a free cell; returns NULL if the queue is full (the message is dropped)
+		LogRecord* BeginPush(uint32* outPosition)
+		{
+			uint32 position = mEnqueuePos.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell& cell = mCells[position & mMask];
+				const uint32 sequence = cell.mSequence.load(std::memory_order_acquire);
+				const int32 difference = (int32)sequence - (int32)position;
+				if (difference == 0)
+				{
+					if (mEnqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+					{
+						*outPosition = position;
+						return &cell.mRecord;
+					}
+				}
+				else if (difference < 0)
+				{
+					mNumDropped.fetch_add(1, std::memory_order_relaxed);
+					return NULL;
+				}
+				else
+					position = mEnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		// producer: the record is written, hand it to the consumer
+		void EndPush(uint32 position)									{ mCells[position & mMask].mSequence.store(position + 1, std::memory_order_release); }
+
+		// consumer: oldest record, or NULL if there is none (or it is still being written)
+		LogRecord* Front()
+		{
+			Cell& cell = mCells[mDequeuePos & mMask];
+			if (cell.mSequence.load(std::memory_order_acquire) != mDequeuePos + 1)
+				return NULL;
+
+			return &cell.mRecord;
+		}
+
+		// consumer: release the front record
+		void Pop()
+		{
+			mCells[mDequeuePos & mMask].mSequence.store(mDequeuePos + mMask + 1, std::memory_order_release);
+			mDequeuePos++;
+		}
+
+		uint32 ExchangeNumDropped()										{ return mNumDropped.exchange(0, std::memory_order_relaxed); }
+
+	private:
+		struct Cell
+		{
+			std::atomic<uint32>	mSequence;
+			LogRecord			mRecord;
+		};
+
+		Cell*				mCells;
+		uint32				mMask;
+		std::atomic<uint32>	mEnqueuePos;
+		uint32				mDequeuePos;						// only used by the consumer
+		std::atomic<uint32>	mNumDropped;
+};
+
+
+// the log thread: processes the queue until it gets terminated
+class LogManager::LogThreadHandler : public ThreadHandler
+{
+	public:
+		LogThreadHandler(LogManager* logManager) : mLogManager(logManager), mTerminate(false)		{ mIsFinished = false; }
+
+		void Execute() override
+		{
+			while (mTerminate.load() == false)
+			{
+				mLogManager->Flush();
+				Thread::Sleep(5.0);
+			}
+
+			mLogManager->Flush();
+			mIsFinished = true;
+		}
+
+		void Terminate() override										{ mTerminate.store(true); }
+
+	private:
+		LogManager*			mLogManager;
+		std::atomic<bool>	mTerminate;
+};
+
+
 // constructor
 LogManager::LogManager()
 {
@@ -49,12 +166,23 @@ LogManager::LogManager()
 	// init temporary string to a generous size (32k)
 	mLineFormattingBuffer.Reserve(32*1024);
 	mVarArgBuffer.Reserve(32*1024);
+
+	// synchronous logging by default
+	mIsAsync		= false;
+	mQueue			= NULL;
+	mThread			= NULL;
+	mLastLogLevel	= LOGLEVEL_NONE;
+	mNumRepeats		= 0;
 }
 
 
 // destructor
 LogManager::~LogManager()
 {
+	// log the queued messages
+	SetAsyncEnabled(false);
+	delete mQueue;
+
 	// get rid of the callbacks
 	ClearLogCallbacks();
 }
@@ -94,7 +222,10 @@ void LogManager::RemoveLogCallback(LogCallback* callback, bool delFromMem)
 
 	const uint32 index = FindLogCallback(callback);
 	if (mLogCallbacks.IsValidIndex(index) == false)
+	{
+		mLock.Unlock();
 		return;
+	}
 
 	if (delFromMem == true)
 		delete mLogCallbacks[index];
@@ -123,9 +254,15 @@ void LogManager::ClearLogCallbacks()
 void LogManager::LogMessage(const char* message, ELogLevel logLevel)
 {
 	// NOTE: thread lock _MUST_ be handled in the calling function.
-	
+	DispatchMessage( Time::Now(), message, logLevel );
+}
+
+
+// pass a message to all callbacks
+void LogManager::DispatchMessage(const Time& time, const char* message, ELogLevel logLevel)
+{
 	// append timestamp
-	mLineFormattingBuffer.Format("%s: %s", Time::Now().Format("%Y-%m-%d %H:%M:%S.%f").AsChar(), message);
+	mLineFormattingBuffer.Format("%s: %s", time.Format("%Y-%m-%d %H:%M:%S.%f").AsChar(), message);
 	
 	// iterate through all callbacks
 	const uint32 num = mLogCallbacks.Size();
@@ -196,126 +333,171 @@ void LogManager::SetActiveLogLevelPresetIndex(uint32 index)
 }
 
 
-void LogManager::LogCritical_Internal(const char* what, va_list args)
+// enable/disable asynchronous logging
+void LogManager::SetAsyncEnabled(bool enable)
 {
-	mLock.Lock();
+	if (enable == IsAsyncEnabled())
+		return;
 
-	// skip the va list construction in case that the message won't be logged by any of the callbacks
-	if (CORE_LOGMANAGER.GetLogLevels() & LOGLEVEL_CRITICAL)
+	if (enable == true)
 	{
-		mVarArgBuffer.Clear();
+		if (mQueue == NULL)
+			mQueue = new LogRecordQueue(2048);
 
-		// construct the final log line
-		vsprintf(mVarArgBuffer.AsChar(), what, args);
-		va_end(args);
+		mIsAsync.store(true);
 
-		// log the message
-		CORE_LOGMANAGER.LogMessage( mVarArgBuffer.AsChar(), LOGLEVEL_CRITICAL );
+		mThread = new Thread( new LogThreadHandler(this), "Log" );
+		mThread->Start();
+	}
+	else
+	{
+		// NOTE: producers that already passed the async check push after the final flush, they process the queue themselves (see Log_Internal)
+		mIsAsync.store(false);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		// the thread processes the remaining messages before it finishes
+		delete mThread;
+		mThread = NULL;
+
+		// messages of producers that were still in the middle of pushing
+		Flush();
+
+		// report the pending repetitions now, the synchronous mode doesn't collapse messages
+		mLock.Lock();
+		FlushRepeatedMessages();
+		mLastMessage.Clear();
+		mLock.Unlock();
 	}
-
-	mLock.Unlock();
 }
 
 
-void LogManager::LogError_Internal(const char* what, va_list args)
+// process all queued messages now
+void LogManager::Flush()
 {
-	mLock.Lock();
-
-	// skip the va list construction in case that the message won't be logged by any of the callbacks
-	if (CORE_LOGMANAGER.GetLogLevels() & LOGLEVEL_ERROR)
-	{
-		mVarArgBuffer.Clear();
-
-		vsprintf(mVarArgBuffer.AsChar(), what, args);
-		va_end(args);
-
-		// log the message
-		CORE_LOGMANAGER.LogMessage( mVarArgBuffer.AsChar(), LOGLEVEL_ERROR );
-	}
+	if (mQueue == NULL)
+		return;
 
+	mLock.Lock();
+	ProcessQueue();
 	mLock.Unlock();
 }
 
 
-void LogManager::LogWarning_Internal(const char* what, va_list args)
+// pass the queued messages to the callbacks
+void LogManager::ProcessQueue()
 {
-	mLock.Lock();
+	// NOTE: thread lock _MUST_ be handled in the calling function.
 
-	// skip the va list construction in case that the message won't be logged by any of the callbacks
-	if (CORE_LOGMANAGER.GetLogLevels() & LOGLEVEL_WARNING)
+	LogRecord* record = mQueue->Front();
+	while (record != NULL)
 	{
-		mVarArgBuffer.Clear();
+		// collapse repetitions of the same message
+		if (record->mLogLevel == mLastLogLevel && mLastMessage.IsEqual(record->mText) == true)
+		{
+			if (mNumRepeats == 0)
+				mFirstRepeatTime = record->mTime;
+			mNumRepeats++;
+		}
+		else
+		{
+			FlushRepeatedMessages();
+
+			DispatchMessage( record->mTime, record->mText, record->mLogLevel );
+			mLastMessage = record->mText;
+			mLastLogLevel = record->mLogLevel;
+		}
+
+		mQueue->Pop();
+		record = mQueue->Front();
+	}
 
-		vsprintf(mVarArgBuffer.AsChar(), what, args);
-		va_end(args);
+	// report repetitions at least once per second
+	if (mNumRepeats > 0 && (Time::Now() - mFirstRepeatTime).InSeconds() >= 1.0)
+		FlushRepeatedMessages();
 
-		// log the message
-		CORE_LOGMANAGER.LogMessage( mVarArgBuffer.AsChar(), LOGLEVEL_WARNING );
+	const uint32 numDropped = mQueue->ExchangeNumDropped();
+	if (numDropped > 0)
+	{
+		mVarArgBuffer.Format("%u log messages were dropped (log queue full).", numDropped);
+		DispatchMessage( Time::Now(), mVarArgBuffer.AsChar(), LOGLEVEL_WARNING );
 	}
-
-	mLock.Unlock();
 }
 
 
-void LogManager::LogInfo_Internal(const char* what, va_list args)
+// log how often the last message was suppressed
+void LogManager::FlushRepeatedMessages()
 {
-	mLock.Lock();
-
-	// skip the va list construction in case that the message won't be logged by any of the callbacks
-	if (CORE_LOGMANAGER.GetLogLevels() & LOGLEVEL_INFO)
-	{
-		mVarArgBuffer.Clear();
-
-		vsprintf(mVarArgBuffer.AsChar(), what, args);
-		va_end(args);
+	// NOTE: thread lock _MUST_ be handled in the calling function.
+	if (mNumRepeats == 0)
+		return;
 
-		// log the message
-		CORE_LOGMANAGER.LogMessage( mVarArgBuffer.AsChar(), LOGLEVEL_INFO );
-	}
+	mVarArgBuffer.Format("Last message repeated %u times.", mNumRepeats);
+	DispatchMessage( Time::Now(), mVarArgBuffer.AsChar(), mLastLogLevel );
 
-	mLock.Unlock();
+	mNumRepeats = 0;
 }
 
 
-void LogManager::LogDetailedInfo_Internal(const char* what, va_list args)
+// format and log a message (or queue it in async mode)
+void LogManager::Log_Internal(const char* what, va_list args, ELogLevel logLevel)
 {
-	mLock.Lock();
-
 	// skip the va list construction in case that the message won't be logged by any of the callbacks
-	if (CORE_LOGMANAGER.GetLogLevels() & LOGLEVEL_DETAILEDINFO)
+	if ((GetLogLevels() & logLevel) == 0)
 	{
-		mVarArgBuffer.Clear();
-		
-		vsprintf(mVarArgBuffer.AsChar(), what, args);
 		va_end(args);
-
-		// log the message
-		CORE_LOGMANAGER.LogMessage( mVarArgBuffer.AsChar(), LOGLEVEL_DETAILEDINFO );
+		return;
 	}
 
-	mLock.Unlock();
-}
+	// async mode: format the message into a queue cell, the log thread does the rest
+	// NOTE: the arguments can't be kept for later formatting, strings passed with %s may not outlive this call
+	if (IsAsyncEnabled() == true)
+	{
+		uint32 position;
+		LogRecord* record = mQueue->BeginPush(&position);
+		if (record != NULL)
+		{
+			vsnprintf(record->mText, sizeof(record->mText), what, args);
+			record->mLogLevel = logLevel;
+			record->mTime = Time::Now();
+			mQueue->EndPush(position);
+
+			// async mode was disabled while the message was pushed: the log thread and the final flush may both be gone already
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (IsAsyncEnabled() == false)
+			{
+				mLock.Lock();
+				ProcessQueue();
+				FlushRepeatedMessages();
+				mLock.Unlock();
+			}
+		}
 
+		va_end(args);
+		return;
+	}
 
-void LogManager::LogDebug_Internal(const char* what, va_list args)
-{
 	mLock.Lock();
 
-	// skip the va list construction in case that the message won't be logged by any of the callbacks
-	if (CORE_LOGMANAGER.GetLogLevels() & LOGLEVEL_DEBUG)
-	{
-		mVarArgBuffer.Clear();
+	mVarArgBuffer.Clear();
 
-		vsprintf(mVarArgBuffer.AsChar(), what, args);
-		va_end(args);
+	// construct the final log line
+	vsprintf(mVarArgBuffer.AsChar(), what, args);
+	va_end(args);
 
-		// log the message
-		CORE_LOGMANAGER.LogMessage( mVarArgBuffer.AsChar(), LOGLEVEL_DEBUG );
-	}
+	// log the message
+	LogMessage( mVarArgBuffer.AsChar(), logLevel );
 
 	mLock.Unlock();
 }
 
+
+void LogManager::LogCritical_Internal(const char* what, va_list args)			{ Log_Internal(what, args, LOGLEVEL_CRITICAL); }
+void LogManager::LogError_Internal(const char* what, va_list args)				{ Log_Internal(what, args, LOGLEVEL_ERROR); }
+void LogManager::LogWarning_Internal(const char* what, va_list args)			{ Log_Internal(what, args, LOGLEVEL_WARNING); }
+void LogManager::LogInfo_Internal(const char* what, va_list args)				{ Log_Internal(what, args, LOGLEVEL_INFO); }
+void LogManager::LogDetailedInfo_Internal(const char* what, va_list args)		{ Log_Internal(what, args, LOGLEVEL_DETAILEDINFO); }
+void LogManager::LogDebug_Internal(const char* what, va_list args)				{ Log_Internal(what, args, LOGLEVEL_DEBUG); }
+
 void ENGINE_API LogCritical(const char* what, ...)						{ va_list args; va_start(args, what); CORE_LOGMANAGER.LogCritical_Internal(what, args);}
 void ENGINE_API LogError(const char* what, ...)							{ va_list args; va_start(args, what); CORE_LOGMANAGER.LogError_Internal(what, args);}
 void ENGINE_API LogWarning(const char* what, ...)						{ va_list args; va_start(args, what); CORE_LOGMANAGER.LogWarning_Internal(what, args);}
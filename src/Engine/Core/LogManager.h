@@ -29,12 +29,18 @@
 #include "Array.h"
 #include "String.h"
 #include "Mutex.h"
+#include "Time.h"
 #include "LogCallbacks.h"
+#include <atomic>
 
 
 namespace Core
 {
 
+// forward declarations
+class Thread;
+class LogRecordQueue;
+
 class ENGINE_API LogManager
 {
 	public:
@@ -62,6 +68,14 @@ class ENGINE_API LogManager
 
 		void LogMessage(const char* message, ELogLevel logLevel=LOGLEVEL_INFO);
 
+		// asynchronous mode: the calling thread only formats the message and pushes it into a lock-free queue, a background thread adds the
+		// timestamp and calls the log callbacks. Repeated messages are collapsed; if the queue is full, messages are dropped and counted.
+		void SetAsyncEnabled(bool enable);
+		bool IsAsyncEnabled() const																	{ return mIsAsync.load(std::memory_order_relaxed); }
+
+		// process all queued messages now
+		void Flush();
+
 		void LogCritical_Internal(const char* what, va_list args);
 		void LogError_Internal(const char* what, va_list args);
 		void LogWarning_Internal(const char* what, va_list args);
@@ -70,9 +84,28 @@ class ENGINE_API LogManager
 		void LogDebug_Internal(const char* what, va_list args);
 
 	private:
+		void Log_Internal(const char* what, va_list args, ELogLevel logLevel);
+		void DispatchMessage(const Time& time, const char* message, ELogLevel logLevel);
+
+		// async mode (called with mLock held)
+		void ProcessQueue();
+		void FlushRepeatedMessages();
+
+		class LogThreadHandler;
+
 		String					mLineFormattingBuffer;
 		String					mVarArgBuffer;
 
+		std::atomic<bool>		mIsAsync;
+		LogRecordQueue*			mQueue;						// created on first use, lives until destruction (producers may still hold it)
+		Thread*					mThread;
+
+		// collapsing of repeated messages
+		String					mLastMessage;
+		ELogLevel				mLastLogLevel;
+		uint32					mNumRepeats;				// number of suppressed repetitions of the last message
+		Time					mFirstRepeatTime;
+
 		Array<LogCallback*>		mLogCallbacks;
 		Array<LogLevelPreset>	mLogPresets;
 		uint32					mActiveLogPresetIndex;
@@ -749,6 +749,23 @@ String& String::Join(const Array<String>& array, String separator,  String& resu
 }
 
 
+// calculate the 32 bit FNV-1a hash of a string (NULL is treated like an empty string)
+uint32 String::CalcHash(const char* text)
+{
+	uint32 hash = 2166136261u;
+	if (text == NULL)
+		return hash;
+
+	for (const unsigned char* c = (const unsigned char*)text; *c != '\0'; ++c)
+	{
+		hash ^= *c;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+
 // returns true if this string is equal to the given other string (case sensitive)
 bool String::IsEqual(const char* other) const
 {
@@ -67,6 +67,10 @@ class ENGINE_API String
 		// static version
 		static uint32 CalcLength(const char* text)								{ return (uint32)strlen(text); }
 
+		// string hash (FNV-1a), e.g. for name lookups that only compare strings with a matching hash
+		static uint32 CalcHash(const char* text);
+		uint32 CalcHash() const													{ return CalcHash(mData); }
+
 		// conversion string -> other
 		void FromInt(int32 value);
 		void FromFloat(float value);
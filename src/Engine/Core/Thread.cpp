@@ -28,6 +28,17 @@
 #include "Thread.h"
 #include "LogManager.h"
 
+#ifndef NEUROMORE_PLATFORM_WINDOWS
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+#ifdef NEUROMORE_PLATFORM_LINUX
+	#include <sys/resource.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
 
 namespace Core
 {
@@ -107,4 +118,34 @@ void Thread::Sleep(double milliseconds)
 	std::this_thread::sleep_for(sleepDuration);
 }
 
+
+// raise the scheduling priority of the calling thread
+bool Thread::SetCurrentThreadHighPriority()
+{
+#ifdef NEUROMORE_PLATFORM_WINDOWS
+	if (SetThreadPriority( GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL ) == 0)
+	{
+		LogWarning("Thread::SetCurrentThreadHighPriority(): Failed to raise the thread priority.");
+		return false;
+	}
+	return true;
+#else
+	// try a real-time policy first (needs permissions on most systems)
+	sched_param param;
+	param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 1;
+	if (pthread_setschedparam( pthread_self(), SCHED_FIFO, &param ) == 0)
+		return true;
+
+#ifdef NEUROMORE_PLATFORM_LINUX
+	// fall back to a lower nice value of the thread (the static priority of the normal policy is always 0, so that can't be raised)
+	const pid_t threadId = (pid_t)syscall( SYS_gettid );
+	if (setpriority( PRIO_PROCESS, threadId, -10 ) == 0)
+		return true;
+#endif
+
+	LogWarning("Thread::SetCurrentThreadHighPriority(): Failed to raise the thread priority (missing permissions?).");
+	return false;
+#endif
+}
+
 } // namespace Core
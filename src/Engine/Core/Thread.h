@@ -50,6 +50,9 @@ class ENGINE_API Thread
 		// blocks the execution of the current thread for at least the specified time
 		static void Sleep(double milliseconds);
 
+		// raise the scheduling priority of the calling thread (real-time loops); returns false if the system denied it
+		static bool SetCurrentThreadHighPriority();
+
 	private:
 		std::thread*	mThread;
 		ThreadHandler*	mHandler;
@@ -0,0 +1,178 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include the required headers
+#include "WorkerPool.h"
+
+
+namespace Core
+{
+
+// thread handler of the worker threads
+class WorkerPool::WorkerThreadHandler : public ThreadHandler
+{
+	public:
+		WorkerThreadHandler(WorkerPool* pool) : mPool(pool)					{ mIsFinished = false; }
+
+		void Execute() override													{ mPool->ExecuteWorker(); mIsFinished = true; }
+		void Terminate() override												{ mPool->Terminate(); }
+
+	private:
+		WorkerPool*		mPool;
+};
+
+
+// constructor
+WorkerPool::WorkerPool(uint32 numWorkers, const char* name)
+{
+	mFunction			= NULL;
+	mNumTasks			= 0;
+	mNextTask			= 0;
+	mNumActiveWorkers	= 0;
+	mGeneration			= 0;
+	mTerminate			= false;
+	mIsBusy				= false;
+
+	mThreads.Reserve(numWorkers);
+	for (uint32 i=0; i<numWorkers; ++i)
+	{
+		Thread* thread = new Thread( new WorkerThreadHandler(this), name );
+		mThreads.Add(thread);
+		thread->Start();
+	}
+}
+
+
+// destructor
+WorkerPool::~WorkerPool()
+{
+	// stops and joins the threads
+	const uint32 numThreads = mThreads.Size();
+	for (uint32 i=0; i<numThreads; ++i)
+		delete mThreads[i];
+	mThreads.Clear();
+}
+
+
+// run a parallel loop
+void WorkerPool::ParallelFor(uint32 numTasks, const Function& function)
+{
+	if (numTasks == 0)
+		return;
+
+	// no workers, a single task or the pool is in use already (nested loop): run on the calling thread
+	bool expected = false;
+	if (mThreads.Size() == 0 || numTasks == 1 || mIsBusy.compare_exchange_strong(expected, true) == false)
+	{
+		for (uint32 i=0; i<numTasks; ++i)
+			function(i);
+		return;
+	}
+
+	// publish the loop and wake the workers
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mFunction = &function;
+		mNumTasks = numTasks;
+		mNextTask = 0;
+		mGeneration++;
+	}
+	mWakeCondition.notify_all();
+
+	// work on the tasks ourself
+	ExecuteTasks();
+
+	// all tasks are taken now, wait for the workers that are still busy with theirs (barrier)
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		mDoneCondition.wait(lock, [this]{ return mNumActiveWorkers == 0; });
+
+		// workers waking up late must not touch the loop anymore
+		mFunction = NULL;
+	}
+
+	mIsBusy = false;
+}
+
+
+// worker thread main loop
+void WorkerPool::ExecuteWorker()
+{
+	uint64 lastGeneration = 0;
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (true)
+	{
+		mWakeCondition.wait(lock, [&]{ return mTerminate == true || mGeneration != lastGeneration; });
+		if (mTerminate == true)
+			break;
+
+		lastGeneration = mGeneration;
+
+		// the loop has finished already
+		if (mFunction == NULL)
+			continue;
+
+		mNumActiveWorkers++;
+		lock.unlock();
+
+		ExecuteTasks();
+
+		lock.lock();
+		mNumActiveWorkers--;
+		if (mNumActiveWorkers == 0)
+			mDoneCondition.notify_all();
+	}
+}
+
+
+// execute tasks of the current loop until there are none left
+void WorkerPool::ExecuteTasks()
+{
+	const Function& function = *mFunction;
+	const uint32 numTasks = mNumTasks;
+
+	uint32 index = mNextTask.fetch_add(1);
+	while (index < numTasks)
+	{
+		function(index);
+		index = mNextTask.fetch_add(1);
+	}
+}
+
+
+// stop all workers
+void WorkerPool::Terminate()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mTerminate = true;
+	}
+	mWakeCondition.notify_all();
+}
+
+} // namespace Core
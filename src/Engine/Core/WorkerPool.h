@@ -0,0 +1,81 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __CORE_WORKERPOOL_H
+#define __CORE_WORKERPOOL_H
+
+// include standard headers
+#include "StandardHeaders.h"
+#include "Array.h"
+#include "Thread.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+
+namespace Core
+{
+
+// fixed set of worker threads that execute parallel loops together with the calling thread
+class ENGINE_API WorkerPool
+{
+	public:
+		typedef std::function<void(uint32 index)> Function;
+
+		// constructor & destructor
+		WorkerPool(uint32 numWorkers, const char* name);
+		~WorkerPool();
+
+		uint32 GetNumWorkers() const											{ return mThreads.Size(); }
+
+		// calls function(i) for all i in [0, numTasks) on the workers and the calling thread and returns after all calls have finished
+		// nested calls (from inside a task) and calls while another thread uses the pool are executed serially on the calling thread
+		void ParallelFor(uint32 numTasks, const Function& function);
+
+	private:
+		class WorkerThreadHandler;
+
+		void ExecuteWorker();
+		void ExecuteTasks();
+		void Terminate();
+
+		Core::Array<Thread*>		mThreads;
+
+		std::mutex					mMutex;
+		std::condition_variable		mWakeCondition;			// workers wait for a new loop
+		std::condition_variable		mDoneCondition;			// the calling thread waits for the workers to finish
+		const Function*				mFunction;				// the current loop body, NULL if there is none
+		uint32						mNumTasks;
+		std::atomic<uint32>			mNextTask;
+		uint32						mNumActiveWorkers;		// workers currently executing tasks of the loop
+		uint64						mGeneration;			// incremented for every loop
+		bool						mTerminate;
+		std::atomic<bool>			mIsBusy;
+};
+
+} // namespace Core
+
+
+#endif
@@ -26,6 +26,7 @@
 
 // include required files
 #include "Channel.h"
+#include "ChannelTimeIndex.h"
 #include "../Core/Time.h"
 
 
@@ -39,6 +40,7 @@ Channel<T>::Channel(double sampleRate, uint32 bufferSize) : ChannelBase(bufferSi
 
 	// initialize sample buffer
 	mSamples.AddEmpty();	// start with one chunk
+	mExternalSamples = NULL;
 
 	mBufferSize = 0;
 	SetBufferSize(bufferSize);
@@ -87,6 +89,20 @@ void Channel<T>::SetBufferSize(uint32 numSamples, bool discard)
 {
 	LogTrace("SetBufferSize");
 
+	// views don't store samples, the buffer of the source is used
+	if (mViewSource != NULL)
+		return;
+
+	// leave the external buffer: continue with a copy of it in our own memory
+	if (mExternalSamples != NULL)
+	{
+		mSamples[0].Resize(mBufferSize);
+		for (uint32 i=0; i<mBufferSize; ++i)
+			mSamples[0][i] = mExternalSamples[i];
+
+		mExternalSamples = NULL;
+	}
+
 	// resize only if the channel is configured as a buffer - and only shrink it, if samples do not get lost
 	// storage channel: initialize first chunk (size = 1 minute and no less than 100)
 	if (numSamples == 0)
@@ -94,7 +110,22 @@ void Channel<T>::SetBufferSize(uint32 numSamples, bool discard)
 		const uint32 chunkSize = CalcChunkSize();	
 		mSamples[0].Resize(chunkSize);
 	}
-	else 
+	else if (discard == false && mBufferSize != 0 && mNumSamples > 0 && numSamples != mBufferSize)
+	{
+		// buffer channel that keeps its samples: move the newest samples to their position in the resized circular buffer
+		LogDebug("resizing buffer from %i to %i (keeping samples)", mBufferSize, numSamples);
+
+		const uint32 numKept = Min(mNumSamples, numSamples);
+		Array<T> samples;
+		samples.Resize(numSamples);
+		for (uint64 i=mSampleCounter-numKept; i<mSampleCounter; ++i)
+			samples[(uint32)(i % numSamples)] = mSamples[0][(uint32)(i % mBufferSize)];
+
+		mSamples[0] = samples;
+		mNumSamples = numKept;
+		mNumNewSamples = Min(mNumNewSamples, numKept);
+	}
+	else
 	{
 		// buffer channel: use first 'chunk' as the buffers
 		if (numSamples > mSamples[0].Size())
@@ -105,11 +136,104 @@ void Channel<T>::SetBufferSize(uint32 numSamples, bool discard)
 	}
 
 	mBufferSize = numSamples;
+	mRequestedBufferSize = 0;
 	if (discard)
 		Clear();
 }
 
 
+// use external memory as circular buffer
+template<class T>
+void Channel<T>::SetExternalBuffer(T* samples, uint32 numSamples)
+{
+	if (samples == NULL)
+	{
+		// take over the buffer contents
+		SetBufferSize(mBufferSize, false);
+		return;
+	}
+
+	CORE_ASSERT(numSamples > 0);
+
+	mExternalSamples = samples;
+	mBufferSize = numSamples;
+	mRequestedBufferSize = 0;
+
+	// the own storage is not needed anymore
+	mSamples[0].Clear();
+
+	if (mNumSamples > mBufferSize)
+		mNumSamples = mBufferSize;
+	if (mNumNewSamples > mNumSamples)
+		mNumNewSamples = mNumSamples;
+}
+
+
+// share the samples of another channel
+template<class T>
+void Channel<T>::SetViewSource(Channel<T>* source)
+{
+	if (source == mViewSource)
+		return;
+
+	if (source == NULL)
+	{
+		ReleaseView();
+		return;
+	}
+
+	CORE_ASSERT(source != this);
+
+	AttachViewSource(source);
+
+	// the own storage is not needed anymore
+	mSamples.Clear();
+	mSamples.AddEmpty();
+	mExternalSamples = NULL;
+
+	// forward the metadata
+	SetName(source->GetName());
+	SetUnit(source->GetUnit());
+	SetMinValue(source->GetMinValue());
+	SetMaxValue(source->GetMaxValue());
+	SetColor(source->GetColor());
+	SetIndependent(source->IsIndependent());
+
+	// take over the counters, but start without new samples
+	SyncView(false);
+}
+
+
+// the view source is gone: continue as empty channel with own storage
+template<class T>
+void Channel<T>::ReleaseView()
+{
+	if (mViewSource == NULL)
+		return;
+
+	AttachViewSource(NULL);
+
+	const uint32 bufferSize = mBufferSize;
+	mBufferSize = 0;
+	SetBufferSize(bufferSize);
+}
+
+
+// advance the sample counters by samples that were written to the external buffer directly
+template<class T>
+void Channel<T>::AddExternalSamples(uint32 numSamples)
+{
+	CORE_ASSERT(mExternalSamples != NULL);
+
+	mNumNewSamples += numSamples;
+	mSampleCounter += numSamples;
+	mNumSamples = (uint32)Min<uint64>((uint64)mNumSamples + numSamples, mBufferSize);
+
+	// mark channel as active
+	SetAsActive();
+}
+
+
 // copy and add a sample to the Channel (do not use this if channel is a buffer)
 template<class T>
 void Channel<T>::AddSample(const T& value)
@@ -138,12 +262,47 @@ void Channel<double>::AddSample(const double& value)
 }
 
 
+// copy and add a sample with its timestamp
+template<class T>
+void Channel<T>::AddSample(const T& value, const Time& time)
+{
+	AddSample(value);
+	AddSampleTime(time);
+}
+
+
+// advance by the given number of samples but store only the last one
+template<class T>
+void Channel<T>::SkipSamples(uint32 numSamples, const T& lastValue)
+{
+	if (numSamples == 0)
+		return;
+
+	// storage channels allocate their samples on the way
+	CORE_ASSERT(IsBuffer() == true && HasTimeIndex() == false);
+
+	// the skipped samples count as available, like the ones of a buffer that was written before
+	mNumNewSamples += numSamples - 1;
+	mSampleCounter += numSamples - 1;
+	mNumSamples = (uint32)Min<uint64>((uint64)mNumSamples + numSamples - 1, mBufferSize);
+
+	AddSample(lastValue);
+}
+
+
 // clear the Channel 
 template<class T>
 void Channel<T>::Clear(bool deallocate)
 {
 	LogTrace("Clear");
 
+	// views don't own any samples: just sync with the source again
+	if (mViewSource != NULL)
+	{
+		SyncView(false);
+		return;
+	}
+
 	// dealloc samples only if channel is not a buffer
 	if (IsBuffer() == false)
 	{
@@ -153,11 +312,21 @@ void Channel<T>::Clear(bool deallocate)
 		const uint32 chunkSize = CalcChunkSize();;	
 		mSamples[0].Resize(chunkSize);
 	}
+	else if (deallocate == true && mExternalSamples == NULL)
+	{
+		// release the memory a larger buffer size left behind
+		mSamples[0].Resize(mBufferSize);
+		mSamples[0].Shrink();
+	}
 
 	mNumSamples	= 0;
 	mNumNewSamples = 0;
 	mSampleCounter = 0;
+	mRequestedBufferSize = 0;
 	mTimeSinceLastAddSample = 100; // marks channel as inactive
+
+	if (mTimeIndex != NULL)
+		mTimeIndex->Clear();
 }
 
 
@@ -166,6 +335,9 @@ void Channel<T>::Clear(bool deallocate)
 template<class T>
 T* Channel<T>::GetNextSampleRef()	
 { 
+	// views are read-only
+	CORE_ASSERT(mViewSource == NULL);
+
 	// grow storage channel by adding chunks
 	if (IsBuffer() == false)
 	{
@@ -203,6 +375,10 @@ T* Channel<T>::GetNextSampleRef()
 template<class T>
 const T& Channel<T>::GetSample(uint64 index) const
 {
+	// read through to the source of the view
+	if (mViewSource != NULL)
+		return static_cast<const Channel<T>*>(mViewSource)->GetSample(index);
+
 	if (IsBuffer() == true)
 	{
 		// make sure the buffer actually has this sample available
@@ -216,6 +392,9 @@ const T& Channel<T>::GetSample(uint64 index) const
 		
 		LogDebugRT("accessing sample reference %i (array index %i)", index, arrIndex);
 
+		if (mExternalSamples != NULL)
+			return mExternalSamples[arrIndex];
+
 		return mSamples[0][arrIndex];
 	}
 	else
@@ -236,6 +415,41 @@ const T& Channel<T>::GetSample(uint64 index) const
 }
 
 
+// direct read access to a contiguous run of samples
+template<class T>
+uint32 Channel<T>::GetContiguousSamples(uint64 index, uint32 maxNumSamples, const T** outSamples) const
+{
+	// read through to the source of the view
+	if (mViewSource != NULL)
+		return static_cast<const Channel<T>*>(mViewSource)->GetContiguousSamples(index, maxNumSamples, outSamples);
+
+	uint64 numContiguous;
+	if (IsBuffer() == true)
+	{
+		// the run ends at the end of the circular buffer
+		const uint32 arrIndex = index % mBufferSize;
+		numContiguous = mBufferSize - arrIndex;
+
+		if (mExternalSamples != NULL)
+			*outSamples = mExternalSamples + arrIndex;
+		else
+			*outSamples = mSamples[0].GetPtr() + arrIndex;
+	}
+	else
+	{
+		// the run ends at the end of the chunk
+		const uint64 chunkSize = mSamples[0].Size();
+		const uint64 chunkIndex = index / chunkSize;
+		const uint64 sampleIndex = index % chunkSize;
+		numContiguous = chunkSize - sampleIndex;
+
+		*outSamples = mSamples[chunkIndex].GetPtr() + sampleIndex;
+	}
+
+	return (uint32)Min<uint64>(numContiguous, maxNumSamples);
+}
+
+
 // access samples by const ref
 template<class T>
 T* Channel<T>::GetSampleRef(uint64 index)
@@ -272,7 +486,7 @@ T* Channel<T>::GetLastSampleRef()
 
 // helpers
 template<class T>
-void Channel<T>::CalculateAverage(T* outAverage, uint64 minSampleIndex, uint64 maxSampleIndex)
+void Channel<T>::CalculateAverage(T* outAverage, uint64 minSampleIndex, uint64 maxSampleIndex) const
 {
 	// make sure we have at least one sample
 	if (GetNumSamples() == 0)
@@ -297,7 +511,7 @@ void Channel<T>::CalculateAverage(T* outAverage, uint64 minSampleIndex, uint64 m
 
 
 template<class T>
-void Channel<T>::CalculateMaximum(T* outMaximum, uint64 minSampleIndex, uint64 maxSampleIndex)
+void Channel<T>::CalculateMaximum(T* outMaximum, uint64 minSampleIndex, uint64 maxSampleIndex) const
 {
 	// make sure we have at least one sample
 	if (GetNumSamples() == 0)
@@ -319,7 +533,7 @@ void Channel<T>::CalculateMaximum(T* outMaximum, uint64 minSampleIndex, uint64 m
 
 
 template<class T>
-void Channel<T>::CalculateMinimum(T* outMinimum, uint64 minSampleIndex, uint64 maxSampleIndex)
+void Channel<T>::CalculateMinimum(T* outMinimum, uint64 minSampleIndex, uint64 maxSampleIndex) const
 {
 	// make sure we have at least one sample
 	if (GetNumSamples() == 0)
@@ -341,7 +555,7 @@ void Channel<T>::CalculateMinimum(T* outMinimum, uint64 minSampleIndex, uint64 m
 
 
 template<>
-ENGINE_API void Channel<Spectrum>::CalculateAverage(Spectrum* outAverage, uint64 minSampleIndex, uint64 maxSampleIndex)
+ENGINE_API void Channel<Spectrum>::CalculateAverage(Spectrum* outAverage, uint64 minSampleIndex, uint64 maxSampleIndex) const
 {
 	// make sure we have at least one sample
 	if (GetNumSamples() == 0)
@@ -354,31 +568,31 @@ ENGINE_API void Channel<Spectrum>::CalculateAverage(Spectrum* outAverage, uint64
 		maxSampleIndex = GetMaxSampleIndex();
 
 	// get config
-	Spectrum* config = &mSamples[0][0];
+	const Spectrum* config = &GetSample(minSampleIndex);
 	const uint32 numBins = config->GetNumBins();
 
 	// resize output spectrum and set frequency range
 	outAverage->SetNumBins(numBins);
 	outAverage->SetMaxFrequency(config->GetMaxFrequency());
 
-	// calculate average of each bin individually
+	// calculate average of each bin individually (over the requested range, which can be shorter than the channel)
+	const uint64 numAveraged = maxSampleIndex - minSampleIndex + 1;
 	Complex binSum = 0;
 	for (uint32 b=0; b<numBins; ++b)
 	{
 		binSum = 0;
-		for (uint32 i = minSampleIndex; i <= maxSampleIndex; ++i)
+		for (uint64 i = minSampleIndex; i <= maxSampleIndex; ++i)
 			binSum += GetSample(i).GetBin(b);
 		
-		if (mNumSamples == 0)
-			outAverage->SetBin(b, 0);
-		else
-			outAverage->SetBin(b, binSum / mNumSamples);
+		outAverage->SetBin(b, binSum / (double)numAveraged);
 	}
+
+	outAverage->UpdateMagnitudes();
 }
 
 
 template<>
-void Channel<Spectrum>::CalculateMaximum(Spectrum* outMaximum, uint64 minSampleIndex, uint64 maxSampleIndex)
+void Channel<Spectrum>::CalculateMaximum(Spectrum* outMaximum, uint64 minSampleIndex, uint64 maxSampleIndex) const
 {
 	// NOT IMPLEMENTED
 	CORE_ASSERT(false);
@@ -386,7 +600,7 @@ void Channel<Spectrum>::CalculateMaximum(Spectrum* outMaximum, uint64 minSampleI
 
 
 template<>
-void Channel<Spectrum>::CalculateMinimum(Spectrum* outMinimum, uint64 minSampleIndex, uint64 maxSampleIndex)
+void Channel<Spectrum>::CalculateMinimum(Spectrum* outMinimum, uint64 minSampleIndex, uint64 maxSampleIndex) const
 {
 	// NOT IMPLEMENTED
 	CORE_ASSERT(false);
@@ -403,6 +617,9 @@ uint64 Channel<double>::CalculateMemoryAllocated(bool countBuffersOnly) const
 	for (uint32 i=0; i<mSamples.Size(); ++i)
 		numBytes += mSamples[i].Size() * sizeof(double);
 
+	if (mTimeIndex != NULL)
+		numBytes += mTimeIndex->CalculateMemoryAllocated();
+
 	return numBytes;
 }
 
@@ -413,6 +630,10 @@ uint64 Channel<double>::CalculateMemoryUsed(bool countBuffersOnly) const
 	if (countBuffersOnly == true && IsBuffer() == false)
 		return 0;
 
+	// the samples of a view are counted at the source
+	if (mViewSource != NULL)
+		return 0;
+
 	const uint64 numSamples = GetNumSamples();
 	const uint64 numBytes = numSamples * sizeof(double);
 
@@ -425,6 +646,10 @@ uint64 Channel<Spectrum>::CalculateMemoryUsed(bool countBuffersOnly) const
 {
     if (countBuffersOnly == true && IsBuffer() == false)
         return 0;
+
+    // the samples of a view are counted at the source
+    if (mViewSource != NULL)
+        return 0;
     
     uint64 numBytes = 0;
     
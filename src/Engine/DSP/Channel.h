@@ -62,6 +62,11 @@ class Channel : public ChannelBase
 
 		// use these for adding samples (both increase the sample counter)
 		void AddSample(const T& value);
+		void AddSample(const T& value, const Core::Time& time);			// also stores the timestamp, if the channel has a time index
+
+		// advance by the given number of samples but store only the last one; the other samples keep stale values, so only use this for buffers
+		// whose samples are not read (e.g. the intermediate outputs of a fused chain, see ProcessorNode::UpdateFusedChain())
+		void SkipSamples(uint32 numSamples, const T& lastValue);
 		T* GetNextSampleRef();
 	
 		// clear channel
@@ -73,16 +78,30 @@ class Channel : public ChannelBase
 		const T& GetSample(uint64 index) const;
 		const T& GetLastSample() const;
 
+		// direct read access to the samples starting at the given index; returns the number of them that are contiguous in memory (at most maxNumSamples)
+		uint32 GetContiguousSamples(uint64 index, uint32 maxNumSamples, const T** outSamples) const;
+
 		// direct memory access (no circular adressing!)
 		// NOTE this only enables access to the first array chunk;
 		const T& operator[](const uint64 index)							{ return mSamples[0][index]; }
 		Core::Array<T>& GetRawArray()									{ return mSamples[0]; }
 		void ForceUpdateSampleCounters()								{ mSampleCounter = mSamples[0].Size(); mNumSamples = mSamples.Size(); mTimeSinceLastAddSample = 0;}
 
+		// use external memory as circular buffer, the channel doesn't own it (see MultiChannelBlock); the raw array above is not used in this case
+		// changing the buffer size of the channel itself moves the samples back to its own memory
+		void SetExternalBuffer(T* samples, uint32 numSamples);
+		T* GetExternalBuffer() const									{ return mExternalSamples; }
+
+		// advance the sample counters by samples that were written to the external buffer directly
+		void AddExternalSamples(uint32 numSamples);
+
+		// share the samples of another channel (read-only); takes over its metadata, which can be overridden afterwards; NULL releases the source
+		void SetViewSource(Channel<T>* source);
+
 		// helpers
-		void CalculateAverage(T* outAverage, uint64 minSampleIndex = 0, uint64 maxSampleIndex = CORE_UINT64_MAX);
-		void CalculateMaximum(T* outMaximum, uint64 minSampleIndex = 0, uint64 maxSampleIndex = CORE_UINT64_MAX);
-		void CalculateMinimum(T* outMinimum, uint64 minSampleIndex = 0, uint64 maxSampleIndex = CORE_UINT64_MAX);
+		void CalculateAverage(T* outAverage, uint64 minSampleIndex = 0, uint64 maxSampleIndex = CORE_UINT64_MAX) const;
+		void CalculateMaximum(T* outMaximum, uint64 minSampleIndex = 0, uint64 maxSampleIndex = CORE_UINT64_MAX) const;
+		void CalculateMinimum(T* outMinimum, uint64 minSampleIndex = 0, uint64 maxSampleIndex = CORE_UINT64_MAX) const;
 
 		static const T sZeroValue; 
 		static const T sMaxValue;
@@ -93,8 +112,11 @@ class Channel : public ChannelBase
 		uint64 CalculateMemoryUsed(bool countBuffersOnly = false) const override;
 
 	protected:
+		void ReleaseView() override;
+
 		// the sample storage arrays
 		Core::Array<Core::Array<T>>  mSamples;	 
+		T*							 mExternalSamples;		// circular buffer memory owned by someone else (NULL if the samples are stored in mSamples)
 };
 
 
@@ -26,6 +26,7 @@
 
 // include required files
 #include "ChannelBase.h"
+#include "ChannelTimeIndex.h"
 #include "../EngineManager.h"
 #include "../Core/Counter.h"
 #include "../Core/Time.h"
@@ -37,11 +38,15 @@ ChannelBase::ChannelBase(uint32 bufferSize)
 {
 	mID						= CORE_COUNTER.Next();
 	mBufferSize				= bufferSize;
+	mMaxBufferSize			= 0;
+	mRequestedBufferSize	= 0;
+	mHighWaterMark			= 0;
 
 	// ------------------------
 	
 	mSampleRate		= 0;
 	mIsIndependent  = false;
+	mIsObserved		= false;
 	mName			= "";
 	mSourceName		= "";
 	mMinValue		= 0;
@@ -56,12 +61,24 @@ ChannelBase::ChannelBase(uint32 bufferSize)
 	mLatency = 0;
 	mTimeSinceLastAddSample = 100; // marks channel as inactive
 	mIsHighlighted = false;
+	mTimeIndex = NULL;
+	mViewSource = NULL;
 }
 
 
 // destructor
 ChannelBase::~ChannelBase()
 {
+	if (mIsObserved == true && GetEngine() != NULL)
+		GetEngine()->OnChannelDestroyed(this);
+
+	// the views lose their samples
+	while (mViews.IsEmpty() == false)
+		mViews.GetLast()->ReleaseView();
+
+	AttachViewSource(NULL);
+
+	delete mTimeIndex;
 }
 
 void ChannelBase::Reset()
@@ -69,6 +86,13 @@ void ChannelBase::Reset()
 	LogTrace("Reset");
 
 	Clear();
+	mElapsedTime = 0;
+	mLatency = 0;
+
+	// views keep the counters and timing of their source (synced in Clear())
+	if (mViewSource != NULL)
+		return;
+
 	mNumSamples	= 0;
 	mNumNewSamples = 0;
 	mSampleCounter = 0;
@@ -132,6 +156,7 @@ void ChannelBase::RemoveLastSample()
 	LogTrace("RemoveLastSample");
 
 	// just to be safe
+	CORE_ASSERT(mViewSource == NULL);
 	CORE_ASSERT(mNumSamples > 0);
 	CORE_ASSERT(mSampleCounter > 0);
 	
@@ -140,6 +165,9 @@ void ChannelBase::RemoveLastSample()
 	mNumSamples--; 
 	mSampleCounter--;
 
+	if (mTimeIndex != NULL && mTimeIndex->Contains(mSampleCounter) == true)
+		mTimeIndex->RemoveLast();
+
 	// decrement only if there are new samples
 	if (mNumNewSamples > 0)
 		mNumNewSamples--; 
@@ -159,6 +187,11 @@ Time ChannelBase::GetDuration() const
 // timestamp of sample, where sample 0 falls on time mStartTime+1.0/samplerate (no sample at t=0)
 Time ChannelBase::GetSampleTime(uint64 sampleIndex) const
 { 
+	// use the stored timestamp if there is one
+	const ChannelTimeIndex* timeIndex = GetTimeIndex();
+	if (timeIndex != NULL && timeIndex->Contains(sampleIndex) == true)
+		return timeIndex->GetTime(sampleIndex);
+
 	if (mSampleRate == 0.0)
 		return Time(0.0);
 
@@ -169,6 +202,10 @@ Time ChannelBase::GetSampleTime(uint64 sampleIndex) const
 // the timestamp of the last sample in the channel
 Time ChannelBase::GetLastSampleTime() const
 { 
+	const ChannelTimeIndex* timeIndex = GetTimeIndex();
+	if (timeIndex != NULL && mSampleCounter > 0 && timeIndex->Contains(mSampleCounter - 1) == true)
+		return timeIndex->GetTime(mSampleCounter - 1);
+
 	if (mSampleRate == 0.0)
 		return Time(0.0);
 
@@ -199,11 +236,38 @@ void ChannelBase::UpdateLatency()
 }
 
 
+// a reader reports how many samples it still needs from the buffer
+void ChannelBase::UpdateHighWaterMark(uint32 numRequiredSamples)
+{
+	if (numRequiredSamples > mHighWaterMark)
+		mHighWaterMark = numRequiredSamples;
+
+	// views have no buffer of their own: the source has to keep the samples
+	if (mViewSource != NULL)
+	{
+		mViewSource->UpdateHighWaterMark(numRequiredSamples);
+		return;
+	}
+
+	// another burst like the last one would overwrite samples the reader still needs: request twice the space
+	const uint64 numExpectedSamples = (uint64)numRequiredSamples + mNumNewSamples;
+	if (mBufferSize != 0 && mMaxBufferSize > mBufferSize && numExpectedSamples > mBufferSize)
+	{
+		const uint32 requestedSize = (uint32)Min<uint64>( numExpectedSamples * 2, mMaxBufferSize );
+		mRequestedBufferSize = Max(mRequestedBufferSize, requestedSize);
+	}
+}
+
+
 void ChannelBase::SetStartTime(const Core::Time& time)								
 {
 	LogTrace("SetStartTime");
 	LogDebug("Channel::SetStartTime: set mStartTime = %f", time.InSeconds());
 
+	// views use the timing of their source
+	if (mViewSource != NULL)
+		return;
+
 	mStartTime = time;
 }
 
@@ -212,6 +276,11 @@ uint64 ChannelBase::FindIndexByTime(const Time& time, bool roundToClosest)
 {
 	uint64 index = CORE_INVALIDINDEX64;
 
+	// binary search in the stored timestamps (covers all samples of the channel, unless samples were added without time)
+	const ChannelTimeIndex* timeIndex = GetTimeIndex();
+	if (timeIndex != NULL && timeIndex->IsEmpty() == false)
+		return timeIndex->FindIndex(time, roundToClosest);
+
 	// handle the negative index case first
 	if (time < mStartTime)
 		return index;
@@ -244,6 +313,70 @@ uint64 ChannelBase::FindIndexByTime(const Time& time, bool roundToClosest)
 }
 
 
+// enable or disable the per-sample timestamps
+void ChannelBase::SetUseTimeIndex(bool enable)
+{
+	if (enable == HasTimeIndex())
+		return;
+
+	if (enable == true)
+		mTimeIndex = new ChannelTimeIndex();
+	else
+	{
+		delete mTimeIndex;
+		mTimeIndex = NULL;
+	}
+}
+
+
+// store the timestamp of the newest sample in the time index
+void ChannelBase::AddSampleTime(const Time& time)
+{
+	if (mTimeIndex == NULL || mSampleCounter == 0)
+		return;
+
+	mTimeIndex->Add(mSampleCounter - 1, time);
+
+	// circular buffer: forget the timestamps of the overwritten samples
+	if (IsBuffer() == true)
+		mTimeIndex->RemoveBefore(GetMinSampleIndex());
+}
+
+
+// register as view of the source channel (or unregister, if source is NULL)
+void ChannelBase::AttachViewSource(ChannelBase* source)
+{
+	if (mViewSource != NULL)
+		mViewSource->mViews.RemoveByValue(this);
+
+	mViewSource = source;
+
+	if (mViewSource != NULL)
+		mViewSource->mViews.Add(this);
+}
+
+
+// copy counters and timing from the view source
+void ChannelBase::SyncView(bool countNewSamples)
+{
+	CORE_ASSERT(mViewSource != NULL);
+
+	// the samples the source received since the last sync are new to our readers (unless the source was reset)
+	const uint64 sourceSampleCounter = mViewSource->mSampleCounter;
+	if (countNewSamples == true && sourceSampleCounter >= mSampleCounter)
+		mNumNewSamples += (uint32)(sourceSampleCounter - mSampleCounter);
+	else
+		mNumNewSamples = 0;
+
+	mSampleCounter			= sourceSampleCounter;
+	mNumSamples				= mViewSource->mNumSamples;
+	mBufferSize				= mViewSource->mBufferSize;
+	mSampleRate				= mViewSource->mSampleRate;
+	mStartTime				= mViewSource->mStartTime;
+	mTimeSinceLastAddSample = mViewSource->mTimeSinceLastAddSample;
+}
+
+
 // DEPRECATED
 // get sample closest to a given absolute time (this one supports negative time)
 uint32 ChannelBase::FindIndexByTime(double time, bool roundToClosest, bool clampResult)
@@ -29,11 +29,13 @@
 #include "../Core/StandardHeaders.h"
 #include "../Core/LogManager.h"
 #include "../Core/String.h"
+#include "../Core/Array.h"
 #include "../Core/Color.h"
 #include "../Core/Time.h"
 
 template <class T>
 class Channel;
+class ChannelTimeIndex;
 
 // channel base class used for all template instances
 class ENGINE_API ChannelBase
@@ -87,6 +89,11 @@ class ENGINE_API ChannelBase
 
 		// TODO deprecate this
 		uint32 FindIndexByTime(double time, bool roundToClosest = false, bool clampResult = true);
+
+		// per-sample timestamps for channels without fixed sample rate (disabled by default; samples are stamped by Channel::AddSample(value, time))
+		void SetUseTimeIndex(bool enable);
+		bool HasTimeIndex() const												{ return GetTimeIndex() != NULL; }
+		const ChannelTimeIndex* GetTimeIndex() const							{ return (mViewSource != NULL ? mViewSource->GetTimeIndex() : mTimeIndex); }
 		
 		// start and elapsed time of the channel
 		void SetElapsedTime(const Core::Time& time)								{ mElapsedTime = time; }
@@ -104,6 +111,16 @@ class ENGINE_API ChannelBase
 		virtual void SetBufferSize(uint32 numSamples, bool discard = true) = 0;
 		uint32 GetBufferSize() const											{ return mBufferSize; }
 
+		// adaptive buffer size: readers report how many samples they still need; if the next burst could overwrite them, the buffer asks for more space,
+		// which the producer applies (see MultiChannel::ApplyRequestedBufferSize) before it adds new samples
+		void UpdateHighWaterMark(uint32 numRequiredSamples);
+		uint32 GetHighWaterMark() const											{ return mHighWaterMark; }		// most samples a reader required since the last reset
+		void ResetHighWaterMark()												{ mHighWaterMark = 0; }
+		uint32 GetRequestedBufferSize() const									{ return mRequestedBufferSize; }
+		void ClearRequestedBufferSize()											{ mRequestedBufferSize = 0; }
+		void SetMaxBufferSize(uint32 numSamples)								{ mMaxBufferSize = numSamples; }	// limit for growing the buffer (0 = never grow)
+		uint32 GetMaxBufferSize() const											{ return mMaxBufferSize; }
+
 		virtual uint64 CalculateMemoryAllocated(bool countBuffersOnly = false) const = 0;
 		virtual uint64 CalculateMemoryUsed( bool countBuffersOnly = false) const = 0;
 
@@ -152,6 +169,19 @@ class ENGINE_API ChannelBase
 		void SetIsHighlighted(bool enabled)										{ mIsHighlighted = enabled; }
 		bool IsHighlighted() const												{ return mIsHighlighted; }
 
+		// channel views: a view shares the samples, counters and timing of its source channel instead of storing copies of the samples;
+		// only the metadata (name, color, source name, ...) belongs to the view. Set the source with Channel::SetViewSource().
+		bool IsView() const														{ return mViewSource != NULL; }
+		ChannelBase* GetViewSource() const										{ return mViewSource; }
+		uint32 GetNumViews() const												{ return mViews.Size(); }
+
+		// take over the samples the source received since the last call (use this instead of adding samples); without counting them, the view only follows the source
+		void UpdateView(bool countNewSamples = true)							{ SyncView(countNewSamples); }
+
+		// engine services keep references to the channel (e.g. snapshots or shared spectrum analyzers); the engine gets notified when the channel is destroyed
+		void SetIsObserved(bool enabled = true)									{ mIsObserved = enabled; }
+		bool IsObserved() const													{ return mIsObserved; }
+
 	protected:
 		double		mSampleRate;						// if > 0 we assume the channel's samples have fixed sample rate
 		Core::Time	mStartTime;							// time of the first sample
@@ -161,7 +191,26 @@ class ENGINE_API ChannelBase
 		uint32		mNumNewSamples;						// number of samples added during the last update
 		uint64		mSampleCounter;						// added samples since last call of Clear();
 		uint32		mBufferSize;						// the maximum number of samples this channel holds; 0 in case circular buffer is disabled
+		uint32		mMaxBufferSize;						// the buffer may grow up to this size if readers fall behind (0 = no growth)
+		uint32		mRequestedBufferSize;				// buffer size requested by a lagging reader (0 = no request)
+		uint32		mHighWaterMark;						// maximum number of samples a reader required
 		double		mTimeSinceLastAddSample;			// activity-detection
+		ChannelTimeIndex* mTimeIndex;					// timestamps of the samples (optional, NULL if disabled)
+
+		ChannelBase*		mViewSource;				// channel that holds the samples of this view (NULL if the channel stores its own samples)
+		Core::Array<ChannelBase*> mViews;				// views that share the samples of this channel
+
+		// store the timestamp of the newest sample in the time index
+		void AddSampleTime(const Core::Time& time);
+
+		// register as view of the source channel (or unregister, if source is NULL)
+		void AttachViewSource(ChannelBase* source);
+
+		// copy counters and timing from the view source; counts the samples added since the last sync as new samples, if requested
+		void SyncView(bool countNewSamples);
+
+		// the view source was destroyed: store samples in the channel itself again
+		virtual void ReleaseView() = 0;
 
 	private:
 		// channel properties
@@ -174,6 +223,7 @@ class ENGINE_API ChannelBase
 		Core::Color			mColor;						// the color of this channel
 		bool				mIsHighlighted;				// highlight flag for visually highlighting the channel everywhere it is used
 		bool				mIsIndependent;				// if channel is synced to engine or running independently
+		bool				mIsObserved;				// if engine services keep references to the channel
 };
 
 
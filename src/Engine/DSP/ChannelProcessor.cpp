@@ -27,6 +27,7 @@
 // include required files
 #include "ChannelProcessor.h"
 #include "Channel.h"
+#include "Spectrum.h"
 #include "../Core/LogManager.h"
 
 
@@ -35,6 +36,7 @@ using namespace Core;
 // constructor
 ChannelProcessor::ChannelProcessor()
 {
+	mNumChannels = 1;
 }
 
 
@@ -137,3 +139,48 @@ void ChannelProcessor::RemoveDelegateInputReader(uint32 index)
 	mInputs[index] = new ChannelReader();
 	mIsOwnInputReader[index] = true;
 }
+
+
+// replicate the inputs and outputs of the first channel
+void ChannelProcessor::SetNumChannels(uint32 numChannels)
+{
+	CORE_ASSERT(IsMultiChannel() == true);
+	CORE_ASSERT(numChannels > 0);
+
+	if (numChannels == mNumChannels)
+		return;
+
+	const uint32 numInputPorts = GetNumInputPorts();
+	const uint32 numOutputPorts = GetNumOutputPorts();
+
+	// remove all but the first channel
+	for (uint32 i = numInputPorts; i < mInputs.Size(); ++i)
+		if (mIsOwnInputReader[i] == true)
+			delete mInputs[i];
+	mInputs.Resize(numInputPorts);
+	mIsOwnInputReader.Resize(numInputPorts);
+
+	for (uint32 i = numOutputPorts; i < mOutputs.Size(); ++i)
+		delete mOutputs[i];
+	mOutputs.Resize(numOutputPorts);
+
+	// add the inputs and outputs of the other channels (same types as the first channel)
+	for (uint32 c = 1; c < numChannels; ++c)
+	{
+		for (uint32 i = 0; i < numInputPorts; ++i)
+		{
+			mInputs.Add(new ChannelReader());
+			mIsOwnInputReader.Add(true);
+		}
+
+		for (uint32 i = 0; i < numOutputPorts; ++i)
+		{
+			if (mOutputs[i]->GetType() == Channel<Spectrum>::TYPE_ID)
+				mOutputs.Add(new Channel<Spectrum>(0,123));
+			else
+				mOutputs.Add(new Channel<double>(0,123));
+		}
+	}
+
+	mNumChannels = numChannels;
+}
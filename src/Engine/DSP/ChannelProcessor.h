@@ -106,6 +106,36 @@ class ENGINE_API ChannelProcessor
 		// number of samples the input will read at once
 		virtual uint32 GetNumEpochSamples(uint32 inputPortIndex) const							{ return 1; }
 
+		//
+		// element-wise block kernel (used for fusing chains of processors, see Classifier::FuseElementwiseChains())
+		//
+
+		// index of the only input the output samples depend on (one output sample per input sample), or CORE_INVALIDINDEX32 if the processor is not element-wise in its current configuration
+		virtual uint32 GetElementwiseInputIndex() const											{ return CORE_INVALIDINDEX32; }
+
+		// process a block of input samples in place, exactly like Update() would do it sample by sample
+		virtual void ProcessBlock(double* samples, uint32 numSamples)							{}
+
+		//
+		// Multi-channel processing
+		//
+
+		// multi-channel processors handle all channels of a node in one instance (instead of one processor clone per channel)
+		virtual bool IsMultiChannel() const														{ return false; }
+
+		// replicate the inputs and outputs for the given number of channels (multi-channel processors only, call before connecting the inputs)
+		void SetNumChannels(uint32 numChannels);
+		uint32 GetNumChannels() const															{ return mNumChannels; }
+
+		// number of inputs/outputs per channel
+		uint32 GetNumInputPorts() const															{ return mInputs.Size() / mNumChannels; }
+		uint32 GetNumOutputPorts() const														{ return mOutputs.Size() / mNumChannels; }
+
+		// channel-aware accessors: the inputs/outputs are stored channel by channel, so channel 0 is the same as the single-channel accessors
+		ChannelBase* GetInput(uint32 port, uint32 channel) const								{ return GetInput(channel * GetNumInputPorts() + port); }
+		ChannelReader* GetInputReader(uint32 port, uint32 channel) const						{ return mInputs[channel * GetNumInputPorts() + port]; }
+		ChannelBase* GetOutput(uint32 port, uint32 channel) const								{ return mOutputs[channel * GetNumOutputPorts() + port]; }
+
 
 	protected: 
 		template <class T> void AddInput()														{ mInputs.Add(new ChannelReader()); mIsOwnInputReader.Add(true);}
@@ -115,6 +145,7 @@ class ENGINE_API ChannelProcessor
 		
 	private:
 		Settings					mProcessorSettings;
+		uint32						mNumChannels;
 
 		// Inputs and owner flags
 		Core::Array<ChannelReader*>	mInputs;
@@ -191,8 +191,8 @@ void ChannelReader::Update()
 			const Time interval = newestSampleTime - mStartTime;
 			uint64 numSamples = interval.InSeconds() * mChannel->GetSampleRate();
 
-			// clamp to maximum available samples
-			numSamples = Min(numSamples, mChannel->GetSampleCounter());
+			// clamp to maximum available samples (a view can start with the full history of its source)
+			numSamples = Min(numSamples, mChannel->GetNumSamples());
 
 			// init counters
 			mNumNewSamples = numSamples;
@@ -221,6 +221,18 @@ void ChannelReader::Update()
 	mNumNewSamples += numNewSamples;
 	mNumSamplesReceived += mNumNewSamples;
 
+	// report how many samples we still need (unread samples plus the overlap of the epochs), so the buffer can grow if we fall behind
+	const uint64 numOverlapSamples = (mEpochLength > mEpochShift ? mEpochLength - mEpochShift : 0);
+	mChannel->UpdateHighWaterMark( (uint32)Min<uint64>(mNumNewSamples + numOverlapSamples, CORE_INT32_MAX) );
+
+	// the buffer overflowed while we were stalled: the oldest unread samples are overwritten, skip them (the high-water mark above already requested a larger buffer)
+	if (IsOutOfBounds() == true)
+	{
+		const uint64 numLostSamples = mNumNewSamples - mChannel->GetNumSamples();
+		LogWarning("Channel reader lost %u samples of channel '%s', the buffer holds only %u samples", (uint32)numLostSamples, mChannel->GetName(), (uint32)mChannel->GetNumSamples());
+		Advance(numLostSamples);
+	}
+
 	//if (mHasStarted == false)
 	//{
 	//	// check if the channel has reached the requested start time yet 
@@ -239,22 +251,6 @@ void ChannelReader::Update()
 	//	}
 	//}
 
-	//const uint32 numSamplesAvailable = mChannel->GetNumSamples();
-	//bool overflow = false;
-	//while (mNumNewSamples > numSamplesAvailable)
-	//{
-	//	// NOTE this should not happen if everything is handled right by the node that uses it
-	//	overflow = true;
-	//	
-	//	// remove oldest sample
-	//	mNumNewSamples--;
-	//	mLastSampleCounter++;
-	//	mNumSamplesProcessed++;
-	//}
-
-	//if (overflow == true)
-	//	LogDebug("channel buffer limit reached! counter indiciates %i samples, channel has %i", mNumNewSamples, numSamplesAvailable);
-
 }
 
 
@@ -0,0 +1,202 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required files
+#include "ChannelSnapshot.h"
+#include "../EngineManager.h"
+
+
+using namespace Core;
+
+// constructor
+ChannelSnapshot::ChannelSnapshot(Channel<double>* source, uint32 numSamples)
+{
+	mSource				= source;
+	mSourceChannelID	= source->GetID();
+	mNumSamples			= Max<uint32>(numSamples, 1);
+	mVersion			= 0;
+
+	for (uint32 i=0; i<NUMSLOTS; ++i)
+	{
+		mSlots[i]			= new Slot(mNumSamples);
+		mSlotVersions[i]	= 0;
+	}
+
+	mWriteIndex		= 0;
+	mSharedIndex	= 1;
+	mReadIndex		= 2;
+
+	// make the current samples available right away
+	Publish();
+}
+
+
+// destructor
+ChannelSnapshot::~ChannelSnapshot()
+{
+	for (uint32 i=0; i<NUMSLOTS; ++i)
+		delete mSlots[i];
+}
+
+
+// copy the new samples of the source channel and make them available to the reader
+void ChannelSnapshot::Publish()
+{
+	Channel<double>* source = mSource.load();
+	if (source == NULL)
+		return;
+
+	mSlots[mWriteIndex]->Mirror(source);
+	mSlotVersions[mWriteIndex] = ++mVersion;
+
+	// hand the slot over and continue with the one the reader gave back (or the one it never acquired)
+	const uint32 previous = mSharedIndex.exchange( mWriteIndex | NEWDATA, std::memory_order_acq_rel );
+	mWriteIndex = previous & SLOTMASK;
+}
+
+
+// get the latest published version
+Channel<double>* ChannelSnapshot::Acquire()
+{
+	if ((mSharedIndex.load(std::memory_order_relaxed) & NEWDATA) != 0)
+	{
+		const uint32 previous = mSharedIndex.exchange( mReadIndex, std::memory_order_acq_rel );
+		mReadIndex = previous & SLOTMASK;
+	}
+
+	return mSlots[mReadIndex];
+}
+
+
+// copy the properties and the new samples of the source channel
+void ChannelSnapshot::Slot::Mirror(Channel<double>* source)
+{
+	// source was cleared or restarted: start over
+	if (source->GetSampleCounter() < mSampleCounter || source->GetStartTime() != mStartTime || source->GetSampleRate() != mSampleRate)
+		Clear();
+
+	// properties used for rendering
+	if (GetNameString().IsEqual(source->GetName()) == false)
+		SetName(source->GetName());
+	SetSampleRate(source->GetSampleRate());
+	SetMinValue(source->GetMinValue());
+	SetMaxValue(source->GetMaxValue());
+	SetColor(source->GetColor());
+	SetIsHighlighted(source->IsHighlighted());
+	SetStartTime(source->GetStartTime());
+	SetElapsedTime(source->GetElapsedTime());
+	mLatency = source->GetLatency();
+	mTimeSinceLastAddSample = (source->IsActive() == true ? 0 : 100);
+
+	if (source->IsEmpty() == true)
+		return;
+
+	const uint64 endIndex = source->GetSampleCounter();
+
+	// only the last window of samples is needed; skip the samples that would be overwritten anyway
+	uint64 firstIndex = mSampleCounter;
+	if (endIndex - firstIndex > mBufferSize)
+		firstIndex = endIndex - mBufferSize;
+
+	// the samples we are missing are no longer available: continue behind the gap
+	const uint64 minSourceIndex = source->GetMinSampleIndex();
+	if (firstIndex < minSourceIndex)
+		firstIndex = minSourceIndex;
+
+	if (firstIndex > mSampleCounter)
+	{
+		mSampleCounter	= firstIndex;
+		mNumSamples		= 0;
+	}
+
+	BeginAddSamples();
+	for (uint64 i=firstIndex; i<endIndex; ++i)
+		AddSample( source->GetSample(i) );
+}
+
+
+// start collecting the snapshots of a new frame
+void ChannelSnapshotSet::Begin()
+{
+	// snapshots of the last frame that were not handed out in End() get destroyed there
+	mOldSnapshots.Add(mSnapshots);
+	mSnapshots.Clear(false);
+}
+
+
+// get a snapshot that covers the given time range of the channel
+ChannelSnapshot* ChannelSnapshotSet::Add(Channel<double>* channel, double timeRange)
+{
+	uint32 numSamples = channel->GetBufferSize();
+	if (channel->GetSampleRate() > 0)
+		numSamples = (uint32)Math::CeilD(timeRange * channel->GetSampleRate()) + 2;
+	numSamples = Max<uint32>(numSamples, 2);
+
+	// reuse the snapshot from the last frame (recreate it if the time range was changed)
+	ChannelSnapshot* snapshot = NULL;
+	const uint32 numOldSnapshots = mOldSnapshots.Size();
+	for (uint32 i=0; i<numOldSnapshots; ++i)
+	{
+		if (mOldSnapshots[i]->GetSource() == channel && mOldSnapshots[i]->GetNumSamples() == numSamples)
+		{
+			snapshot = mOldSnapshots[i];
+			mOldSnapshots.Remove(i);
+			break;
+		}
+	}
+
+	if (snapshot == NULL)
+	{
+		snapshot = new ChannelSnapshot(channel, numSamples);
+		GetEngine()->AddChannelSnapshot(snapshot);
+	}
+
+	mSnapshots.Add(snapshot);
+	return snapshot;
+}
+
+
+// get rid of the snapshots of channels that are not displayed anymore
+void ChannelSnapshotSet::End()
+{
+	const uint32 numOldSnapshots = mOldSnapshots.Size();
+	for (uint32 i=0; i<numOldSnapshots; ++i)
+	{
+		GetEngine()->RemoveChannelSnapshot(mOldSnapshots[i]);
+		delete mOldSnapshots[i];
+	}
+
+	mOldSnapshots.Clear(false);
+}
+
+
+// destroy all snapshots
+void ChannelSnapshotSet::Clear()
+{
+	Begin();
+	End();
+}
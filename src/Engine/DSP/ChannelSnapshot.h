@@ -0,0 +1,123 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_CHANNELSNAPSHOT_H
+#define __NEUROMORE_CHANNELSNAPSHOT_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "Channel.h"
+#include <atomic>
+
+
+// Versioned read-only copy of the last samples of a channel, for reading channel data from another thread without locking the engine (e.g. rendering).
+// The engine thread publishes a new version after each update (see EngineManager::AddChannelSnapshot()), the reader thread acquires the latest published
+// version. Both sides work on their own copy (triple buffering), so neither of them ever waits for the other one.
+// The copies keep the sample indices and timestamps of the source channel.
+class ENGINE_API ChannelSnapshot
+{
+	public:
+		// constructor & destructor
+		ChannelSnapshot(Channel<double>* source, uint32 numSamples);
+		virtual ~ChannelSnapshot();
+
+		//
+		// writer side (engine thread, engine has to be locked)
+		//
+
+		// copy the new samples of the source channel and make them available to the reader
+		void Publish();
+
+		// the source channel was destroyed: stop publishing (the last version stays readable)
+		void Detach()															{ mSource.store(NULL); }
+		bool IsDetached() const													{ return mSource.load() == NULL; }
+
+		Channel<double>* GetSource() const										{ return mSource.load(); }
+
+		//
+		// reader side (one thread only)
+		//
+
+		// get the latest published version (the channel stays valid and unchanged until the next call)
+		Channel<double>* Acquire();
+
+		// version number of the acquired channel (increases with each publish)
+		uint32 GetVersion() const												{ return mSlotVersions[mReadIndex]; }
+
+		// ID of the source channel (the copies have their own IDs)
+		uint32 GetSourceChannelID() const										{ return mSourceChannelID; }
+		uint32 GetNumSamples() const											{ return mNumSamples; }
+
+	private:
+		// channel that mirrors the sample window of the source
+		class Slot : public Channel<double>
+		{
+			public:
+				Slot(uint32 numSamples) : Channel<double>(0, numSamples)		{}
+				void Mirror(Channel<double>* source);
+		};
+
+		enum { NUMSLOTS = 3, SLOTMASK = 3, NEWDATA = 4 };
+
+		std::atomic<Channel<double>*>	mSource;
+		uint32							mSourceChannelID;
+		uint32							mNumSamples;
+
+		Slot*							mSlots[NUMSLOTS];
+		uint32							mSlotVersions[NUMSLOTS];
+		uint32							mVersion;
+
+		uint32							mWriteIndex;		// owned by the writer
+		uint32							mReadIndex;			// owned by the reader
+		std::atomic<uint32>				mSharedIndex;		// slot that is passed between them (| NEWDATA if it was not acquired yet)
+};
+
+
+// The snapshots a reader uses for one frame. Collect them while the engine is locked: Begin(), Add() for each displayed channel, End().
+// Snapshots of the last frame are reused, the ones that were not added again get destroyed.
+class ENGINE_API ChannelSnapshotSet
+{
+	public:
+		ChannelSnapshotSet()													{}
+		~ChannelSnapshotSet()													{ Clear(); }
+
+		void Begin();
+		// get a snapshot that covers the given time range of the channel
+		ChannelSnapshot* Add(Channel<double>* channel, double timeRange);
+		void End();
+
+		// destroy all snapshots
+		void Clear();
+
+		uint32 Size() const														{ return mSnapshots.Size(); }
+		ChannelSnapshot* Get(uint32 index) const								{ return mSnapshots[index]; }
+
+	private:
+		Core::Array<ChannelSnapshot*>	mSnapshots;
+		Core::Array<ChannelSnapshot*>	mOldSnapshots;		// the snapshots of the last frame that were not added again yet
+};
+
+
+#endif
@@ -0,0 +1,258 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "ChannelTimeIndex.h"
+
+
+using namespace Core;
+
+// maximum number of samples per block
+static const uint64 gMaxNumBlockSamples = 64;
+
+// convert a (positive) time difference to nanoseconds
+static inline uint64 ToNanoSeconds(const Time& time)
+{
+	return time.mSeconds * 1000000000ull + time.mNanoSeconds;
+}
+
+
+// constructor
+ChannelTimeIndex::ChannelTimeIndex()
+{
+	Clear();
+}
+
+
+// destructor
+ChannelTimeIndex::~ChannelTimeIndex()
+{
+}
+
+
+// remove all timestamps
+void ChannelTimeIndex::Clear()
+{
+	mBlocks.Clear(false);
+	mOffsets.Clear(false);
+	mFirstBlock			= 0;
+	mFirstOffset		= 0;
+	mFirstSampleIndex	= 0;
+	mEndSampleIndex		= 0;
+}
+
+
+// add the timestamp of the next sample
+void ChannelTimeIndex::Add(uint64 sampleIndex, const Time& time)
+{
+	// the index only covers consecutive samples: start over if samples were added without timestamp
+	if (IsEmpty() == false && sampleIndex != mEndSampleIndex)
+		Clear();
+
+	if (IsEmpty() == true)
+	{
+		Clear();
+		mFirstSampleIndex	= sampleIndex;
+		mEndSampleIndex		= sampleIndex;
+	}
+
+	// timestamps must not decrease
+	Time sampleTime = time;
+	if (mEndSampleIndex > mFirstSampleIndex)
+	{
+		const Time lastTime = GetTime(mEndSampleIndex - 1);
+		if (sampleTime < lastTime)
+			sampleTime = lastTime;
+	}
+
+	// find the offset to the current block; start a new one if it is full or the offset doesn't fit
+	uint64 offset = CORE_UINT64_MAX;
+	if (mBlocks.Size() > mFirstBlock)
+	{
+		const Block& block = mBlocks.GetLast();
+		if (mEndSampleIndex - block.mFirstSampleIndex < gMaxNumBlockSamples)
+			offset = ToNanoSeconds(sampleTime - GetBlockTime(block));
+	}
+
+	if (offset > CORE_UINT32_MAX)
+	{
+		Block block;
+		block.mFirstSampleIndex	= mEndSampleIndex;
+		block.mSeconds			= sampleTime.mSeconds;
+		block.mNanoSeconds		= sampleTime.mNanoSeconds;
+		mBlocks.Add(block);
+
+		offset = 0;
+	}
+
+	mOffsets.Add((uint32)offset);
+	mEndSampleIndex++;
+}
+
+
+// remove the newest timestamp
+void ChannelTimeIndex::RemoveLast()
+{
+	if (IsEmpty() == true)
+		return;
+
+	mOffsets.RemoveLast();
+	mEndSampleIndex--;
+
+	// remove the block if it is empty now
+	if (mBlocks.GetLast().mFirstSampleIndex == mEndSampleIndex)
+		mBlocks.RemoveLast();
+
+	if (IsEmpty() == true)
+		Clear();
+}
+
+
+// forget the timestamps of all samples before the given index
+void ChannelTimeIndex::RemoveBefore(uint64 sampleIndex)
+{
+	if (IsEmpty() == true || sampleIndex <= mFirstSampleIndex)
+		return;
+
+	if (sampleIndex >= mEndSampleIndex)
+	{
+		Clear();
+		return;
+	}
+
+	mFirstOffset += (uint32)(sampleIndex - mFirstSampleIndex);
+	mFirstSampleIndex = sampleIndex;
+
+	// skip the blocks that end before the first sample
+	while (mFirstBlock + 1 < mBlocks.Size() && mBlocks[mFirstBlock + 1].mFirstSampleIndex <= sampleIndex)
+		mFirstBlock++;
+
+	// remove the skipped entries once they make up most of the arrays
+	if (mFirstOffset > 1024 && mFirstOffset > mOffsets.Size() / 2)
+		Compact();
+}
+
+
+// remove the skipped blocks and offsets from the arrays
+void ChannelTimeIndex::Compact()
+{
+	mOffsets.Remove(0, mFirstOffset);
+	mBlocks.Remove(0, mFirstBlock);
+	mFirstOffset = 0;
+	mFirstBlock = 0;
+}
+
+
+// index of the block containing the sample
+uint32 ChannelTimeIndex::FindBlock(uint64 sampleIndex) const
+{
+	// last block that starts at or before the sample
+	uint32 low = mFirstBlock;
+	uint32 high = mBlocks.Size();
+	while (high - low > 1)
+	{
+		const uint32 middle = (low + high) / 2;
+		if (mBlocks[middle].mFirstSampleIndex <= sampleIndex)
+			low = middle;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+
+// index of the last block that starts at or before the given time
+uint32 ChannelTimeIndex::FindBlockByTime(const Time& time) const
+{
+	uint32 low = mFirstBlock;
+	uint32 high = mBlocks.Size();
+	while (high - low > 1)
+	{
+		const uint32 middle = (low + high) / 2;
+		if (GetBlockTime(mBlocks[middle]) <= time)
+			low = middle;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+
+// timestamp of a sample
+Time ChannelTimeIndex::GetTime(uint64 sampleIndex) const
+{
+	CORE_ASSERT(Contains(sampleIndex) == true);
+
+	const Block& block = mBlocks[FindBlock(sampleIndex)];
+	const uint32 offset = GetOffset(sampleIndex);
+
+	return GetBlockTime(block) + Time(offset / 1000000000u, offset % 1000000000u);
+}
+
+
+// index of the newest sample with a timestamp <= time
+uint64 ChannelTimeIndex::FindIndex(const Time& time, bool roundToClosest) const
+{
+	if (IsEmpty() == true || time < GetTime(mFirstSampleIndex))
+		return CORE_INVALIDINDEX64;
+
+	// find the block, then the sample inside of it
+	const uint32 blockIndex = FindBlockByTime(time);
+	const Block& block = mBlocks[blockIndex];
+	const uint64 blockEnd = (blockIndex + 1 < mBlocks.Size() ? mBlocks[blockIndex + 1].mFirstSampleIndex : mEndSampleIndex);
+	const uint64 targetOffset = ToNanoSeconds(time - GetBlockTime(block));
+
+	uint64 low = Max(block.mFirstSampleIndex, mFirstSampleIndex);
+	uint64 high = blockEnd;
+	while (high - low > 1)
+	{
+		const uint64 middle = (low + high) / 2;
+		if (GetOffset(middle) <= targetOffset)
+			low = middle;
+		else
+			high = middle;
+	}
+
+	// check if the next sample is closer
+	if (roundToClosest == true && low + 1 < mEndSampleIndex)
+	{
+		const Time nextTime = GetTime(low + 1);
+		if (nextTime - time < time - GetTime(low))
+			return low + 1;
+	}
+
+	return low;
+}
+
+
+// memory usage
+uint64 ChannelTimeIndex::CalculateMemoryAllocated() const
+{
+	return (uint64)mBlocks.Size() * sizeof(Block) + (uint64)mOffsets.Size() * sizeof(uint32);
+}
@@ -0,0 +1,98 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_CHANNELTIMEINDEX_H
+#define __NEUROMORE_CHANNELTIMEINDEX_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+#include "../Core/Time.h"
+
+
+// Compact per-sample timestamps of a channel (used for channels with irregular samples, where the time can't be calculated from the sample rate).
+// The samples are grouped into blocks, each block stores the full time of its first sample and the other samples as 32 bit nanosecond
+// offsets to it. A new block starts every 64 samples or if the offset doesn't fit anymore (more than ~4.29 s).
+// Timestamps must be added for consecutive sample indices and must not decrease.
+class ENGINE_API ChannelTimeIndex
+{
+	public:
+		// constructor & destructor
+		ChannelTimeIndex();
+		~ChannelTimeIndex();
+
+		// add the timestamp of the next sample
+		void Add(uint64 sampleIndex, const Core::Time& time);
+
+		// remove the newest timestamp (e.g. if the sample was removed from the channel)
+		void RemoveLast();
+
+		// forget the timestamps of all samples before the given index (called for circular buffers, so the index covers the same samples as the channel)
+		void RemoveBefore(uint64 sampleIndex);
+
+		void Clear();
+
+		// range of samples with timestamps
+		bool IsEmpty() const												{ return mOffsets.Size() == mFirstOffset; }
+		bool Contains(uint64 sampleIndex) const								{ return IsEmpty() == false && sampleIndex >= mFirstSampleIndex && sampleIndex < mEndSampleIndex; }
+		uint64 GetFirstSampleIndex() const									{ return mFirstSampleIndex; }
+		uint64 GetEndSampleIndex() const									{ return mEndSampleIndex; }
+
+		// timestamp of a sample (the sample must be contained)
+		Core::Time GetTime(uint64 sampleIndex) const;
+
+		// index of the newest sample with a timestamp <= time (or the closest sample); returns CORE_INVALIDINDEX64 if the time lies before the first sample
+		uint64 FindIndex(const Core::Time& time, bool roundToClosest = false) const;
+
+		// memory usage
+		uint64 CalculateMemoryAllocated() const;
+
+	private:
+		struct Block
+		{
+			uint64	mFirstSampleIndex;
+			uint64	mSeconds;			// time of the first sample
+			uint32	mNanoSeconds;
+		};
+
+		// index of the block containing the sample (binary search)
+		uint32 FindBlock(uint64 sampleIndex) const;
+		uint32 FindBlockByTime(const Core::Time& time) const;
+
+		Core::Time GetBlockTime(const Block& block) const					{ return Core::Time(block.mSeconds, block.mNanoSeconds); }
+		uint32 GetOffset(uint64 sampleIndex) const							{ return mOffsets[mFirstOffset + (uint32)(sampleIndex - mFirstSampleIndex)]; }
+
+		void Compact();
+
+		Core::Array<Block>		mBlocks;			// the blocks, the first mFirstBlock ones were removed already
+		Core::Array<uint32>		mOffsets;			// nanoseconds since the start of the block, one per sample
+		uint32					mFirstBlock;
+		uint32					mFirstOffset;
+		uint64					mFirstSampleIndex;	// sample index of mOffsets[mFirstOffset]
+		uint64					mEndSampleIndex;	// one past the last sample
+};
+
+
+#endif
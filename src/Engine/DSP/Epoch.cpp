@@ -30,6 +30,7 @@
 #include "Channel.h"
 #include "WindowFunction.h"
 #include "Spectrum.h"
+#include "../Core/BlockMath.h"
 
 
 using namespace Core;
@@ -163,13 +164,44 @@ double Epoch::GetSample(uint32 index) const
 // epoch helpers
 //
 
+// get a segment of contiguous samples
+const double* Epoch::GetSegment(uint32 index, uint32* outNumSamples, double* buffer) const
+{
+	const uint32 numSamples = Core::Min<uint32>(SEGMENT_SIZE, mLength - index);
+	*outNumSamples = numSamples;
+
+	// unwindowed samples that are all inside the channel: read them in place
+	if (mWindowFunction == NULL && mPosition + index >= mLength - 1)
+	{
+		const uint64 sampleIndex = mPosition + index - (mLength - 1);
+		if (mChannel->IsValidSample(sampleIndex) == true && mChannel->IsValidSample(sampleIndex + numSamples - 1) == true)
+		{
+			const double* samples;
+			*outNumSamples = mChannel->AsType<double>()->GetContiguousSamples(sampleIndex, numSamples, &samples);
+			return samples;
+		}
+	}
+
+	for (uint32 i=0; i<numSamples; ++i)
+		buffer[i] = GetSample(index + i);
+
+	return buffer;
+}
+
+
 // sum up all elements
 double Epoch::Sum() const
 {
-	double sum = 0;
-	for (uint32 i=GetNumPaddingSamples(); i<mLength; ++i)
-		sum += GetSample(i);
-	
+	double buffer[SEGMENT_SIZE];
+	double sum = 0.0;
+
+	uint32 numSamples;
+	for (uint32 i = GetNumPaddingSamples(); i < mLength; i += numSamples)
+	{
+		const double* samples = GetSegment(i, &numSamples, buffer);
+		sum += BlockMath::Sum(samples, numSamples);
+	}
+
 	return sum;
 }
 
@@ -203,10 +235,16 @@ double Epoch::Min() const
 	if (numValidSamples == 0)
 		return 0;
 
+	double buffer[SEGMENT_SIZE];
 	double min = DBL_MAX;
-	for (uint32 i=GetNumPaddingSamples(); i<mLength; ++i)
-		min = Core::Min(min, GetSample(i));
-	
+
+	uint32 numSamples;
+	for (uint32 i = GetNumPaddingSamples(); i < mLength; i += numSamples)
+	{
+		const double* samples = GetSegment(i, &numSamples, buffer);
+		min = Core::Min(min, BlockMath::Min(samples, numSamples));
+	}
+
 	return min;
 }
 
@@ -218,10 +256,16 @@ double Epoch::Max() const
 	if (numValidSamples == 0)
 		return 0;
 
+	double buffer[SEGMENT_SIZE];
 	double max = -DBL_MAX;
-	for (uint32 i=GetNumPaddingSamples(); i<mLength; ++i)
-		max = Core::Max(max, GetSample(i));
-	
+
+	uint32 numSamples;
+	for (uint32 i = GetNumPaddingSamples(); i < mLength; i += numSamples)
+	{
+		const double* samples = GetSegment(i, &numSamples, buffer);
+		max = Core::Max(max, BlockMath::Max(samples, numSamples));
+	}
+
 	return max;
 }
 
@@ -229,8 +273,23 @@ double Epoch::Max() const
 // peak-to-peak range (absolute)
 double Epoch::Range() const
 {
-	const double min = Min();
-	const double max = Max();
+	const uint32 numValidSamples = mLength - GetNumPaddingSamples();
+	if (numValidSamples == 0)
+		return 0;
+
+	double buffer[SEGMENT_SIZE];
+	double min = DBL_MAX;
+	double max = -DBL_MAX;
+
+	uint32 numSamples;
+	for (uint32 i = GetNumPaddingSamples(); i < mLength; i += numSamples)
+	{
+		double segmentMin, segmentMax;
+		const double* samples = GetSegment(i, &numSamples, buffer);
+		BlockMath::MinMax(samples, numSamples, &segmentMin, &segmentMax);
+		min = Core::Min(min, segmentMin);
+		max = Core::Max(max, segmentMax);
+	}
 
 	// return absolute range
 	if (min < max)
@@ -243,9 +302,15 @@ double Epoch::Range() const
 // calculate the sum of squares
 double Epoch::SS() const
 {
-	double ss = 0;	// sum of squares
-	for (uint32 i = GetNumPaddingSamples(); i < mLength; ++i)
-		ss += GetSample(i) * GetSample(i);
+	double buffer[SEGMENT_SIZE];
+	double ss = 0.0;
+
+	uint32 numSamples;
+	for (uint32 i = GetNumPaddingSamples(); i < mLength; i += numSamples)
+	{
+		const double* samples = GetSegment(i, &numSamples, buffer);
+		ss += BlockMath::SumOfSquares(samples, numSamples);
+	}
 
 	return ss;
 }
@@ -272,21 +337,22 @@ double Epoch::Variance() const
 	if (numValidSamples == 0)
 		return 0;
 
-	double ssd = 0;	// sum of squared differences to mean
-
 	// calculate mean
-	double valueSum = 0;
-	for (uint32 i = GetNumPaddingSamples(); i < mLength; ++i)
-		valueSum += GetSample(i);
-	const double mean = valueSum / (double)numValidSamples;
+	const double mean = Sum() / (double)numValidSamples;
 
-	// sum up the squared differences
-	for (uint32 i = GetNumPaddingSamples(); i < mLength; ++i)
+	// sum up the squared differences to the mean
+	double buffer[SEGMENT_SIZE];
+	double differences[SEGMENT_SIZE];
+	double ssd = 0.0;
+
+	uint32 numSamples;
+	for (uint32 i = GetNumPaddingSamples(); i < mLength; i += numSamples)
 	{
-		const double diff = mean - GetSample(i);
-		ssd += diff*diff;
+		const double* samples = GetSegment(i, &numSamples, buffer);
+		BlockMath::Offset(samples, -mean, differences, numSamples);
+		ssd += BlockMath::SumOfSquares(differences, numSamples);
 	}
-	
+
 	const double variance = ssd / numValidSamples;
 
 	return variance;
@@ -92,6 +92,12 @@ class ENGINE_API Epoch
 		double Median(Core::Array<double>& sortingArray) const;							// median = the first (and single) 2-quantile
 
 	private:
+		// the statistics process the valid (non-padding) samples segment by segment with the block math functions
+		enum { SEGMENT_SIZE = 256 };
+
+		// get up to SEGMENT_SIZE samples starting at the given epoch index; points into the channel memory if possible, otherwise the (windowed) samples are written to the given buffer
+		const double* GetSegment(uint32 index, uint32* outNumSamples, double* buffer) const;
+
 		// the channel this epoch is associated with
 		ChannelBase*			mChannel;
 
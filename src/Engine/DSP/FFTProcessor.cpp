@@ -164,6 +164,9 @@ void FFTProcessor::Update()
 		const double scalingFactor = 1.0 / (numBins-1) / 2.0 * 2.0;		// for clarity (is optimized by compiler)
 		for (uint32 b = 1; b < numBins; b++)
 			spectrum->SetBin(b, complexSpectrum[b] * scalingFactor);
+
+		// 5.3) calculate the bin magnitudes once here, so all nodes reading the spectrum can share them
+		spectrum->UpdateMagnitudes();
 		
 		// TODO deprecate spectrum time?!
 		spectrum->SetTime(input->GetSampleTime(inputEpoch.GetPosition()).InSeconds());
@@ -31,18 +31,20 @@
 using namespace Core;
 
 // constructor
-Filter::Filter(FilterSettings* settings)
+Filter::Filter(FilterSettings* settings, uint32 numChannels)
 {
 	mSettings = settings;
+	mNumChannels = numChannels;
 
 	const uint32 numInputSamples = mSettings->mCoefficients.mNumPoles;
 	const uint32 numOutputSamples = mSettings->mCoefficients.mNumZeroes;
 
-	mXBuffer.Resize(numInputSamples);
-	mYBuffer.Resize(numOutputSamples);
+	mXBuffer.Resize(numInputSamples * numChannels);
+	mYBuffer.Resize(numOutputSamples * numChannels);
+	mSumY.Resize(numChannels);
 
-	MemSet(mXBuffer.GetPtr(), 0, numInputSamples*sizeof(double));
-	MemSet(mYBuffer.GetPtr(), 0, numOutputSamples*sizeof(double));
+	MemSet(mXBuffer.GetPtr(), 0, mXBuffer.Size()*sizeof(double));
+	MemSet(mYBuffer.GetPtr(), 0, mYBuffer.Size()*sizeof(double));
 }
 
 
@@ -52,32 +54,32 @@ Filter::~Filter()
 }
 
 
-// apply filter
-double Filter::Evaluate(double input)
+// apply filter to a single channel, calculates: y(n) = zero(n)*x(n) + zero(n-1)*x[n-1] + ... + pole(n-1) * y(n-1) + pole(n-2) * y(n-2) + ...
+double Filter::Evaluate(double input, uint32 channel)
 {
-	// shift input and output buffer
-	Shift (mXBuffer);
-	Shift (mYBuffer);
+	CORE_ASSERT(channel < mNumChannels);
 
-	return Evaluate(input, &mSettings->mCoefficients, mSettings->mGain, mXBuffer.GetPtr(), mYBuffer.GetPtr());
-}
+	// shift input and output buffer
+	Shift (mXBuffer, channel);
+	Shift (mYBuffer, channel);
 
+	const FilterCoefficients& coeffs = mSettings->mCoefficients;
+	const uint32 stride = mNumChannels;
+	double* X = mXBuffer.GetPtr() + channel;
+	double* Y = mYBuffer.GetPtr() + channel;
 
-// calculates: y(n) = zero(n)*x(n) + zero(n-1)*x[n-1] + ... + pole(n-1) * y(n-1) + pole(n-2) * y(n-2) + ...
-double Filter::Evaluate(double input, FilterCoefficients* coeffs, double gain, double* X, double* Y)
-{
 	// add new input value
-	X[0] = input / gain;
+	X[0] = input / mSettings->mGain;
 
 	// sum of feed-forward terms
 	double sumX = 0;
-	for (uint32 i = 0; i < coeffs->mNumZeroes; ++i)
-		sumX += coeffs->mZeroes[i] * X[coeffs->mNumZeroes-1-i];
+	for (uint32 i = 0; i < coeffs.mNumZeroes; ++i)
+		sumX += coeffs.mZeroes[i] * X[(coeffs.mNumZeroes-1-i) * stride];
 
 	// sum of feed-backward terms
 	double sumY = 0;
-	for (uint32 i = 0; i < coeffs->mNumPoles-1; ++i)		// highest coefficient does not appear on right side of reccurance equation
-		sumY += coeffs->mPoles[i] * Y[coeffs->mNumPoles-1-i];
+	for (uint32 i = 0; i < coeffs.mNumPoles-1; ++i)		// highest coefficient does not appear on right side of reccurance equation
+		sumY += coeffs.mPoles[i] * Y[(coeffs.mNumPoles-1-i) * stride];
 
 	// result
 	const double result = sumX - sumY;
@@ -89,6 +91,57 @@ double Filter::Evaluate(double input, FilterCoefficients* coeffs, double gain, d
 }
 
 
+// apply filter to all channels in lockstep (same as calling Evaluate(input, channel) for each channel, but the inner loops run over the channels)
+void Filter::Evaluate(const double* inputs, double* outputs)
+{
+	// shift input and output buffers of all channels
+	Shift (mXBuffer);
+	Shift (mYBuffer);
+
+	const FilterCoefficients& coeffs = mSettings->mCoefficients;
+	const uint32 numChannels = mNumChannels;
+	const double gain = mSettings->mGain;
+	double* X = mXBuffer.GetPtr();
+	double* Y = mYBuffer.GetPtr();
+	double* sumY = mSumY.GetPtr();
+
+	// add new input values
+	for (uint32 c = 0; c < numChannels; ++c)
+		X[c] = inputs[c] / gain;
+
+	// sums of feed-forward terms
+	for (uint32 c = 0; c < numChannels; ++c)
+		outputs[c] = 0;
+
+	for (uint32 i = 0; i < coeffs.mNumZeroes; ++i)
+	{
+		const double zero = coeffs.mZeroes[i];
+		const double* x = X + (coeffs.mNumZeroes-1-i) * numChannels;
+		for (uint32 c = 0; c < numChannels; ++c)
+			outputs[c] += zero * x[c];
+	}
+
+	// sums of feed-backward terms
+	for (uint32 c = 0; c < numChannels; ++c)
+		sumY[c] = 0;
+
+	for (uint32 i = 0; i < coeffs.mNumPoles-1; ++i)		// highest coefficient does not appear on right side of reccurance equation
+	{
+		const double pole = coeffs.mPoles[i];
+		const double* y = Y + (coeffs.mNumPoles-1-i) * numChannels;
+		for (uint32 c = 0; c < numChannels; ++c)
+			sumY[c] += pole * y[c];
+	}
+
+	// results, remember new output values
+	for (uint32 c = 0; c < numChannels; ++c)
+	{
+		outputs[c] -= sumY[c];
+		Y[c] = outputs[c];
+	}
+}
+
+
 // Transfer Function H(z) = Y(z) / X(z)
 Complex Filter::EvaluateTransferFunction(Complex z)
 {
@@ -136,11 +136,16 @@ class ENGINE_API Filter
 
 	public:
 		// constructors & destructor
-		Filter(FilterSettings* settings);
+		Filter(FilterSettings* settings, uint32 numChannels = 1);
 		virtual ~Filter();
 
 		// apply the filter (one sample goes in, one sample comes out)
-		double Evaluate(double input);
+		double Evaluate(double input)													{ return Evaluate(input, 0); }
+
+		// multi-channel filtering: all channels use the same coefficients but have separate delay buffers
+		uint32 GetNumChannels() const													{ return mNumChannels; }
+		double Evaluate(double input, uint32 channel);									// one sample of a single channel
+		void Evaluate(const double* inputs, double* outputs);							// one sample of all channels (in lockstep)
 
 		// delay of the filter in number of samples
 		uint32 GetGroupDelay();
@@ -151,20 +156,27 @@ class ENGINE_API Filter
 		// configuration of this filter
 		FilterSettings*			mSettings;
 
-		// in/out delay buffers 
+		// in/out delay buffers (structure of arrays: the values of all channels for one delay step are stored next to each other)
+		uint32					mNumChannels;
 		Core::Array<double>		mXBuffer;	// input delay buffer
 		Core::Array<double>		mYBuffer;	// output delay buffer
+		Core::Array<double>		mSumY;		// feed-backward sums of all channels (temp buffer)
 
-		// internal filter evaluate function
-		double Evaluate(double input, FilterCoefficients* coeffs, double gain, double* X, double* Y);
-
-		// buffer helper: shift buffer one step in time (upwards)
-		inline void Shift (Core::Array<double>& buffer)
+		// buffer helper: shift the buffer of one channel one step in time (upwards)
+		inline void Shift (Core::Array<double>& buffer, uint32 channel)
 		{
-			const uint32 numVals = buffer.Size();
+			const uint32 numVals = buffer.Size() / mNumChannels;
 			CORE_ASSERT(numVals > 0);
+			double* values = buffer.GetPtr() + channel;
 			for (uint32 i=numVals-1; i>0; i--)
-				buffer[i] = buffer[i-1];
+				values[i*mNumChannels] = values[(i-1)*mNumChannels];
+		}
+
+		// buffer helper: shift the buffers of all channels one step in time (upwards)
+		inline void Shift (Core::Array<double>& buffer)
+		{
+			CORE_ASSERT(buffer.Size() >= mNumChannels);
+			buffer.Move(mNumChannels, 0, buffer.Size() - mNumChannels);
 		}
 
 		Core::Complex EvaluateTransferFunction(Core::Complex z, FilterCoefficients* coeffs);
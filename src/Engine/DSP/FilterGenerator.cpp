@@ -43,13 +43,13 @@ FilterGenerator::~FilterGenerator()
 
 
 // initialize low and highpass coefficients (bandstop and bandpass are combinations of a low and highpass)
-Filter* FilterGenerator::CreateFilter(Filter::FilterSettings* settings, TransformType transformType)
+Filter* FilterGenerator::CreateFilter(Filter::FilterSettings* settings, TransformType transformType, uint32 numChannels)
 {
 	// Compute coefficients from specification (they are also stored in settings)
 	if (settings->mCoefficients.IsInitialized() == false)
 		ComputeCoefficients(settings, transformType);
 
-	Filter* filter = new Filter(settings);
+	Filter* filter = new Filter(settings, numChannels);
 	return filter;
 }
 
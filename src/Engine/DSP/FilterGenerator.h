@@ -49,7 +49,7 @@ class ENGINE_API FilterGenerator
 		virtual ~FilterGenerator();
 
 		// create a filter from specification
-		Filter* CreateFilter(Filter::FilterSettings* settings, TransformType transformType=AUTOMATIC);
+		Filter* CreateFilter(Filter::FilterSettings* settings, TransformType transformType=AUTOMATIC, uint32 numChannels=1);
 
 		Filter::FilterCoefficients* ComputeCoefficients(Filter::FilterSettings* settings, TransformType transformType);
 
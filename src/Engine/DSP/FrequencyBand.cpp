@@ -38,6 +38,7 @@ FrequencyBand::FrequencyBand()
 	mDescription	= "";
 	mMinFrequency	= 0;
 	mMaxFrequency	= 0;
+	mHasBinRange	= false;
 }
 
 
@@ -49,6 +50,7 @@ FrequencyBand::FrequencyBand(double minFrequency, double maxFrequency, const Cor
 	mColor			= color;
 	mMinFrequency	= minFrequency;
 	mMaxFrequency	= maxFrequency;
+	mHasBinRange	= false;
 }
 
 
@@ -69,85 +71,77 @@ void FrequencyBand::SetFromFrequencyBand(FrequencyBand* band)
 }
 
 
-// calculate average band magnitude
-double FrequencyBand::CalcMagnitude(const Spectrum* spectrum)
+// find the bins within the band, the range is reused as long as the band and the spectrum layout do not change
+bool FrequencyBand::UpdateBinRange(const Spectrum* spectrum)
 {
-	// reset the magnitude and the counter
-	double magnitude	= 0.0;
-	uint32 counter		= 0;
+	const uint32 numSpectrumBins = spectrum->GetNumBins();
+	const double spectrumMaxFrequency = spectrum->GetMaxFrequency();
 
-	const uint32 numValues = spectrum->GetNumBins();
-	for (uint32 i=0; i<numValues; ++i)
+	if (mHasBinRange == false ||
+		mBinRangeNumSpectrumBins != numSpectrumBins || mBinRangeSpectrumMaxFrequency != spectrumMaxFrequency ||
+		mBinRangeMinFrequency != mMinFrequency || mBinRangeMaxFrequency != mMaxFrequency)
 	{
-		const double value = spectrum->GetBin(i);
-		const double frequency = spectrum->CalcFrequency(i);
-
-		// skip if the frequency of this band is not within range
-		if (frequency > mMaxFrequency || frequency < mMinFrequency)
-			continue;
+		spectrum->CalcBinRange(mMinFrequency, mMaxFrequency, &mFirstBin, &mNumBins);
 
-		magnitude += value;
-		counter++;
+		mBinRangeNumSpectrumBins		= numSpectrumBins;
+		mBinRangeSpectrumMaxFrequency	= spectrumMaxFrequency;
+		mBinRangeMinFrequency			= mMinFrequency;
+		mBinRangeMaxFrequency			= mMaxFrequency;
+		mHasBinRange					= true;
 	}
 
-	if (counter == 0)
-		return 0;
-
-	return magnitude / (double)counter;
+	return (mNumBins > 0);
 }
 
 
-// calculate average power
-double FrequencyBand::CalcPower(const Spectrum* spectrum)
+// calculate average band magnitude
+double FrequencyBand::CalcMagnitude(const Spectrum* spectrum)
 {
-	// reset the magnitude and the counter
-	double powerSum		= 0.0;
-	uint32 counter		= 0;
+	if (UpdateBinRange(spectrum) == false)
+		return 0.0;
 
-	const uint32 numValues = spectrum->GetNumBins();
-	for (uint32 i=0; i<numValues; ++i)
-	{
-		const double power = spectrum->GetComplexBin(i).SquaredNorm();
-		const double frequency = spectrum->CalcFrequency(i);
+	return spectrum->CalcAverageMagnitude(mFirstBin, mNumBins);
+}
 
-		// skip if the frequency of this band is not within range
-		if (frequency > mMaxFrequency || frequency < mMinFrequency)
-			continue;
 
-		powerSum += power;
-		counter++;
-	}
-
-	if (counter == 0)
+// calculate average power
+double FrequencyBand::CalcPower(const Spectrum* spectrum)
+{
+	if (UpdateBinRange(spectrum) == false)
 		return 0.0;
 
-	return powerSum / (double)counter;
+	return spectrum->CalcAveragePower(mFirstBin, mNumBins);
 }
 
 
 // calculate average phase
 double FrequencyBand::CalcPhase(const Spectrum* spectrum)
 {
-	// reset the magnitude and the counter
-	double phaseSum		= 0.0;
-	uint32 counter		= 0;
+	if (UpdateBinRange(spectrum) == false)
+		return 0.0;
 
-	const uint32 numValues = spectrum->GetNumBins();
-	for (uint32 i=0; i<numValues; ++i)
-	{
-		const double phase = spectrum->GetComplexBin(i).Arg();
-		const double frequency = spectrum->CalcFrequency(i);
+	return spectrum->CalcAveragePhase(mFirstBin, mNumBins);
+}
 
-		// skip if the frequency of this band is not within range
-		if (frequency > mMaxFrequency || frequency < mMinFrequency)
-			continue;
 
-		phaseSum += phase;
-		counter++;
+// find the dominant frequency within the band
+double FrequencyBand::CalcDominantFrequency(const Spectrum* spectrum)
+{
+	if (UpdateBinRange(spectrum) == false)
+		return 0.0;
+
+	// exclude the 0Hz bin which holds the DC value of the signal
+	uint32 firstBin = mFirstBin;
+	uint32 numBins = mNumBins;
+	if (firstBin == 0)
+	{
+		firstBin = 1;
+		numBins--;
 	}
 
-	if (counter == 0)
+	const uint32 dominantIndex = spectrum->FindMaxBin(firstBin, numBins);
+	if (dominantIndex == CORE_INVALIDINDEX32)
 		return 0.0;
 
-	return phaseSum / (double)counter;
+	return spectrum->CalcFrequency(dominantIndex);
 }
@@ -61,6 +61,9 @@ class ENGINE_API FrequencyBand
 		// calculate the average phase within the band
 		double CalcPhase(const Spectrum* spectrum);
 
+		// find the frequency of the strongest bin within the band (excluding the DC bin)
+		double CalcDominantFrequency(const Spectrum* spectrum);
+
 		// name description and color
 		inline const char* GetName() const					{ return mName.AsChar(); }
 		inline void SetName(const char*  name) 				{ mName = name; }
@@ -78,11 +81,23 @@ class ENGINE_API FrequencyBand
 		// TODO implement some windowing capabilities here
 
 	private:
+		// bin range of the band in the given spectrum; only recalculated if the band or the spectrum layout changes
+		bool UpdateBinRange(const Spectrum* spectrum);
+
 		Core::String		mName;
 		Core::String		mDescription;
 		Core::Color			mColor;
 		double 				mMinFrequency;
 		double 				mMaxFrequency;
+
+		// cached bin range and the configuration it was calculated for
+		uint32				mFirstBin;
+		uint32				mNumBins;
+		uint32				mBinRangeNumSpectrumBins;
+		double				mBinRangeSpectrumMaxFrequency;
+		double				mBinRangeMinFrequency;
+		double				mBinRangeMaxFrequency;
+		bool				mHasBinRange;
 };
 
 
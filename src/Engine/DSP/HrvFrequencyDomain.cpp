@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "HrvFrequencyDomain.h"
+
+
+using namespace Core;
+
+// highest frequency of the HF band
+#define HRV_MAX_FREQUENCY				0.4
+
+// frequency oversampling factor of the periodogram (relative to 1/window length)
+#define HRV_FREQUENCY_OVERSAMPLING		4.0
+
+
+// constructor
+HrvFrequencyDomain::HrvFrequencyDomain()
+{
+	mMethod				= METHOD_LF;
+	mWindowLength		= 0.0;
+	mMinTimeSpan		= 0.0;
+	mBeatTime			= 0.0;
+	mIntervalStartTime	= 0.0;
+}
+
+
+// destructor
+HrvFrequencyDomain::~HrvFrequencyDomain()
+{
+}
+
+
+// configure the analysis
+void HrvFrequencyDomain::Init(EMethod method, double windowLength)
+{
+	mMethod = method;
+	mWindowLength = windowLength;
+
+	// the window has to cover at least one period of the lowest frequency in the band before the value means anything
+	double minFrequency, maxFrequency;
+	GetBandRange((method == METHOD_LFHF ? METHOD_LF : method), &minFrequency, &maxFrequency);
+	mMinTimeSpan = Min(windowLength, 1.0 / minFrequency);
+
+	mPeriodogram.Init(1.0 / (HRV_FREQUENCY_OVERSAMPLING * windowLength), HRV_MAX_FREQUENCY);
+
+	Reset();
+}
+
+
+// forget all beats
+void HrvFrequencyDomain::Reset()
+{
+	mPeriodogram.Clear();
+	mBeatTime = 0.0;
+	mIntervalStartTime = 0.0;
+}
+
+
+// process all new RR intervals
+void HrvFrequencyDomain::Process(ChannelReader* inputReader, Channel<double>* output)
+{
+	const uint32 numNewSamples = inputReader->GetNumNewSamples();
+	for (uint32 i=0; i<numNewSamples; ++i)
+	{
+		const double rr = inputReader->PopOldestSample<double>();
+
+		// skip invalid intervals
+		if (rr <= 0.0)
+			continue;
+
+		// the beat happens at the end of its RR interval
+		mBeatTime += rr / 1000.0;
+		mPeriodogram.AddSample(mBeatTime, rr);
+
+		// drop the beats that left the window
+		while (mPeriodogram.GetNumSamples() > 0 && mPeriodogram.GetOldestTime() < mBeatTime - mWindowLength)
+		{
+			mIntervalStartTime = mPeriodogram.GetOldestTime();
+			mPeriodogram.RemoveOldestSample();
+		}
+
+		// wait until the beats cover enough time; the RR interval of the oldest beat counts as well, otherwise a full window could never reach the window length
+		if (mPeriodogram.GetNumSamples() < 3 || mBeatTime - mIntervalStartTime < mMinTimeSpan)
+			continue;
+
+		mPeriodogram.Calculate();
+		output->AddSample(CalcValue());
+	}
+}
+
+
+// calculate the output value from the current spectrum
+double HrvFrequencyDomain::CalcValue() const
+{
+	double minFrequency, maxFrequency;
+
+	if (mMethod == METHOD_LFHF)
+	{
+		GetBandRange(METHOD_LF, &minFrequency, &maxFrequency);
+		const double lf = mPeriodogram.CalcBandPower(minFrequency, maxFrequency);
+
+		GetBandRange(METHOD_HF, &minFrequency, &maxFrequency);
+		const double hf = mPeriodogram.CalcBandPower(minFrequency, maxFrequency);
+
+		if (hf <= 0.0)
+			return 0.0;
+
+		return lf / hf;
+	}
+
+	GetBandRange(mMethod, &minFrequency, &maxFrequency);
+	return mPeriodogram.CalcBandPower(minFrequency, maxFrequency);
+}
+
+
+const char* HrvFrequencyDomain::GetName(EMethod method)
+{
+	switch (method)
+	{
+		case METHOD_VLF:		return "VLF";
+		case METHOD_LF:			return "LF";
+		case METHOD_HF:			return "HF";
+		case METHOD_LFHF:		return "LF/HF";
+		default:				return "Unknown";
+	}
+}
+
+
+// frequency bands as defined by the Task Force of the ESC and NASPE (1996)
+void HrvFrequencyDomain::GetBandRange(EMethod method, double* outMinFrequency, double* outMaxFrequency)
+{
+	switch (method)
+	{
+		case METHOD_VLF:		*outMinFrequency = 0.0033;	*outMaxFrequency = 0.04;				break;
+		case METHOD_LF:			*outMinFrequency = 0.04;	*outMaxFrequency = 0.15;				break;
+		case METHOD_HF:			*outMinFrequency = 0.15;	*outMaxFrequency = HRV_MAX_FREQUENCY;	break;
+		default:
+			CORE_ASSERT(false);
+			*outMinFrequency = 0.04;
+			*outMaxFrequency = 0.15;
+			break;
+	}
+}
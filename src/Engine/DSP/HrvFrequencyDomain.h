@@ -0,0 +1,78 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_HRVFREQUENCYDOMAIN_H
+#define __NEUROMORE_HRVFREQUENCYDOMAIN_H
+
+// include required headers
+#include "../Config.h"
+#include "ChannelReader.h"
+#include "Channel.h"
+#include "LombScargle.h"
+
+
+// frequency domain HRV: band powers of the RR series, calculated directly on the unevenly sampled beats using a Lomb-Scargle periodogram
+class ENGINE_API HrvFrequencyDomain
+{
+	public:
+		enum EMethod
+		{
+			METHOD_VLF,						// very low frequency power (0.0033-0.04 Hz) in ms^2
+			METHOD_LF,						// low frequency power (0.04-0.15 Hz) in ms^2
+			METHOD_HF,						// high frequency power (0.15-0.4 Hz) in ms^2
+			METHOD_LFHF,					// ratio of LF to HF power
+			NUM_FREQUENCY_DOMAIN_METHODS
+		};
+
+		// range of the analysis window (in seconds)
+		static constexpr const double MIN_WINDOW_LENGTH = 10.0;
+		static constexpr const double MAX_WINDOW_LENGTH = 3600.0;
+
+		// constructor & destructor
+		HrvFrequencyDomain();
+		~HrvFrequencyDomain();
+
+		// configure method and analysis window (in seconds), also resets the beat history
+		void Init(EMethod method, double windowLength);
+		void Reset();
+
+		// add all new RR intervals (in ms) to the periodogram and output one value per beat once the window holds enough beats
+		void Process(ChannelReader* inputReader, Channel<double>* output);
+
+		static const char* GetName(EMethod method);
+		static void GetBandRange(EMethod method, double* outMinFrequency, double* outMaxFrequency);
+
+	private:
+		double CalcValue() const;
+
+		LombScargle		mPeriodogram;
+		EMethod			mMethod;
+		double			mWindowLength;
+		double			mMinTimeSpan;			// time span the beats have to cover before the first value is calculated
+		double			mIntervalStartTime;		// start of the RR interval of the oldest beat in the window (the time of the last dropped beat)
+		double			mBeatTime;				// time of the last beat, sum of all RR intervals (in seconds)
+};
+
+
+#endif
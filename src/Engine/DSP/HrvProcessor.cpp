@@ -40,6 +40,9 @@ HrvProcessor::HrvProcessor() : ChannelProcessor()
 	mSettings.mTimeDomainMethod	= HrvTimeDomain::METHOD_RMSSD;
 	mSettings.mNumRRIntervals	= 10;
 	mSettings.mStartTime		= 0;
+	mSettings.mUseFrequencyDomain		= false;
+	mSettings.mFrequencyDomainMethod	= HrvFrequencyDomain::METHOD_LF;
+	mSettings.mWindowLength				= 300;
 }
 
 
@@ -88,6 +91,18 @@ void HrvProcessor::ReInit()
 	GetInputReader()->SetEpochShift(1);
 	GetInputReader()->SetEpochZeroPadding(true);
 
+	// frequency domain: consumes the RR intervals one by one, no epochs
+	if (mSettings.mUseFrequencyDomain == true)
+	{
+		mSettings.mWindowLength = Clamp(mSettings.mWindowLength, HrvFrequencyDomain::MIN_WINDOW_LENGTH, HrvFrequencyDomain::MAX_WINDOW_LENGTH);
+
+		mFrequencyDomain.Init(mSettings.mFrequencyDomainMethod, mSettings.mWindowLength);
+		mTimeDomainFunction = NULL;
+
+		mIsInitialized = true;
+		return;
+	}
+
 	// update algo function pointer
 	mTimeDomainFunction = HrvTimeDomain::GetFunction(mSettings.mTimeDomainMethod);
 
@@ -103,7 +118,11 @@ void HrvProcessor::Update()
 	// call resample method (if set and inputs are connected)
 	if (GetInput() != NULL)
 	{
-		if (mTimeDomainFunction != NULL)
+		if (mSettings.mUseFrequencyDomain == true)
+		{
+			mFrequencyDomain.Process(GetInputReader(), GetOutput()->AsType<double>());
+		}
+		else if (mTimeDomainFunction != NULL)
 		{
 			ChannelReader* inputReader = GetInputReader();
 			Channel<double>* output = GetOutput()->AsType<double>();
@@ -28,6 +28,7 @@
 #include "../Config.h"
 #include "ChannelProcessor.h"
 #include "HrvTimeDomain.h"
+#include "HrvFrequencyDomain.h"
 
 
 // heart rate variability processor
@@ -50,6 +51,10 @@ class ENGINE_API HrvProcessor : public ChannelProcessor
 			double					mOutputSampleRate;		// output sample rate
 			Core::Time				mStartTime;				// output start time	
 			HrvTimeDomain::EMethod 	mTimeDomainMethod;		// which method to use for time domain analysis output
+
+			bool					mUseFrequencyDomain;	// output a frequency domain metric instead of the time domain one
+			HrvFrequencyDomain::EMethod mFrequencyDomainMethod;	// which band power to output in frequency domain mode
+			double					mWindowLength;			// analysis window of the frequency domain metrics (in seconds)
 		};
 
 		////////////////////////////////////////////
@@ -74,15 +79,18 @@ class ENGINE_API HrvProcessor : public ChannelProcessor
 		// configure processor
 		void SetTimeDomainMethod(HrvTimeDomain::EMethod method)					{ mSettings.mTimeDomainMethod = method; }
 		void SetNumRRIntervals(uint32 numRRs)									{ mSettings.mNumRRIntervals = numRRs; }
+		void SetFrequencyDomainMethod(HrvFrequencyDomain::EMethod method)		{ mSettings.mUseFrequencyDomain = true; mSettings.mFrequencyDomainMethod = method; }
+		void SetWindowLength(double seconds)									{ mSettings.mWindowLength = seconds; }
 
 		// DSP related properties
 		//uint32 GetDelay(uint32 inputPortIndex, uint32 outputPortIndex) const override;		// is zero for all methods 
 		//double GetLatency(uint32 inputPortIndex, uint32 outputPortIndex) const override;		// this is a hard one, we better not try to calculate it right now, doesn't really matter anyways
 		//double GetSampleRatio(uint32 inputPortIndex, uint32 outputPortIndex) const override;	// this is not applicable here! // FIXME sample rate ratio alone is not sufficient in case a node has undefinied input samplerate but fixed output.. BTW: resamplers have the same problem!
-		uint32 GetNumEpochSamples(uint32 inputPortIndex) const override						{ return mSettings.mNumRRIntervals + 1; }
+		uint32 GetNumEpochSamples(uint32 inputPortIndex) const override						{ return (mSettings.mUseFrequencyDomain ? 1 : mSettings.mNumRRIntervals + 1); }
 
 	private:
 		HrvTimeDomain::Function	mTimeDomainFunction;
+		HrvFrequencyDomain		mFrequencyDomain;
 		Settings				mSettings;
 };
 
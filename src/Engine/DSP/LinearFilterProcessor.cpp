@@ -71,18 +71,34 @@ void LinearFilterProcessor::ReInit()
 	if (input == NULL || output == NULL)
 		return;
 	
-	// output sample rate is same as input
+	// output sample rate is same as input (the node only batches channels with the same sample rate)
 	mSettings.mSampleRate = input->GetSampleRate();
-	output->SetSampleRate(mSettings.mSampleRate);
+	
+	const uint32 numChannels = GetNumChannels();
+	for (uint32 c = 0; c < numChannels; ++c)
+		GetOutput(0, c)->SetSampleRate(mSettings.mSampleRate);
 
 	// create new filter
 	delete mFilter;
-	mFilter = mFilterGenerator.CreateFilter(&mSettings);
+	mFilter = mFilterGenerator.CreateFilter(&mSettings, FilterGenerator::AUTOMATIC, numChannels);
+
+	mInputSamples.Resize(numChannels);
+	mOutputSamples.Resize(numChannels);
 
 	mIsInitialized = true;
 }
 
 
+// ignore invalid samples
+static inline double ValidateFilterOutput(double value)
+{
+	if (Math::IsValidNumberD(value) == false || Math::AbsD(value) > 10e12)		// NOTE arbitrary max value of 10e12!
+		return 0;
+
+	return value;
+}
+
+
 void LinearFilterProcessor::Update()
 {
 	if (mIsInitialized == false || mFilter == NULL)
@@ -91,33 +107,44 @@ void LinearFilterProcessor::Update()
 	// update base
 	ChannelProcessor::Update();
 	
-	ChannelReader*		input			= GetInputReader(0);
-	Channel<double>*	output			= GetOutput()->AsType<double>();
-	const uint32		numNewSamples	= input->GetNumNewSamples();
-
 	// TODO: implement other filters and remove this
 	if (mSettings.mFilterMethod != Filter::BUTTERWORTH)
 		return;
 
-	if (numNewSamples == 0)
-		return;
+	const uint32 numChannels = GetNumChannels();
 
-	double result = 0;
+	// number of samples all channels can process in lockstep
+	uint32 numLockstepSamples = CORE_INT32_MAX;
+	for (uint32 c = 0; c < numChannels; ++c)
+		numLockstepSamples = Min<uint32>(numLockstepSamples, GetInputReader(0, c)->GetNumNewSamples());
 
-	// for each new sample: shift in, evaluate filter, output sample to outputchannel
-	for (uint32 i=0; i<numNewSamples; ++i)
+	// for each new sample: shift in, evaluate filter for all channels, output samples to the outputchannels
+	double* inputs = mInputSamples.GetPtr();
+	double* outputs = mOutputSamples.GetPtr();
+	for (uint32 i=0; i<numLockstepSamples; ++i)
 	{
-		// get sample, add it to channel buffer
-		const double& sample = input->PopOldestSample<double>();
-		
-		// apply filter
-		result = mFilter->Evaluate(sample);
+		for (uint32 c = 0; c < numChannels; ++c)
+			inputs[c] = GetInputReader(0, c)->PopOldestSample<double>();
 
-		// ignore invalid samples
-		if (Math::IsValidNumberD(result) == false || Math::AbsD(result) > 10e12)		// NOTE arbitrary max value of 10e12!
-			result = 0;
+		// apply filter
+		mFilter->Evaluate(inputs, outputs);
 
 		// add output samples
-		output->AddSample(result);
+		for (uint32 c = 0; c < numChannels; ++c)
+			GetOutput(0, c)->AsType<double>()->AddSample( ValidateFilterOutput(outputs[c]) );
+	}
+
+	// channels that received more samples than the others are filtered individually
+	for (uint32 c = 0; c < numChannels; ++c)
+	{
+		ChannelReader* input = GetInputReader(0, c);
+		Channel<double>* output = GetOutput(0, c)->AsType<double>();
+
+		const uint32 numNewSamples = input->GetNumNewSamples();
+		for (uint32 i=0; i<numNewSamples; ++i)
+		{
+			const double& sample = input->PopOldestSample<double>();
+			output->AddSample( ValidateFilterOutput(mFilter->Evaluate(sample, c)) );
+		}
 	}
 }
@@ -31,7 +31,7 @@
 #include "FilterGenerator.h"
 
 
-// linear filter (IIR/FIR) for a single channel
+// linear filter (IIR/FIR), filters all channels of a node in lockstep
 class ENGINE_API LinearFilterProcessor : public ChannelProcessor
 {
 	public:
@@ -51,6 +51,7 @@ class ENGINE_API LinearFilterProcessor : public ChannelProcessor
 		virtual ~LinearFilterProcessor();
 
 		uint32 GetType() const override									{ return TYPE_ID; }
+		bool IsMultiChannel() const override							{ return true; }
 		ChannelProcessor* Clone() override								{ LinearFilterProcessor* clone = new LinearFilterProcessor(); clone->Setup(mSettings); return clone; }
 
 		void Init() override;
@@ -73,6 +74,10 @@ class ENGINE_API LinearFilterProcessor : public ChannelProcessor
 		Filter*					mFilter;			// the active filter
 		LinearFilterSettings	mSettings;			// filter specification
 		FilterGenerator			mFilterGenerator;	// for creating filters
+
+		// lockstep buffers (one sample of each channel)
+		Core::Array<double>		mInputSamples;
+		Core::Array<double>		mOutputSamples;
 		
 };
 
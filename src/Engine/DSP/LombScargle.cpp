@@ -0,0 +1,308 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "LombScargle.h"
+
+
+using namespace Core;
+
+// number of grid points each sample is spread onto (order of the lagrange interpolation)
+#define LOMBSCARGLE_NUM_SPREAD_POINTS	4
+
+// largest extirpolation grid (limits the number of frequencies to 1/16 of it)
+#define LOMBSCARGLE_MAX_GRID_SIZE		(1 << 20)
+
+// rebuild the grids from the stored samples after this many removals (removing samples accumulates rounding errors)
+#define LOMBSCARGLE_MAX_REMOVALS		1024
+
+
+// constructor
+LombScargle::LombScargle()
+{
+	mFirstSample			= 0;
+	mNumRemovals			= 0;
+	mFrequencyResolution	= 0.0;
+	mTimeOrigin				= 0.0;
+	mValueOffset			= 0.0;
+	mValueSum				= 0.0;
+}
+
+
+// destructor
+LombScargle::~LombScargle()
+{
+}
+
+
+// set up the frequency and extirpolation grids
+void LombScargle::Init(double frequencyResolution, double maxFrequency)
+{
+	CORE_ASSERT(frequencyResolution > 0.0 && maxFrequency > frequencyResolution);
+
+	// the grid has to resolve twice the highest frequency (required for tau) with some headroom for the interpolation;
+	// too fine resolutions are coarsened so the grid stays within its limit
+	const uint32 maxNumFrequencies = LOMBSCARGLE_MAX_GRID_SIZE / (4 * LOMBSCARGLE_NUM_SPREAD_POINTS);
+	const double requiredNumFrequencies = Math::CeilD(maxFrequency / frequencyResolution);
+	if (requiredNumFrequencies > maxNumFrequencies)
+	{
+		LogWarning("LombScargle: frequency resolution %g Hz is too fine, using %g Hz", frequencyResolution, maxFrequency / maxNumFrequencies);
+		frequencyResolution = maxFrequency / maxNumFrequencies;
+	}
+
+	const uint32 numFrequencies = (uint32)Min<double>(requiredNumFrequencies, maxNumFrequencies);
+	mFrequencyResolution = frequencyResolution;
+	mPowers.Resize(numFrequencies);
+	mValueSpectrum.Resize(numFrequencies + 1);
+
+	uint32 gridSize = 64;
+	while (gridSize < 4 * LOMBSCARGLE_NUM_SPREAD_POINTS * numFrequencies)
+		gridSize <<= 1;
+
+	mValueGrid.Resize(gridSize);
+	mWeightGrid.Resize(gridSize);
+	mFFT.Init(gridSize);
+
+	Clear();
+}
+
+
+// remove all samples
+void LombScargle::Clear()
+{
+	mSamples.Clear(false);
+	mFirstSample = 0;
+
+	Rebuild();
+}
+
+
+// add a sample
+void LombScargle::AddSample(double time, double value)
+{
+	CORE_ASSERT(mValueGrid.Size() > 0);
+
+	// first sample defines the origin of the grids
+	if (GetNumSamples() == 0)
+	{
+		mSamples.Clear(false);
+		mFirstSample = 0;
+		mTimeOrigin = time;
+		mValueOffset = value;
+	}
+
+	Sample sample;
+	sample.mTime = time;
+	sample.mValue = value;
+	mSamples.Add(sample);
+
+	const double position = CalcGridPosition(time);
+	Spread(mValueGrid, value - mValueOffset, position);
+	Spread(mWeightGrid, 1.0, position);
+	mValueSum += value - mValueOffset;
+}
+
+
+// remove the oldest sample
+void LombScargle::RemoveOldestSample()
+{
+	if (GetNumSamples() == 0)
+		return;
+
+	const Sample& sample = mSamples[mFirstSample];
+	const double position = CalcGridPosition(sample.mTime);
+	Spread(mValueGrid, -(sample.mValue - mValueOffset), position);
+	Spread(mWeightGrid, -1.0, position);
+	mValueSum -= sample.mValue - mValueOffset;
+
+	mFirstSample++;
+	mNumRemovals++;
+
+	// compact the sample array and get rid of the accumulated rounding errors from time to time
+	if (mNumRemovals >= LOMBSCARGLE_MAX_REMOVALS || GetNumSamples() == 0)
+	{
+		const uint32 numSamples = GetNumSamples();
+		for (uint32 i=0; i<numSamples; ++i)
+			mSamples[i] = mSamples[mFirstSample + i];
+		mSamples.Resize(numSamples);
+		mFirstSample = 0;
+
+		Rebuild();
+	}
+}
+
+
+// recalculate the power spectrum
+void LombScargle::Calculate()
+{
+	const uint32 numFrequencies = mPowers.Size();
+	for (uint32 i=0; i<numFrequencies; ++i)
+		mPowers[i] = 0.0;
+
+	const uint32 numSamples = GetNumSamples();
+	if (numSamples < 3)
+		return;
+
+	const uint32 gridSize = mValueGrid.Size();
+	const double n = numSamples;
+	const double mean = mValueSum / n;
+
+	// spectrum of the values (only the part we need)
+	double* fftInput = mFFT.GetInput();
+	for (uint32 i=0; i<gridSize; ++i)
+		fftInput[i] = mValueGrid[i];
+	mFFT.CalcFFT();
+
+	const Complex* fftOutput = mFFT.GetOutput();
+	for (uint32 i=0; i<=numFrequencies; ++i)
+		mValueSpectrum[i] = fftOutput[i];
+
+	// spectrum of the unit weights
+	for (uint32 i=0; i<gridSize; ++i)
+		fftInput[i] = mWeightGrid[i];
+	mFFT.CalcFFT();
+
+	// scale the periodogram to a power spectral density, so that integrating it yields the signal variance
+	const double meanSampleInterval = (GetNewestTime() - GetOldestTime()) / (n - 1.0);
+
+	for (uint32 k=1; k<=numFrequencies; ++k)
+	{
+		// sums over cos/sin(2wt) at twice the frequency, they define the time offset tau
+		const Complex& weights2 = fftOutput[2 * k];
+		const double hypo = Math::SqrtD(weights2.mReal * weights2.mReal + weights2.mImag * weights2.mImag);
+		if (hypo <= 0.0)
+			continue;
+
+		const double hc2wt = 0.5 * weights2.mReal / hypo;
+		const double hs2wt = 0.5 * weights2.mImag / hypo;
+		const double cwt = Math::SqrtD(0.5 + hc2wt);
+		const double swt = (hs2wt >= 0.0 ? 1.0 : -1.0) * Math::SqrtD(Max(0.0, 0.5 - hc2wt));
+		const double den = 0.5 * n + hc2wt * weights2.mReal + hs2wt * weights2.mImag;
+		if (den <= 0.0 || n - den <= 0.0)
+			continue;
+
+		// sums over the mean free values times cos/sin(wt)
+		const Complex values = mValueSpectrum[k] - fftOutput[k] * mean;
+		const double cosTerm = cwt * values.mReal + swt * values.mImag;
+		const double sinTerm = cwt * values.mImag - swt * values.mReal;
+
+		const double periodogram = 0.5 * (cosTerm * cosTerm / den + sinTerm * sinTerm / (n - den));
+		mPowers[k - 1] = 2.0 * meanSampleInterval * periodogram;
+	}
+}
+
+
+// integrate the spectrum over the given frequency range
+double LombScargle::CalcBandPower(double minFrequency, double maxFrequency) const
+{
+	double sum = 0.0;
+
+	const uint32 numFrequencies = mPowers.Size();
+	for (uint32 i=0; i<numFrequencies; ++i)
+	{
+		const double frequency = GetFrequency(i);
+		if (frequency >= minFrequency && frequency < maxFrequency)
+			sum += mPowers[i];
+	}
+
+	return sum * mFrequencyResolution;
+}
+
+
+// recalculate the grids from the stored samples
+void LombScargle::Rebuild()
+{
+	mNumRemovals = 0;
+	mValueSum = 0.0;
+
+	const uint32 gridSize = mValueGrid.Size();
+	for (uint32 i=0; i<gridSize; ++i)
+	{
+		mValueGrid[i] = 0.0;
+		mWeightGrid[i] = 0.0;
+	}
+
+	const uint32 numSamples = GetNumSamples();
+	if (numSamples == 0)
+		return;
+
+	mTimeOrigin = mSamples[mFirstSample].mTime;
+	mValueOffset = mSamples[mFirstSample].mValue;
+
+	for (uint32 i=mFirstSample; i<mSamples.Size(); ++i)
+	{
+		const double position = CalcGridPosition(mSamples[i].mTime);
+		Spread(mValueGrid, mSamples[i].mValue - mValueOffset, position);
+		Spread(mWeightGrid, 1.0, position);
+		mValueSum += mSamples[i].mValue - mValueOffset;
+	}
+}
+
+
+// position of the given time on the periodic grid (one grid period is 1/frequencyResolution seconds)
+double LombScargle::CalcGridPosition(double time) const
+{
+	const double gridSize = mValueGrid.Size();
+	const double position = fmod((time - mTimeOrigin) * mFrequencyResolution * gridSize, gridSize);
+	return (position < 0.0 ? position + gridSize : position);
+}
+
+
+// extirpolation: add the value to the grid points around the position, weighted so that summing over the grid reproduces lagrange interpolation
+void LombScargle::Spread(Array<double>& grid, double value, double position)
+{
+	const int32 gridSize = grid.Size();
+	const int32 numPoints = LOMBSCARGLE_NUM_SPREAD_POINTS;
+
+	// exactly on a grid point
+	const int32 index = (int32)position;
+	if (position == (double)index)
+	{
+		grid[index % gridSize] += value;
+		return;
+	}
+
+	const int32 low = (int32)Math::FloorD(position - 0.5 * numPoints + 1.0);
+	const int32 high = low + numPoints - 1;
+
+	// product of all distances to the grid points
+	double factor = position - low;
+	for (int32 j=low+1; j<=high; ++j)
+		factor *= position - j;
+
+	// denominator starts at (numPoints-1)! and is updated for each grid point
+	double denominator = 1.0;
+	for (int32 j=2; j<numPoints; ++j)
+		denominator *= j;
+
+	grid[(high % gridSize + gridSize) % gridSize] += value * factor / (denominator * (position - high));
+	for (int32 j=high-1; j>=low; --j)
+	{
+		denominator = (denominator / (j + 1 - low)) * (j - high);
+		grid[(j % gridSize + gridSize) % gridSize] += value * factor / (denominator * (position - j));
+	}
+}
@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_LOMBSCARGLE_H
+#define __NEUROMORE_LOMBSCARGLE_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+#include "../Core/ComplexMath.h"
+#include "FFT.h"
+
+
+// Lomb-Scargle periodogram of an unevenly sampled signal, using the fast extirpolation algorithm (Press & Rybicki 1989)
+// the samples are spread onto a fixed periodic grid once when they are added (and removed again when they leave the window),
+// so updating the spectrum only costs two FFTs of the grid instead of a full recalculation over all samples and frequencies
+class ENGINE_API LombScargle
+{
+	public:
+		// constructor & destructor
+		LombScargle();
+		~LombScargle();
+
+		// set up the frequency grid: frequencies are multiples of the resolution, up to the max frequency (also removes all samples)
+		void Init(double frequencyResolution, double maxFrequency);
+		void Clear();
+
+		// add a new sample (times must be increasing) or remove the oldest one
+		void AddSample(double time, double value);
+		void RemoveOldestSample();
+
+		uint32 GetNumSamples() const											{ return mSamples.Size() - mFirstSample; }
+		double GetOldestTime() const											{ return mSamples[mFirstSample].mTime; }
+		double GetNewestTime() const											{ return mSamples.GetLast().mTime; }
+
+		// recalculate the power spectrum from the current samples
+		void Calculate();
+
+		// power spectral density (squared signal unit per Hz)
+		uint32 GetNumFrequencies() const										{ return mPowers.Size(); }
+		double GetFrequency(uint32 index) const									{ return (index + 1) * mFrequencyResolution; }
+		double GetPower(uint32 index) const										{ return mPowers[index]; }
+
+		// integrate the spectrum over the frequency range [minFrequency, maxFrequency)
+		double CalcBandPower(double minFrequency, double maxFrequency) const;
+
+	private:
+		struct Sample
+		{
+			double		mTime;
+			double		mValue;
+		};
+
+		void Rebuild();
+		void Spread(Core::Array<double>& grid, double value, double position);
+		double CalcGridPosition(double time) const;
+
+		Core::Array<Sample>			mSamples;
+		uint32						mFirstSample;			// samples before this index were removed already
+		uint32						mNumRemovals;			// removals since the last rebuild of the grids
+
+		double						mFrequencyResolution;
+		double						mTimeOrigin;			// time of grid position zero
+		double						mValueOffset;			// subtracted from all values to keep the grid sums small
+		double						mValueSum;				// sum of (value - offset)
+
+		Core::Array<double>			mValueGrid;				// extirpolated sample values
+		Core::Array<double>			mWeightGrid;			// extirpolated unit weights (used for the mean correction and the time offset tau)
+		Core::Array<Core::Complex>	mValueSpectrum;
+		Core::Array<double>			mPowers;
+		FFT							mFFT;
+};
+
+
+#endif
@@ -0,0 +1,200 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required files
+#include "MinMaxPyramid.h"
+
+
+using namespace Core;
+
+// constructor
+MinMaxPyramid::MinMaxPyramid()
+{
+	Reset();
+}
+
+
+// destructor
+MinMaxPyramid::~MinMaxPyramid()
+{
+}
+
+
+// clear everything
+void MinMaxPyramid::Reset()
+{
+	mBuckets.Clear();
+	mLevelOffsets.Clear();
+	mLevelMasks.Clear();
+	mNumLevels			= 0;
+	mCapacity			= 0;
+	mChannelID			= CORE_INVALIDINDEX32;
+	mNextSampleIndex	= 0;
+}
+
+
+// allocate the ring buffers of all levels
+void MinMaxPyramid::Init(Channel<double>* channel, uint32 channelID, uint32 capacity)
+{
+	Reset();
+
+	mCapacity	= capacity;
+	mChannelID	= channelID;
+
+	// level 0 is the channel itself
+	mLevelOffsets.Add(0);
+	mLevelMasks.Add(0);
+	mNumLevels = 1;
+
+	// add levels as long as there are at least two buckets in the range
+	uint32 numBuckets = 0;
+	while ((capacity >> mNumLevels) >= 2 && mNumLevels < 32)
+	{
+		// ring buffer size: the covered range can start in the middle of a bucket and end in another one
+		uint32 ringSize = 1;
+		while (ringSize < (capacity >> mNumLevels) + 2)
+			ringSize <<= 1;
+
+		mLevelOffsets.Add(numBuckets);
+		mLevelMasks.Add(ringSize - 1);
+		numBuckets += ringSize;
+		mNumLevels++;
+	}
+
+	mBuckets.Resize(numBuckets);
+
+	// start at the first valid sample of the channel
+	mNextSampleIndex = (channel->IsEmpty() == true ? 0 : channel->GetMinSampleIndex());
+}
+
+
+// add all new samples of the channel
+void MinMaxPyramid::Update(Channel<double>* channel, uint32 channelID)
+{
+	if (channel == NULL)
+	{
+		Reset();
+		return;
+	}
+
+	if (channelID == CORE_INVALIDINDEX32)
+		channelID = channel->GetID();
+
+	const uint64 numSamples = channel->GetNumSamples();
+
+	// the pyramid must cover all samples of the channel (use the buffer size for circular buffers, grow by doubling otherwise)
+	uint32 requiredCapacity = (channel->IsBuffer() == true ? channel->GetBufferSize() : mCapacity);
+	while (requiredCapacity < numSamples)
+		requiredCapacity = Max<uint32>(2 * requiredCapacity, 1024);
+
+	// rebuild if the channel was replaced, cleared or has grown
+	if (channelID != mChannelID || requiredCapacity != mCapacity || channel->GetSampleCounter() < mNextSampleIndex)
+		Init(channel, channelID, requiredCapacity);
+
+	if (channel->IsEmpty() == true)
+		return;
+
+	// skip samples that are not in the channel anymore (only happens if the pyramid was not updated for a while)
+	mNextSampleIndex = Max<uint64>(mNextSampleIndex, channel->GetMinSampleIndex());
+
+	const uint64 maxSampleIndex = channel->GetMaxSampleIndex();
+	for (uint64 i = mNextSampleIndex; i <= maxSampleIndex; ++i)
+		AddSample(i, channel->GetSample(i));
+
+	mNextSampleIndex = maxSampleIndex + 1;
+}
+
+
+// add a single sample to the buckets of all levels
+void MinMaxPyramid::AddSample(uint64 sampleIndex, double value)
+{
+	for (uint32 l = 1; l < mNumLevels; ++l)
+	{
+		Bucket& bucket = GetBucket(l, sampleIndex >> l);
+
+		// first sample of the bucket
+		if ((sampleIndex & (((uint64)1 << l) - 1)) == 0)
+		{
+			bucket.mMin = value;
+			bucket.mMax = value;
+			bucket.mSum = value;
+		}
+		else
+		{
+			bucket.mMin = Min<double>(bucket.mMin, value);
+			bucket.mMax = Max<double>(bucket.mMax, value);
+			bucket.mSum += value;
+		}
+	}
+}
+
+
+// combine the largest complete buckets that fit into the range, the samples at the borders are read from the channel
+void MinMaxPyramid::FindMinMax(Channel<double>* channel, uint64 firstSampleIndex, uint64 lastSampleIndex, double* outMin, double* outMax, double* outSum) const
+{
+	CORE_ASSERT(lastSampleIndex < mNextSampleIndex);
+
+	double minValue = DBL_MAX;
+	double maxValue = -DBL_MAX;
+	double sum = 0.0;
+
+	uint64 i = firstSampleIndex;
+	while (i <= lastSampleIndex)
+	{
+		// find the highest level with a bucket that starts at i and lies completely inside the range
+		uint32 level = 0;
+		while (level + 1 < mNumLevels)
+		{
+			const uint64 nextBucketSize = (uint64)1 << (level + 1);
+			if ((i & (nextBucketSize - 1)) != 0 || i + nextBucketSize - 1 > lastSampleIndex)
+				break;
+
+			level++;
+		}
+
+		if (level == 0)
+		{
+			const double value = channel->GetSample(i);
+			minValue = Min<double>(minValue, value);
+			maxValue = Max<double>(maxValue, value);
+			sum += value;
+			i++;
+		}
+		else
+		{
+			const Bucket& bucket = GetBucket(level, i >> level);
+			minValue = Min<double>(minValue, bucket.mMin);
+			maxValue = Max<double>(maxValue, bucket.mMax);
+			sum += bucket.mSum;
+			i += (uint64)1 << level;
+		}
+	}
+
+	*outMin = minValue;
+	*outMax = maxValue;
+	if (outSum != NULL)
+		*outSum = sum;
+}
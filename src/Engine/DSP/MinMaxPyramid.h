@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+#ifndef __NEUROMORE_MINMAXPYRAMID_H
+#define __NEUROMORE_MINMAXPYRAMID_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+#include "Channel.h"
+
+
+// Incrementally maintained min/max/sum decimation pyramid of a channel, for fast range queries (e.g. waveform rendering).
+// Level l holds one bucket per 2^l samples (level 0 are the samples of the channel itself). Only the new samples of the
+// channel are added on each Update(); the buckets are kept in ring buffers that cover the same time range as the channel.
+class ENGINE_API MinMaxPyramid
+{
+	public:
+		// constructor & destructor
+		MinMaxPyramid();
+		virtual ~MinMaxPyramid();
+
+		// add all new samples of the channel (rebuilds the pyramid if the channel was changed, cleared or has grown)
+		// pass the ID of the source channel when updating from alternating copies of it (see ChannelSnapshot)
+		void Update(Channel<double>* channel, uint32 channelID = CORE_INVALIDINDEX32);
+
+		// clear everything
+		void Reset();
+
+		uint32 GetNumLevels() const												{ return mNumLevels; }
+		uint32 GetChannelID() const												{ return mChannelID; }
+
+		// calculate minimum, maximum and sum of the samples in the (inclusive) index range; the indices must be valid in the channel and already added to the pyramid
+		void FindMinMax(Channel<double>* channel, uint64 firstSampleIndex, uint64 lastSampleIndex, double* outMin, double* outMax, double* outSum = NULL) const;
+
+	private:
+		struct Bucket
+		{
+			double mMin;
+			double mMax;
+			double mSum;
+		};
+
+		void Init(Channel<double>* channel, uint32 channelID, uint32 capacity);
+		void AddSample(uint64 sampleIndex, double value);
+
+		inline const Bucket& GetBucket(uint32 level, uint64 bucketIndex) const		{ return mBuckets[mLevelOffsets[level] + (uint32)(bucketIndex & mLevelMasks[level])]; }
+		inline Bucket& GetBucket(uint32 level, uint64 bucketIndex)					{ return mBuckets[mLevelOffsets[level] + (uint32)(bucketIndex & mLevelMasks[level])]; }
+
+		Core::Array<Bucket>		mBuckets;			// ring buffers of all levels
+		Core::Array<uint32>		mLevelOffsets;		// start of each level in the bucket array (index 0 is unused)
+		Core::Array<uint64>		mLevelMasks;		// ring buffer size - 1 of each level (power of two)
+		uint32					mNumLevels;			// number of levels including level 0
+		uint32					mCapacity;			// number of samples the pyramid can cover
+
+		// the channel the pyramid was built from
+		uint32					mChannelID;
+		uint64					mNextSampleIndex;	// index of the next sample that has to be added
+};
+
+
+#endif
@@ -50,6 +50,23 @@ void MultiChannel::AddChannel(ChannelBase* channel)
 	//CORE_ASSERT(IsCompatible(channel) == true);
 
 	mChannels.Add(channel);
+
+	// the set is not a block anymore
+	mBlock = NULL;
+}
+
+
+// use the channels of a block buffer
+void MultiChannel::SetBlock(MultiChannelBlock* block)
+{
+	CORE_ASSERT(block != NULL);
+	mChannels.Clear();
+
+	const uint32 numChannels = block->GetNumChannels();
+	for (uint32 i=0; i<numChannels; ++i)
+		mChannels.Add(block->GetChannel(i));
+
+	mBlock = block;
 }
 
 
@@ -57,10 +74,15 @@ void MultiChannel::AddChannel(ChannelBase* channel)
 void MultiChannel::AddMultiChannel(MultiChannel* channels)
 {
 	CORE_ASSERT(channels != NULL);
+	const bool wasEmpty = mChannels.IsEmpty();
 
 	const uint32 numChannels = channels->GetNumChannels();
 	for (uint32 i=0; i<numChannels; ++i)
 		AddChannel(channels->GetChannel(i));
+
+	// an empty set that takes over all channels of a block is the block
+	if (wasEmpty == true)
+		mBlock = channels->GetBlock();
 }
 
 
@@ -155,12 +177,87 @@ bool MultiChannel::IsHighlighted() const
 // set buffer size of all channels
 void MultiChannel::SetBufferSize(uint32 numSamples, bool discard)
 {
+	// block channels are resized together
+	if (mBlock != NULL)
+	{
+		mBlock->SetBufferSize(numSamples, discard);
+		return;
+	}
+
 	const uint32 numChannels = mChannels.Size();
 	for (uint32 i=0; i<numChannels; ++i)
 		mChannels[i]->SetBufferSize(numSamples, discard);
 }
 
 
+// set the growth limit of all buffers
+void MultiChannel::SetMaxBufferSize(uint32 numSamples)
+{
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		mChannels[i]->SetMaxBufferSize(numSamples);
+}
+
+
+// grow the buffers lagging readers asked for
+bool MultiChannel::ApplyRequestedBufferSize()
+{
+	const uint32 numChannels = mChannels.Size();
+
+	// block channels are resized together
+	if (mBlock != NULL)
+	{
+		uint32 requestedSize = 0;
+		for (uint32 i=0; i<numChannels; ++i)
+		{
+			requestedSize = Core::Max(requestedSize, mChannels[i]->GetRequestedBufferSize());
+			mChannels[i]->ClearRequestedBufferSize();
+		}
+
+		if (requestedSize <= mBlock->GetBufferSize())
+			return false;
+
+		mBlock->SetBufferSize(requestedSize, false);
+		return true;
+	}
+
+	bool resized = false;
+	for (uint32 i=0; i<numChannels; ++i)
+	{
+		ChannelBase* channel = mChannels[i];
+		const uint32 requestedSize = channel->GetRequestedBufferSize();
+		if (requestedSize > channel->GetBufferSize())
+		{
+			channel->SetBufferSize(requestedSize, false);
+			resized = true;
+		}
+
+		channel->ClearRequestedBufferSize();
+	}
+
+	return resized;
+}
+
+
+uint32 MultiChannel::GetMaxHighWaterMark() const
+{
+	uint32 highWaterMark = 0;
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		highWaterMark = Core::Max(highWaterMark, mChannels[i]->GetHighWaterMark());
+
+	return highWaterMark;
+}
+
+
+void MultiChannel::ResetHighWaterMarks()
+{
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		mChannels[i]->ResetHighWaterMark();
+}
+
+
 uint32 MultiChannel::GetMinBufferSize() const
 {
 	const uint32 numChannels = mChannels.Size();
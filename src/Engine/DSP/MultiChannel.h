@@ -27,6 +27,7 @@
 // include required headers
 #include "../Config.h"
 #include "Channel.h"
+#include "MultiChannelBlock.h"
 
 
 // the MultiChannel class
@@ -34,7 +35,7 @@ class ENGINE_API MultiChannel
 {
 	public:
 		// constructors & destructor
-		MultiChannel()										 	{}
+		MultiChannel()										 	{ mBlock = NULL; }
 		virtual ~MultiChannel()									{}
 		
 		virtual uint32 GetNumChannels() const					{ return mChannels.Size(); }
@@ -51,7 +52,11 @@ class ENGINE_API MultiChannel
 		void SetMultiChannel(MultiChannel* channels);
 
 		// remove all channels from the set
-		void Clear()											{ mChannels.Clear(); }
+		void Clear()											{ mChannels.Clear(); mBlock = NULL; }
+
+		// use the channels of a block buffer (see MultiChannelBlock); the block is kept as long as the set contains exactly its channels
+		void SetBlock(MultiChannelBlock* block);
+		MultiChannelBlock* GetBlock() const						{ return mBlock; }
 
 		// reset all channels in the set
 		void Reset();
@@ -76,6 +81,12 @@ class ENGINE_API MultiChannel
 
 		uint32 GetMinBufferSize() const;
 		bool IsBuffer() const;
+
+		// adaptive buffer size (see ChannelBase::UpdateHighWaterMark): set the growth limit, and grow the buffers that lagging readers asked for (keeps the samples)
+		void SetMaxBufferSize(uint32 numSamples);
+		bool ApplyRequestedBufferSize();			// returns true if a buffer was resized
+		uint32 GetMaxHighWaterMark() const;
+		void ResetHighWaterMarks();
 		uint32 CalculateMemoryAllocated(bool countBuffersOnly = false);
 		uint32 CalculateMemoryUsed(bool countBuffersOnly = false);
 
@@ -84,6 +95,7 @@ class ENGINE_API MultiChannel
 
 	private:
 		Core::Array<ChannelBase*>  mChannels;
+		MultiChannelBlock*         mBlock;			// the block buffer the channels are stored in (NULL if they are independent channels)
 
 		// check set for constistency
 		bool Validate();
@@ -0,0 +1,232 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "MultiChannelBlock.h"
+#include "../Core/BlockMath.h"
+
+
+using namespace Core;
+
+// constructor
+MultiChannelBlock::MultiChannelBlock()
+{
+	mSampleRate = 0.0;
+	mBufferSize = 0;
+}
+
+
+// destructor
+MultiChannelBlock::~MultiChannelBlock()
+{
+	Release();
+}
+
+
+// create the channel views
+void MultiChannelBlock::Init(uint32 numChannels, double sampleRate, uint32 bufferSize)
+{
+	Release();
+
+	mSampleRate = sampleRate;
+	mBufferSize = Max<uint32>(1, bufferSize);
+	mSamples.Resize(numChannels * mBufferSize);
+
+	mChannels.Resize(numChannels);
+	for (uint32 i=0; i<numChannels; ++i)
+	{
+		Channel<double>* channel = new Channel<double>(sampleRate);
+		channel->SetExternalBuffer(GetPlane(i), mBufferSize);
+		mChannels[i] = channel;
+	}
+}
+
+
+// delete the channel views and the buffer
+void MultiChannelBlock::Release()
+{
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		delete mChannels[i];
+
+	mChannels.Clear();
+	mSamples.Clear();
+	mBufferSize = 0;
+}
+
+
+// set the sample rate of all channels
+void MultiChannelBlock::SetSampleRate(double sampleRate)
+{
+	mSampleRate = sampleRate;
+
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		mChannels[i]->SetSampleRate(sampleRate);
+}
+
+
+// set the start time of all channels
+void MultiChannelBlock::SetStartTime(const Time& time)
+{
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		mChannels[i]->SetStartTime(time);
+}
+
+
+// resize the buffers of all channels
+void MultiChannelBlock::SetBufferSize(uint32 numSamples, bool discard)
+{
+	numSamples = Max<uint32>(1, numSamples);
+	if (numSamples == mBufferSize)
+	{
+		if (discard == true)
+			Clear();
+		return;
+	}
+
+	const uint32 numChannels = mChannels.Size();
+	Array<double> samples;
+	samples.Resize(numChannels * numSamples);
+
+	// move the newest samples of each channel to their position in the new circular buffer
+	if (discard == false)
+	{
+		for (uint32 c=0; c<numChannels; ++c)
+		{
+			Channel<double>* channel = mChannels[c];
+			const uint64 numKept = Min<uint64>(channel->GetNumSamples(), numSamples);
+			const uint64 endIndex = channel->GetSampleCounter();
+
+			// channels that left the block (resized on their own) keep their samples in their own memory: copy them back, so the sample counters stay valid after re-attaching
+			if (channel->GetExternalBuffer() != GetPlane(c))
+			{
+				for (uint64 i=endIndex-numKept; i<endIndex; ++i)
+					samples[c * numSamples + (uint32)(i % numSamples)] = channel->GetSample(i);
+				continue;
+			}
+
+			for (uint64 i=endIndex-numKept; i<endIndex; ++i)
+				samples[c * numSamples + (uint32)(i % numSamples)] = mSamples[c * mBufferSize + GetBufferIndex(i)];
+		}
+	}
+
+	mSamples = samples;
+	mBufferSize = numSamples;
+
+	for (uint32 c=0; c<numChannels; ++c)
+	{
+		mChannels[c]->SetExternalBuffer(GetPlane(c), mBufferSize);
+		if (discard == true)
+			mChannels[c]->Clear();
+	}
+}
+
+
+// remove all samples
+void MultiChannelBlock::Clear()
+{
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		mChannels[i]->Clear();
+}
+
+
+// check if all channels can be processed as a block
+bool MultiChannelBlock::IsInSync() const
+{
+	const uint32 numChannels = mChannels.Size();
+	if (numChannels == 0)
+		return false;
+
+	const uint64 sampleCounter = mChannels[0]->GetSampleCounter();
+	for (uint32 i=0; i<numChannels; ++i)
+	{
+		if (mChannels[i]->GetExternalBuffer() != GetPlane(i) || mChannels[i]->GetSampleCounter() != sampleCounter)
+			return false;
+	}
+
+	return true;
+}
+
+
+// add one sample to each channel
+void MultiChannelBlock::AddFrame(const double* values)
+{
+	CORE_ASSERT(IsInSync() == true);
+
+	const uint32 bufferIndex = GetBufferIndex(GetSampleCounter());
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+	{
+		mSamples[i * mBufferSize + bufferIndex] = values[i];
+		mChannels[i]->AddExternalSamples(1);
+	}
+}
+
+
+// add a linear combination of the input channels to each channel
+void MultiChannelBlock::AddLinearCombination(const MultiChannelBlock& input, const double* matrix, uint64 firstSampleIndex, uint32 numSamples)
+{
+	CORE_ASSERT(&input != this);
+	CORE_ASSERT(IsInSync() == true);
+
+	const uint32 numInputs = input.GetNumChannels();
+	const uint32 numOutputs = mChannels.Size();
+	const uint64 outputSampleCounter = GetSampleCounter();
+
+	// process tiles of samples that are contiguous in both the input and the output buffers; the tiles are short enough
+	// that the input samples stay in the cache while all output channels are calculated from them
+	const uint32 maxTileSize = 256;
+	uint32 numProcessed = 0;
+	while (numProcessed < numSamples)
+	{
+		const uint32 inputIndex = input.GetBufferIndex(firstSampleIndex + numProcessed);
+		const uint32 outputIndex = GetBufferIndex(outputSampleCounter + numProcessed);
+		const uint32 numRunSamples = Min( Min(numSamples - numProcessed, maxTileSize), Min(input.mBufferSize - inputIndex, mBufferSize - outputIndex) );
+
+		for (uint32 o=0; o<numOutputs; ++o)
+		{
+			double* out = GetPlane(o) + outputIndex;
+			const double* weights = matrix + o * numInputs;
+
+			MemSet(out, 0, numRunSamples * sizeof(double));
+			for (uint32 i=0; i<numInputs; ++i)
+			{
+				// sparse matrices (e.g. Laplacian montages) skip most of the inputs
+				if (weights[i] != 0.0)
+					BlockMath::AddScaled(input.GetPlane(i) + inputIndex, weights[i], out, numRunSamples);
+			}
+		}
+
+		numProcessed += numRunSamples;
+	}
+
+	for (uint32 o=0; o<numOutputs; ++o)
+		mChannels[o]->AddExternalSamples(numSamples);
+}
@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_MULTICHANNELBLOCK_H
+#define __NEUROMORE_MULTICHANNELBLOCK_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+#include "../Core/Time.h"
+#include "Channel.h"
+
+
+// Block storage for a group of channels with the same sample rate (e.g. the outputs of a channel merger).
+// The circular buffers of all channels are kept in one allocation, channel after channel (planar), and the channels are views on it
+// that behave exactly like normal channels. As long as the channels are fed in lock step, spatial operations can work directly on the
+// sample planes, a contiguous run of samples per channel at a time, instead of going through the channels sample by sample.
+class ENGINE_API MultiChannelBlock
+{
+	public:
+		// constructor & destructor
+		MultiChannelBlock();
+		~MultiChannelBlock();
+
+		// create the channel views (the old ones are deleted)
+		void Init(uint32 numChannels, double sampleRate, uint32 bufferSize);
+		void Release();
+
+		uint32 GetNumChannels() const											{ return mChannels.Size(); }
+		Channel<double>* GetChannel(uint32 index) const							{ return mChannels[index]; }
+
+		// properties shared by all channels
+		void SetSampleRate(double sampleRate);
+		double GetSampleRate() const											{ return mSampleRate; }
+		void SetStartTime(const Core::Time& time);
+
+		// resize the buffers of all channels; the newest samples are kept if they are not discarded
+		void SetBufferSize(uint32 numSamples, bool discard = true);
+		uint32 GetBufferSize() const											{ return mBufferSize; }
+
+		// remove all samples
+		void Clear();
+
+		// true if all channels still use the block buffer and have the same number of samples, only then the block functions below can be used
+		bool IsInSync() const;
+		uint64 GetSampleCounter() const											{ return (mChannels.IsEmpty() ? 0 : mChannels[0]->GetSampleCounter()); }
+
+		//
+		// block access
+		//
+
+		// circular buffer of one channel
+		double* GetPlane(uint32 channelIndex)									{ return mSamples.GetPtr() + channelIndex * mBufferSize; }
+		const double* GetPlane(uint32 channelIndex) const						{ return mSamples.GetPtr() + channelIndex * mBufferSize; }
+		uint32 GetBufferIndex(uint64 sampleIndex) const							{ return (uint32)(sampleIndex % mBufferSize); }
+
+		// add one sample to each channel (values in channel order)
+		void AddFrame(const double* values);
+
+		// add a linear combination of the input channels to each channel: out[o][t] = sum_i matrix[o * numInputs + i] * in[i][firstSampleIndex + t]
+		// the input samples must be valid in all input channels (the input block doesn't have to be in sync as a whole)
+		void AddLinearCombination(const MultiChannelBlock& input, const double* matrix, uint64 firstSampleIndex, uint32 numSamples);
+
+		// memory usage
+		uint64 CalculateMemoryAllocated() const									{ return (uint64)mSamples.Size() * sizeof(double); }
+
+	private:
+		Core::Array<double>				mSamples;			// the circular buffers of all channels, one after another
+		Core::Array<Channel<double>*>	mChannels;			// the channel views
+		double							mSampleRate;
+		uint32							mBufferSize;		// number of samples per channel
+};
+
+
+#endif
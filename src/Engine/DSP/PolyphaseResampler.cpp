@@ -0,0 +1,274 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required files
+#include "PolyphaseResampler.h"
+#include "WindowFunction.h"
+#include "../Core/Math.h"
+
+
+using namespace Core;
+
+// transition band: the passband ends at this fraction of the lower of both nyquist frequencies
+#define POLYPHASE_PASSBAND_RATIO		0.9
+
+// largest upsampling factor L that is used for rational ratios (= number of filter phases)
+#define POLYPHASE_MAX_UPFACTOR			256
+
+// number of phases for arbitrary ratios (intermediate phases are interpolated linearly)
+#define POLYPHASE_NUM_ARBITRARY_PHASES	128
+
+
+// constructor
+PolyphaseResampler::PolyphaseResampler()
+{
+	mNumChannels	= 0;
+	mIsRational		= false;
+	mUpFactor		= 1;
+	mDownFactor		= 1;
+	mStep			= 1.0;
+	mNumPhases		= 0;
+	mNumTaps		= 0;
+	mWritePos		= 0;
+	mPhase			= 0;
+	mFraction		= 0.0;
+}
+
+
+// destructor
+PolyphaseResampler::~PolyphaseResampler()
+{
+}
+
+
+// design the filter bank for the given sample rates
+bool PolyphaseResampler::Init(double inputSampleRate, double outputSampleRate, uint32 numChannels, uint32 numZeroCrossings)
+{
+	mNumChannels = 0;
+
+	if (inputSampleRate <= 0.0 || outputSampleRate <= 0.0 || numChannels == 0 || numZeroCrossings == 0)
+		return false;
+
+	// output samples per input sample
+	const double ratio = outputSampleRate / inputSampleRate;
+	mStep = 1.0 / ratio;
+
+	// use exact phases for rational ratios, interpolated phases otherwise
+	mIsRational = FindRationalRatio(ratio, POLYPHASE_MAX_UPFACTOR, &mUpFactor, &mDownFactor);
+	if (mIsRational == true)
+	{
+		mNumPhases = mUpFactor;
+	}
+	else
+	{
+		mUpFactor = 1;
+		mDownFactor = 1;
+		mNumPhases = POLYPHASE_NUM_ARBITRARY_PHASES;
+	}
+
+	// lowpass cutoff in cycles per input sample (anti-aliasing for downsampling, anti-imaging for upsampling)
+	const double cutoff = 0.5 * Min(1.0, ratio) * POLYPHASE_PASSBAND_RATIO;
+	DesignFilterBank(cutoff, numZeroCrossings);
+
+	// allocate the channel histories
+	mNumChannels = numChannels;
+	mHistory.Resize(2 * mNumTaps * mNumChannels);
+	Reset();
+
+	return true;
+}
+
+
+// clear history and output phase
+void PolyphaseResampler::Reset()
+{
+	if (mHistory.Size() > 0)
+		MemSet(mHistory.GetPtr(), 0, mHistory.Size() * sizeof(double));
+
+	mWritePos	= 0;
+	mPhase		= 0;
+	mFraction	= 0.0;
+}
+
+
+uint32 PolyphaseResampler::CalcMaxNumOutputSamples(uint32 numInputSamples) const
+{
+	return (uint32)Math::CeilD(numInputSamples / mStep) + 1;
+}
+
+
+// run the filter bank over a block of samples
+uint32 PolyphaseResampler::Process(const double* const* inputs, uint32 numInputSamples, double* const* outputs)
+{
+	if (IsInitialized() == false)
+		return 0;
+
+	const uint32 numTaps = mNumTaps;
+	const uint32 historySize = 2 * numTaps;
+	double* histories = mHistory.GetPtr();
+	const double* coefficients = mCoefficients.GetPtr();
+
+	uint32 numOutputSamples = 0;
+	for (uint32 n = 0; n < numInputSamples; ++n)
+	{
+		// 1) push the new frame into the histories
+		for (uint32 c = 0; c < mNumChannels; ++c)
+		{
+			double* history = histories + c * historySize;
+			const double sample = inputs[c][n];
+			history[mWritePos] = sample;
+			history[mWritePos + numTaps] = sample;
+		}
+
+		mWritePos++;
+		if (mWritePos == numTaps)
+			mWritePos = 0;
+
+		// 2) calculate all output samples that fall between this and the next input sample
+		if (mIsRational == true)
+		{
+			while (mPhase < mUpFactor)
+			{
+				const double* phaseCoeffs = coefficients + mPhase * numTaps;
+				for (uint32 c = 0; c < mNumChannels; ++c)
+					outputs[c][numOutputSamples] = Convolve(phaseCoeffs, histories + c * historySize + mWritePos);
+
+				numOutputSamples++;
+				mPhase += mDownFactor;
+			}
+
+			mPhase -= mUpFactor;
+		}
+		else
+		{
+			while (mFraction < 1.0)
+			{
+				const double position = mFraction * mNumPhases;
+				const uint32 phase = (uint32)position;
+				const double weight = position - phase;
+
+				const double* phaseCoeffs = coefficients + phase * numTaps;
+				for (uint32 c = 0; c < mNumChannels; ++c)
+				{
+					const double* window = histories + c * historySize + mWritePos;
+					const double a = Convolve(phaseCoeffs, window);
+					const double b = Convolve(phaseCoeffs + numTaps, window);
+					outputs[c][numOutputSamples] = a + weight * (b - a);
+				}
+
+				numOutputSamples++;
+				mFraction += mStep;
+			}
+
+			mFraction -= 1.0;
+		}
+	}
+
+	return numOutputSamples;
+}
+
+
+// find the best rational approximation with a small numerator (continued fraction expansion)
+bool PolyphaseResampler::FindRationalRatio(double ratio, uint32 maxUpFactor, uint32* outUp, uint32* outDown)
+{
+	const double epsilon = 1e-9;
+
+	// convergents p/q
+	double p0 = 0.0, q0 = 1.0;
+	double p1 = 1.0, q1 = 0.0;
+	double x = ratio;
+
+	for (uint32 i = 0; i < 32; ++i)
+	{
+		const double a = Math::FloorD(x);
+		const double p2 = a * p1 + p0;
+		const double q2 = a * q1 + q0;
+
+		if (p2 > maxUpFactor || q2 > CORE_INT32_MAX)
+			return false;
+
+		if (Math::AbsD(p2 / q2 - ratio) <= epsilon * ratio)
+		{
+			*outUp = (uint32)p2;
+			*outDown = (uint32)q2;
+			return true;
+		}
+
+		const double remainder = x - a;
+		if (remainder < epsilon)
+			return false;
+
+		x = 1.0 / remainder;
+		p0 = p1; q0 = q1;
+		p1 = p2; q1 = q2;
+	}
+
+	return false;
+}
+
+
+// windowed sinc lowpass at the upsampled rate, decomposed into its phases
+void PolyphaseResampler::DesignFilterBank(double cutoff, uint32 numZeroCrossings)
+{
+	// the filter must contain the given number of sinc zero crossings on each side
+	mNumTaps = 2 * (uint32)Math::CeilD(numZeroCrossings / (2.0 * cutoff));
+
+	const uint32 numPhases = mNumPhases;
+	const uint32 length = mNumTaps * numPhases;
+	const double center = 0.5 * length;
+
+	WindowFunction window;
+	window.SetType(WindowFunction::WINDOWFUNCTION_BLACKMAN);
+
+	// one extra phase so the arbitrary ratio interpolation can always access the next phase
+	mCoefficients.Resize((numPhases + 1) * mNumTaps);
+	for (uint32 p = 0; p <= numPhases; ++p)
+	{
+		double* phaseCoeffs = mCoefficients.GetPtr() + p * mNumTaps;
+
+		double sum = 0.0;
+		for (uint32 i = 0; i < mNumTaps; ++i)
+		{
+			// prototype index of tap i (taps are stored from oldest to newest sample)
+			const uint32 index = p + (mNumTaps - 1 - i) * numPhases;
+
+			// time relative to the filter center, in input samples
+			const double t = (index - center) / numPhases;
+			const double x = 2.0 * cutoff * t;
+			const double sinc = (x == 0.0) ? 1.0 : Math::SinD(Math::piD * x) / (Math::piD * x);
+
+			phaseCoeffs[i] = sinc * window.Evaluate(index, length + 1);
+			sum += phaseCoeffs[i];
+		}
+
+		// unity DC gain for every phase
+		if (sum != 0.0)
+		{
+			for (uint32 i = 0; i < mNumTaps; ++i)
+				phaseCoeffs[i] /= sum;
+		}
+	}
+}
@@ -0,0 +1,110 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+#ifndef __NEUROMORE_POLYPHASERESAMPLER_H
+#define __NEUROMORE_POLYPHASERESAMPLER_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+
+
+// Polyphase FIR sample rate converter. The anti-alias lowpass and the decimation are done in one step: only the output
+// samples that are actually needed are calculated, each one from a single phase of the (windowed sinc) prototype filter.
+// Rational ratios (e.g. 2000 Hz -> 128 Hz = 8/125) use one exact phase per output position; arbitrary ratios interpolate
+// linearly between the two nearest phases of a finely sampled filter bank.
+// All channels share the filter bank and the output clock, they are processed in lockstep frame by frame.
+class ENGINE_API PolyphaseResampler
+{
+	public:
+		// constructor & destructor
+		PolyphaseResampler();
+		virtual ~PolyphaseResampler();
+
+		// design filter bank and allocate channel histories; returns false if the sample rates are invalid
+		bool Init(double inputSampleRate, double outputSampleRate, uint32 numChannels = 1, uint32 numZeroCrossings = 8);
+		bool IsInitialized() const												{ return mNumChannels > 0; }
+
+		// clear history and output phase (filter bank is kept)
+		void Reset();
+
+		// configuration
+		uint32 GetNumChannels() const											{ return mNumChannels; }
+		bool IsRational() const													{ return mIsRational; }
+		uint32 GetUpFactor() const												{ return mUpFactor; }
+		uint32 GetDownFactor() const											{ return mDownFactor; }
+		uint32 GetNumPhases() const												{ return mNumPhases; }
+		uint32 GetNumTapsPerPhase() const										{ return mNumTaps; }
+
+		// group delay of the filter, in input samples
+		uint32 GetDelay() const													{ return mNumTaps / 2; }
+
+		// upper bound for the number of output samples (per channel) that can be produced from the given number of input samples
+		uint32 CalcMaxNumOutputSamples(uint32 numInputSamples) const;
+
+		// process a block of planar input samples (one array per channel); returns the number of samples written to each output array
+		uint32 Process(const double* const* inputs, uint32 numInputSamples, double* const* outputs);
+
+		// single channel convenience version
+		uint32 Process(const double* input, uint32 numInputSamples, double* output)		{ return Process(&input, numInputSamples, &output); }
+
+	private:
+		// find L/M with small numbers that matches the ratio; returns false if there is none
+		static bool FindRationalRatio(double ratio, uint32 maxUpFactor, uint32* outUp, uint32* outDown);
+
+		// windowed sinc prototype lowpass, split into phases
+		void DesignFilterBank(double cutoff, uint32 numZeroCrossings);
+
+		// dot product of one filter phase with the history window of a channel
+		inline double Convolve(const double* coeffs, const double* history) const
+		{
+			double sum = 0.0;
+			for (uint32 i = 0; i < mNumTaps; ++i)
+				sum += coeffs[i] * history[i];
+			return sum;
+		}
+
+		// configuration
+		uint32					mNumChannels;
+		bool					mIsRational;
+		uint32					mUpFactor;			// L (rational mode only)
+		uint32					mDownFactor;		// M (rational mode only)
+		double					mStep;				// input samples per output sample
+		uint32					mNumPhases;			// number of filter phases (L in rational mode)
+		uint32					mNumTaps;			// filter taps per phase
+
+		// filter bank: (mNumPhases+1) rows of mNumTaps coefficients, ordered oldest to newest sample
+		Core::Array<double>		mCoefficients;
+
+		// per channel history; every sample is written twice so the newest mNumTaps samples are always contiguous
+		Core::Array<double>		mHistory;
+		uint32					mWritePos;
+
+		// output position relative to the newest input sample
+		uint32					mPhase;				// in 1/L input samples (rational mode)
+		double					mFraction;			// in input samples (arbitrary mode)
+};
+
+
+#endif
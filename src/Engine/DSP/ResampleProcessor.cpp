@@ -174,6 +174,10 @@ void ResampleProcessor::ReInit()
 	mSamplingKernel.SetLength(mKernelSize);
 	mSamplingKernel.SetWindowFunction(NULL);		// use boxcar window
 
+	// design polyphase filter bank
+	if (mSettings.mResampleAlgo == FIR)
+		mPolyphaseResampler.Init(inputSampleRate, outputSampleRate);
+
 	// setup clock
 	mOutputClock.Reset();
 
@@ -181,6 +185,7 @@ void ResampleProcessor::ReInit()
 	{
 		// case 0: no clock required
 		case FORWARD:
+		case FIR:
 			mOutputClock.SetReferenceChannel(NULL);
 			mOutputClock.Stop();
 			break;
@@ -272,6 +277,9 @@ uint32 ResampleProcessor::GetDelay(uint32 inputPortIndex, uint32 outputPortIndex
 		case BOXCAR:
 			return mIntFactor;
 
+		case FIR:
+			return mPolyphaseResampler.GetDelay();
+
 		default:
 			return 0;
 	}
@@ -387,6 +395,22 @@ ResampleProcessor::EResampleAlgo ResampleProcessor::SelectAlgorithm(EResampleTyp
 		}
 	}
 
+	// best quality resampling
+	else if (mode == BEST_QUALITY)
+	{
+		switch (type)
+		{
+			case UPSAMPLE_INTEGER:
+			case UPSAMPLE_FRACTIONAL:
+			case DOWNSAMPLE_INTEGER:
+			case DOWNSAMPLE_FRACTIONAL:
+				selectedAlgo = FIR;
+				break;
+
+			default: break;
+		}
+	}
+
 	mSettings.mResampleAlgo = selectedAlgo;
 
 	// return selected mode enum
@@ -406,6 +430,7 @@ ResampleProcessor::ResampleFunction ResampleProcessor::GetResampleFunction(EResa
 		case NEAREST_NEIGHBOR:		selectedFunction = &ResampleProcessor::DoNearestNeighbor;	break;
 		case LINEAR_INTERPOLATE:	selectedFunction = &ResampleProcessor::DoLinearInterpolate;	break;
 		case BOXCAR:				selectedFunction = &ResampleProcessor::DoBoxcar;			break;
+		case FIR:					selectedFunction = &ResampleProcessor::DoPolyphaseFIR;		break;
         default:                                                                                break;
 	}
 
@@ -544,3 +569,28 @@ void ResampleProcessor::DoBoxcar()
 	// flush input reader (not used here)
 	GetInputReader()->Flush();
 }
+
+
+// polyphase FIR resampling: filters and resamples all new input samples as one block
+void ResampleProcessor::DoPolyphaseFIR()
+{
+	ChannelReader* inputReader = GetInputReader();
+	Channel<double>* output = GetOutput()->AsType<double>();
+
+	const uint32 numNewSamples = inputReader->GetNumNewSamples();
+	if (numNewSamples == 0)
+		return;
+
+	// collect the new input samples
+	mInputBlock.Resize(numNewSamples);
+	for (uint32 i = 0; i < numNewSamples; i++)
+		mInputBlock[i] = inputReader->PopOldestSample<double>();
+
+	// resample the block
+	mOutputBlock.Resize(mPolyphaseResampler.CalcMaxNumOutputSamples(numNewSamples));
+	const uint32 numOutputSamples = mPolyphaseResampler.Process(mInputBlock.GetPtr(), numNewSamples, mOutputBlock.GetPtr());
+
+	// push all output samples into the output
+	for (uint32 i = 0; i < numOutputSamples; i++)
+		output->AddSample(mOutputBlock[i]);
+}
@@ -28,6 +28,7 @@
 #include "../Config.h"
 #include "ChannelProcessor.h"
 #include "ClockGenerator.h"
+#include "PolyphaseResampler.h"
 
 
 // takes spectrums from an input SpectrumChannel, processes them and produces spectrums at the output (via baseclass)
@@ -52,14 +53,14 @@ class ENGINE_API ResampleProcessor : public ChannelProcessor
 			FIRST_ORDER_HOLD	,	// like linear interpolate, but predicts the future			up/both/fast/synced_ahead			-> not used
 			LINEAR_INTERPOLATE	,	// interpolate linear in realtime between samples			up/both/good/synced					-> used for medium	upsampling
 			BOXCAR 				,   // simple average with integer-sized boxcar kernel			down/both/good/synced				-> used for medium	downsampling
-			FIR					,   // Up+Fir+Down Resampling method using int ratios			both/both/best/synced				-> used for good	up/downsampling
+			FIR					,   // polyphase FIR, anti-alias filter and decimation in one step	both/both/best/blocks				-> used for best	up/downsampling
 		};
 
 		enum EResampleMode
 		{
 			REALTIME			,	// the fastest (zero-delay) algorithm is chosen
 			GOOD_QUALITY		,	// the algorithm with good quality (but not perfect) is chosen; induces a certain delay
-			BEST_QUALITY		,	// not used right now
+			BEST_QUALITY		,	// the polyphase FIR resampler is chosen; induces the filter group delay
 			MANUAL				,	// the selected algorithm is used
 		};
 		
@@ -107,6 +108,7 @@ class ENGINE_API ResampleProcessor : public ChannelProcessor
 		void SetOutputSampleRate(double sampleRate)								{ mSettings.mTargetSampleRate = sampleRate; }
 		void SetResampleMode(EResampleMode mode)								{ mSettings.mResampleMode = mode; }
 		void SetResampleAlgo(EResampleAlgo algo)								{ mSettings.mResampleAlgo = algo; }
+		EResampleAlgo GetResampleAlgo() const									{ return mSettings.mResampleAlgo; }
 		void SetStartTime(Core::Time startTime)									{ mSettings.mStartTime = startTime; }
 
 		// DSP related properties
@@ -130,6 +132,7 @@ class ENGINE_API ResampleProcessor : public ChannelProcessor
 		void CORE_CDECL DoNearestNeighbor();
 		void CORE_CDECL DoLinearInterpolate();
 		void CORE_CDECL DoBoxcar();
+		void CORE_CDECL DoPolyphaseFIR();
 
 		Settings			mSettings;
 
@@ -140,6 +143,11 @@ class ENGINE_API ResampleProcessor : public ChannelProcessor
 		Epoch				mSamplingKernel;
 
 		ClockGenerator		mOutputClock;
+
+		// polyphase FIR resampler and its sample blocks
+		PolyphaseResampler	mPolyphaseResampler;
+		Core::Array<double>	mInputBlock;
+		Core::Array<double>	mOutputBlock;
 };
 
 
@@ -0,0 +1,267 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "SignalGenerator.h"
+#include "../Core/BlockMath.h"
+#include "../Core/Math.h"
+#include <atomic>
+
+
+using namespace Core;
+
+// seed of the next generator instance, so the noise of different generators is uncorrelated
+static std::atomic<uint64> gNextSeed(1);
+
+// constructor
+SignalGenerator::SignalGenerator(uint32 numChannels, double sampleRate)
+{
+	SetSeed(gNextSeed++);
+	Init(numChannels, sampleRate);
+}
+
+
+// destructor
+SignalGenerator::~SignalGenerator()
+{
+}
+
+
+// set the number of channels and the sample rate
+void SignalGenerator::Init(uint32 numChannels, double sampleRate)
+{
+	mSampleRate = sampleRate;
+
+	mChannels.Resize(numChannels);
+	for (uint32 i=0; i<numChannels; ++i)
+	{
+		ChannelState& state = mChannels[i];
+		state.mWaveform		= WAVEFORM_SINE;
+		state.mFrequency	= 1.0;
+		state.mAmplitude	= 1.0;
+		state.mOffset		= 0.0;
+		state.mDutyCycle	= 0.5;
+		ResetChannel(state);
+	}
+}
+
+
+// restart the random number generator
+void SignalGenerator::SetSeed(uint64 seed)
+{
+	// expand the seed with splitmix64, so similar seeds give different states (and the state is never zero)
+	for (uint32 i=0; i<2; ++i)
+	{
+		seed += 0x9E3779B97F4A7C15ULL;
+		uint64 z = seed;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		mRandomState[i] = z ^ (z >> 31);
+	}
+}
+
+
+// reset the phases and the noise filters of all channels
+void SignalGenerator::Reset()
+{
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 i=0; i<numChannels; ++i)
+		ResetChannel(mChannels[i]);
+}
+
+
+void SignalGenerator::ResetChannel(ChannelState& state)
+{
+	state.mPhase = 0.0;
+	for (uint32 i=0; i<7; ++i)
+		state.mPinkFilter[i] = 0.0;
+}
+
+
+// generate the next samples of all channels
+void SignalGenerator::Generate(uint32 numSamples, double* out, uint32 channelStride)
+{
+	const uint32 numChannels = mChannels.Size();
+	for (uint32 c=0; c<numChannels; ++c)
+		GenerateChannel(c, numSamples, out + c * channelStride);
+}
+
+
+// generate the next samples of a single channel
+void SignalGenerator::GenerateChannel(uint32 channel, uint32 numSamples, double* out)
+{
+	if (numSamples == 0)
+		return;
+
+	ChannelState& state = mChannels[channel];
+	switch (state.mWaveform)
+	{
+		case WAVEFORM_WHITENOISE:		GenerateWhiteNoise(numSamples, out);			break;
+		case WAVEFORM_GAUSSIANNOISE:	GenerateGaussianNoise(numSamples, out);		break;
+		case WAVEFORM_PINKNOISE:		GeneratePinkNoise(state, numSamples, out);		break;
+
+		// periodic waveforms: advance the phase accumulator by the whole block
+		default:
+		{
+			const double phaseIncrement = (mSampleRate > 0.0 ? state.mFrequency / mSampleRate : 0.0);
+			GenerateWaveform(state.mWaveform, state.mPhase, phaseIncrement, state.mDutyCycle, numSamples, out);
+			state.mPhase = WrapPhase(state.mPhase + numSamples * phaseIncrement);
+			break;
+		}
+	}
+
+	// scale to the amplitude and add the offset
+	if (state.mAmplitude != 1.0)
+		BlockMath::Scale(out, state.mAmplitude, out, numSamples);
+	if (state.mOffset != 0.0)
+		BlockMath::Offset(out, state.mOffset, out, numSamples);
+}
+
+
+// periodic waveform with values in [-1, 1]
+void SignalGenerator::GenerateWaveform(EWaveform waveform, double phase, double phaseIncrement, double dutyCycle, uint32 numSamples, double* out)
+{
+	// phases of the samples, in [0, 1)
+	for (uint32 i=0; i<numSamples; ++i)
+	{
+		const double samplePhase = phase + i * phaseIncrement;
+		out[i] = samplePhase - floor(samplePhase);
+	}
+
+	switch (waveform)
+	{
+		case WAVEFORM_SINE:
+			BlockMath::Scale(out, Math::twoPiD, out, numSamples);
+			BlockMath::FastSin(out, out, numSamples);
+			break;
+
+		case WAVEFORM_SQUARE:
+			for (uint32 i=0; i<numSamples; ++i)
+				out[i] = (out[i] < dutyCycle ? 1.0 : -1.0);
+			break;
+
+		case WAVEFORM_SAWTOOTH:
+			for (uint32 i=0; i<numSamples; ++i)
+				out[i] = 2.0 * out[i] - 1.0;
+			break;
+
+		case WAVEFORM_TRIANGLE:
+			for (uint32 i=0; i<numSamples; ++i)
+				out[i] = 1.0 - 4.0 * fabs(out[i] - 0.5);
+			break;
+
+		// not a periodic waveform
+		default:
+			CORE_ASSERT(false);
+			for (uint32 i=0; i<numSamples; ++i)
+				out[i] = 0.0;
+			break;
+	}
+}
+
+
+// uniformly distributed noise in [-1, 1]
+void SignalGenerator::GenerateWhiteNoise(uint32 numSamples, double* out)
+{
+	for (uint32 i=0; i<numSamples; ++i)
+		out[i] = 2.0 * NextRandom() - 1.0;
+}
+
+
+// normally distributed noise (Box-Muller transform)
+void SignalGenerator::GenerateGaussianNoise(uint32 numSamples, double* out)
+{
+	// each pair of uniform random numbers u1, u2 gives two gaussian ones: r * cos(theta) and r * sin(theta), with r = sqrt(-2 ln(u1)) and theta = 2 pi u2
+	const uint32 numPairs = (numSamples + 1) / 2;
+	mTempBuffer.Resize(4 * numPairs);
+
+	double* radius	= mTempBuffer.GetPtr();
+	double* angle	= radius + numPairs;
+	double* cosine	= angle + numPairs;
+	double* sine	= cosine + numPairs;
+
+	for (uint32 i=0; i<numPairs; ++i)
+	{
+		radius[i]	= 1.0 - NextRandom();		// (0, 1], log must not get a zero
+		angle[i]	= Math::twoPiD * NextRandom();
+	}
+
+	BlockMath::Log(radius, radius, numPairs);
+	BlockMath::Scale(radius, -2.0, radius, numPairs);
+	BlockMath::Sqrt(radius, radius, numPairs);
+	BlockMath::FastCos(angle, cosine, numPairs);
+	BlockMath::FastSin(angle, sine, numPairs);
+
+	const uint32 numFullPairs = numSamples / 2;
+	for (uint32 i=0; i<numFullPairs; ++i)
+	{
+		out[2*i]	= radius[i] * cosine[i];
+		out[2*i+1]	= radius[i] * sine[i];
+	}
+
+	// odd number of samples: the last sine is not used
+	if (numFullPairs < numPairs)
+		out[numSamples-1] = radius[numFullPairs] * cosine[numFullPairs];
+}
+
+
+// 1/f noise: gaussian noise filtered with Paul Kellet's refined pink noise filter (accurate to 0.05 dB above 9.2 Hz at 44.1 kHz)
+void SignalGenerator::GeneratePinkNoise(ChannelState& state, uint32 numSamples, double* out)
+{
+	GenerateGaussianNoise(numSamples, out);
+
+	// scales the output to a standard deviation of 1 (inverse energy of the filter's impulse response)
+	const double gain = 0.3275974;
+
+	double* b = state.mPinkFilter;
+	for (uint32 i=0; i<numSamples; ++i)
+	{
+		const double white = out[i];
+		b[0] = 0.99886 * b[0] + white * 0.0555179;
+		b[1] = 0.99332 * b[1] + white * 0.0750759;
+		b[2] = 0.96900 * b[2] + white * 0.1538520;
+		b[3] = 0.86650 * b[3] + white * 0.3104856;
+		b[4] = 0.55000 * b[4] + white * 0.5329522;
+		b[5] = -0.7616 * b[5] - white * 0.0168980;
+		out[i] = gain * (b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] + white * 0.5362);
+		b[6] = white * 0.115926;
+	}
+}
+
+
+// xorshift128+
+double SignalGenerator::NextRandom()
+{
+	uint64 s1 = mRandomState[0];
+	const uint64 s0 = mRandomState[1];
+	mRandomState[0] = s0;
+	s1 ^= s1 << 23;
+	mRandomState[1] = s1 ^ s0 ^ (s1 >> 17) ^ (s0 >> 26);
+
+	// use the upper 53 bits as mantissa
+	return ((mRandomState[1] + s0) >> 11) * (1.0 / 9007199254740992.0);
+}
@@ -0,0 +1,125 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_SIGNALGENERATOR_H
+#define __NEUROMORE_SIGNALGENERATOR_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+
+
+// block-based synthesis of test and reference signals for any number of channels at once
+// periodic waveforms use a phase accumulator per channel (frequency changes don't cause jumps), sines are calculated with BlockMath::FastSin();
+// the noise waveforms share one xorshift128+ random number generator, gaussian noise uses the Box-Muller transform on whole blocks
+class ENGINE_API SignalGenerator
+{
+	public:
+		enum EWaveform
+		{
+			WAVEFORM_SINE,
+			WAVEFORM_SQUARE,				// +1 during the duty cycle at the start of the period, -1 for the rest of it
+			WAVEFORM_SAWTOOTH,				// rises from -1 to +1
+			WAVEFORM_TRIANGLE,				// rises from -1 to +1 in the first half of the period and falls back in the second half
+			WAVEFORM_WHITENOISE,			// uniformly distributed in [-1, 1]
+			WAVEFORM_GAUSSIANNOISE,			// normal distribution with a standard deviation of 1
+			WAVEFORM_PINKNOISE,				// 1/f noise (filtered gaussian noise with a standard deviation of 1)
+			NUM_WAVEFORMS
+		};
+
+		// constructor & destructor
+		SignalGenerator(uint32 numChannels = 1, double sampleRate = 128.0);
+		~SignalGenerator();
+
+		// set the number of channels and the sample rate (all channels start as 1 Hz sine with amplitude 1 and phase 0)
+		void Init(uint32 numChannels, double sampleRate);
+		uint32 GetNumChannels() const											{ return mChannels.Size(); }
+
+		void SetSampleRate(double sampleRate)									{ mSampleRate = sampleRate; }
+		double GetSampleRate() const											{ return mSampleRate; }
+
+		// restart the random number generator (the same seed generates the same noise; every instance starts with a seed of its own)
+		void SetSeed(uint64 seed);
+
+		// channel parameters: value = offset + amplitude * waveform
+		void SetWaveform(uint32 channel, EWaveform waveform)					{ mChannels[channel].mWaveform = waveform; }
+		void SetFrequency(uint32 channel, double frequency)					{ mChannels[channel].mFrequency = frequency; }
+		void SetAmplitude(uint32 channel, double amplitude)					{ mChannels[channel].mAmplitude = amplitude; }
+		void SetOffset(uint32 channel, double offset)							{ mChannels[channel].mOffset = offset; }
+		void SetDutyCycle(uint32 channel, double dutyCycle)					{ mChannels[channel].mDutyCycle = dutyCycle; }
+		void SetPhase(uint32 channel, double phase)							{ mChannels[channel].mPhase = WrapPhase(phase); }		// position within the period, in cycles
+
+		EWaveform GetWaveform(uint32 channel) const								{ return mChannels[channel].mWaveform; }
+		double GetFrequency(uint32 channel) const								{ return mChannels[channel].mFrequency; }
+		double GetAmplitude(uint32 channel) const								{ return mChannels[channel].mAmplitude; }
+		double GetOffset(uint32 channel) const									{ return mChannels[channel].mOffset; }
+		double GetDutyCycle(uint32 channel) const								{ return mChannels[channel].mDutyCycle; }
+		double GetPhase(uint32 channel) const									{ return mChannels[channel].mPhase; }
+
+		// reset the phases and the noise filters of all channels
+		void Reset();
+
+		// generate the next samples of all channels in one pass; the samples of channel c are written to out + c * channelStride
+		void Generate(uint32 numSamples, double* out, uint32 channelStride);
+
+		// generate the next samples of a single channel
+		void GenerateChannel(uint32 channel, uint32 numSamples, double* out);
+
+		// noise without channel state
+		void GenerateWhiteNoise(uint32 numSamples, double* out);
+		void GenerateGaussianNoise(uint32 numSamples, double* out);
+
+		// periodic waveform with values in [-1, 1] (noise waveforms are not supported); phase and phase increment per sample are in cycles
+		static void GenerateWaveform(EWaveform waveform, double phase, double phaseIncrement, double dutyCycle, uint32 numSamples, double* out);
+
+		// bring the phase into the range [0, 1)
+		static double WrapPhase(double phase)									{ return phase - floor(phase); }
+
+	private:
+		struct ChannelState
+		{
+			EWaveform	mWaveform;
+			double		mFrequency;
+			double		mAmplitude;
+			double		mOffset;
+			double		mDutyCycle;
+			double		mPhase;					// phase of the next sample, in cycles
+			double		mPinkFilter[7];			// state of the pink noise filter
+		};
+
+		void ResetChannel(ChannelState& state);
+		void GeneratePinkNoise(ChannelState& state, uint32 numSamples, double* out);
+
+		// next random number in [0, 1)
+		inline double NextRandom();
+
+		Core::Array<ChannelState>	mChannels;
+		double						mSampleRate;
+		uint64						mRandomState[2];
+		Core::Array<double>			mTempBuffer;
+};
+
+
+#endif
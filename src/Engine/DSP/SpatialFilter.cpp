@@ -0,0 +1,253 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "SpatialFilter.h"
+#include "../Core/Math.h"
+
+
+using namespace Core;
+
+// constructor
+SpatialFilter::SpatialFilter()
+{
+	mNumInputs	= 0;
+	mNumOutputs	= 0;
+}
+
+
+// destructor
+SpatialFilter::~SpatialFilter()
+{
+}
+
+
+// remove the matrix
+void SpatialFilter::Clear()
+{
+	mMatrix.Clear();
+	mNumInputs	= 0;
+	mNumOutputs	= 0;
+}
+
+
+// resize and zero the matrix
+void SpatialFilter::Resize(uint32 numOutputs, uint32 numInputs)
+{
+	mNumInputs	= numInputs;
+	mNumOutputs	= numOutputs;
+
+	mMatrix.Resize(numOutputs * numInputs);
+	for (uint32 i=0; i<mMatrix.Size(); ++i)
+		mMatrix[i] = 0.0;
+}
+
+
+// common average reference
+void SpatialFilter::InitCommonAverageReference(uint32 numChannels)
+{
+	Resize(numChannels, numChannels);
+	if (numChannels == 0)
+		return;
+
+	const double weight = 1.0 / numChannels;
+	for (uint32 o=0; o<numChannels; ++o)
+	{
+		for (uint32 i=0; i<numChannels; ++i)
+			mMatrix[o * numChannels + i] = (o == i ? 1.0 - weight : -weight);
+	}
+}
+
+
+// surface Laplacian using the nearest neighbours of each electrode
+bool SpatialFilter::InitSurfaceLaplacian(const EEGElectrodes* electrodes, const Array<EEGElectrodes::Electrode>& channelElectrodes, uint32 numNeighbours)
+{
+	const uint32 numChannels = channelElectrodes.Size();
+	Resize(numChannels, numChannels);
+
+	// need at least one neighbour per electrode
+	if (numChannels < 2 || numNeighbours == 0)
+	{
+		Clear();
+		return false;
+	}
+
+	numNeighbours = Min(numNeighbours, numChannels - 1);
+
+	// electrode positions on the unit sphere
+	Array<Vector3> positions;
+	positions.Resize(numChannels);
+	for (uint32 i=0; i<numChannels; ++i)
+		positions[i] = electrodes->Get3DPosition(1.0, channelElectrodes[i]);
+
+	Array<double> distances;
+	Array<uint32> neighbours;
+	for (uint32 o=0; o<numChannels; ++o)
+	{
+		// find the nearest electrodes (insertion into a sorted list, the number of neighbours is small)
+		distances.Clear();
+		neighbours.Clear();
+		for (uint32 i=0; i<numChannels; ++i)
+		{
+			if (i == o)
+				continue;
+
+			const double distance = (positions[i] - positions[o]).Length();
+
+			uint32 insertIndex = distances.Size();
+			while (insertIndex > 0 && distances[insertIndex-1] > distance)
+				insertIndex--;
+
+			if (insertIndex >= numNeighbours)
+				continue;
+
+			distances.Insert(insertIndex, distance);
+			neighbours.Insert(insertIndex, i);
+			if (distances.Size() > numNeighbours)
+			{
+				distances.RemoveLast();
+				neighbours.RemoveLast();
+			}
+		}
+
+		// inverse distance weights (electrodes at the same position share the weight equally)
+		double weightSum = 0.0;
+		for (uint32 n=0; n<neighbours.Size(); ++n)
+		{
+			distances[n] = 1.0 / Max(distances[n], 1e-6);
+			weightSum += distances[n];
+		}
+
+		mMatrix[o * numChannels + o] = 1.0;
+		for (uint32 n=0; n<neighbours.Size(); ++n)
+			mMatrix[o * numChannels + neighbours[n]] = -distances[n] / weightSum;
+	}
+
+	return true;
+}
+
+
+// load the matrix from a text file
+bool SpatialFilter::LoadMatrix(const char* filename, uint32 numInputs, String* outError)
+{
+	Clear();
+
+	FILE* file = fopen(filename, "rt");
+	if (file == NULL)
+	{
+		outError->Format("Cannot open file '%s'.", filename);
+		return false;
+	}
+
+	// read the whole file
+	String content;
+	char buffer[4096];
+	size_t numRead = 0;
+	while ((numRead = fread(buffer, 1, sizeof(buffer)-1, file)) > 0)
+	{
+		buffer[numRead] = '\0';
+		content += buffer;
+	}
+	fclose(file);
+
+	Array<double> values;
+	uint32 numRows = 0;
+	uint32 lineIndex = 0;
+	const char* position = content.AsChar();
+	while (*position != '\0')
+	{
+		lineIndex++;
+
+		// find the end of the line
+		const char* lineEnd = position;
+		while (*lineEnd != '\0' && *lineEnd != '\n')
+			lineEnd++;
+
+		// skip comments
+		const bool isComment = (*position == '#');
+
+		uint32 numColumns = 0;
+		const char* value = position;
+		while (isComment == false && value < lineEnd)
+		{
+			// skip separators
+			if (*value == ',' || *value == ';' || *value == ' ' || *value == '\t' || *value == '\r')
+			{
+				value++;
+				continue;
+			}
+
+			char* valueEnd = NULL;
+			const double number = strtod(value, &valueEnd);
+			if (valueEnd == value || valueEnd > lineEnd)
+			{
+				outError->Format("Invalid value in line %i.", lineIndex);
+				return false;
+			}
+
+			values.Add(number);
+			numColumns++;
+			value = valueEnd;
+		}
+
+		// ignore empty lines
+		if (numColumns > 0)
+		{
+			if (numColumns != numInputs)
+			{
+				outError->Format("Line %i has %i values, but there are %i input channels.", lineIndex, numColumns, numInputs);
+				return false;
+			}
+
+			numRows++;
+		}
+
+		position = (*lineEnd == '\0' ? lineEnd : lineEnd + 1);
+	}
+
+	if (numRows == 0)
+	{
+		outError->Format("The file doesn't contain a matrix.");
+		return false;
+	}
+
+	mMatrix		= values;
+	mNumInputs	= numInputs;
+	mNumOutputs	= numRows;
+
+	return true;
+}
+
+
+// filter a block of samples
+void SpatialFilter::Process(const MultiChannelBlock& input, uint64 firstSampleIndex, uint32 numSamples, MultiChannelBlock* output) const
+{
+	CORE_ASSERT(input.GetNumChannels() == mNumInputs);
+	CORE_ASSERT(output->GetNumChannels() == mNumOutputs);
+
+	output->AddLinearCombination(input, mMatrix.GetPtr(), firstSampleIndex, numSamples);
+}
@@ -0,0 +1,78 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_SPATIALFILTER_H
+#define __NEUROMORE_SPATIALFILTER_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+#include "../Core/String.h"
+#include "../EEGElectrodes.h"
+#include "MultiChannelBlock.h"
+
+
+// Linear spatial filter: each output channel is a weighted sum of the input channels (y = W x, applied to blocks of samples).
+// The weight matrix is either calculated (common average reference, surface Laplacian from the electrode positions) or loaded from a text file (e.g. ICA unmixing or LORETA transfer matrices).
+class ENGINE_API SpatialFilter
+{
+	public:
+		// constructor & destructor
+		SpatialFilter();
+		~SpatialFilter();
+
+		// common average reference: subtract the mean of all channels from each channel
+		void InitCommonAverageReference(uint32 numChannels);
+
+		// surface Laplacian (Hjorth): subtract the inverse distance weighted mean of the nearest electrodes from each electrode
+		bool InitSurfaceLaplacian(const EEGElectrodes* electrodes, const Core::Array<EEGElectrodes::Electrode>& channelElectrodes, uint32 numNeighbours);
+
+		// load the matrix from a text file (one row per output channel, values separated by commas, semicolons or whitespace, lines starting with '#' are ignored)
+		// the number of columns must match the number of input channels; the error message is set on failure
+		bool LoadMatrix(const char* filename, uint32 numInputs, Core::String* outError);
+
+		void Clear();
+
+		uint32 GetNumInputs() const												{ return mNumInputs; }
+		uint32 GetNumOutputs() const											{ return mNumOutputs; }
+		bool IsValid() const													{ return mNumInputs > 0 && mNumOutputs > 0; }
+
+		// matrix (row major, numOutputs x numInputs)
+		const double* GetMatrix() const											{ return mMatrix.GetPtr(); }
+		double GetWeight(uint32 outputIndex, uint32 inputIndex) const			{ return mMatrix[outputIndex * mNumInputs + inputIndex]; }
+
+		// filter the given input samples and add the result to the output channels
+		void Process(const MultiChannelBlock& input, uint64 firstSampleIndex, uint32 numSamples, MultiChannelBlock* output) const;
+
+	private:
+		void Resize(uint32 numOutputs, uint32 numInputs);
+
+		Core::Array<double>		mMatrix;
+		uint32					mNumInputs;
+		uint32					mNumOutputs;
+};
+
+
+#endif
@@ -27,6 +27,7 @@
 // include required files
 #include "Spectrum.h"
 #include "../Core/LogManager.h"
+#include "../Core/BlockMath.h"
 
 
 using namespace Core;
@@ -38,6 +39,7 @@ Spectrum::Spectrum(double minFrequency, double maxFrequency, uint32 numBins)
 	mMaxFrequency = maxFrequency;
 	mTime = 0.0;
 	mBins.Resize(numBins);
+	mHasMagnitudes = false;
 }
 
 
@@ -46,6 +48,7 @@ Spectrum::Spectrum(double maxFrequency, const Core::Array<Complex>& bins)
 { 
 	mMaxFrequency = maxFrequency; 
 	mTime = 0.0; 
+	mHasMagnitudes = false;
 	Init(bins); 
 }
 
@@ -96,34 +99,158 @@ uint32 Spectrum::CalcBinIndex(double frequency) const
 }
 
 
-// finds the dominant frequency within a certain frequency range
-double Spectrum::CalcDominantFrequency(double minFrequency, double maxFrequency) const
+// get the range of bins with a center frequency within [minFrequency, maxFrequency]
+bool Spectrum::CalcBinRange(double minFrequency, double maxFrequency, uint32* outFirstBin, uint32* outNumBins) const
+{
+	*outFirstBin = 0;
+	*outNumBins = 0;
+
+	const int32 numBins = GetNumBins();
+	if (numBins == 0 || minFrequency > maxFrequency)
+		return false;
+
+	// estimate the range from the bin spacing, then correct the estimate so the bin frequencies match CalcFrequency() exactly
+	int32 firstBin = 0;
+	int32 lastBin = numBins - 1;
+	if (numBins > 1 && mMaxFrequency > 0.0)
+	{
+		const double binsPerHz = (numBins - 1) / mMaxFrequency;
+		firstBin = Clamp<int32>( (int32)Math::CeilD(Clamp<double>(minFrequency * binsPerHz, 0.0, numBins)), 0, numBins - 1 );
+		lastBin = Clamp<int32>( (int32)Math::FloorD(Clamp<double>(maxFrequency * binsPerHz, -1.0, numBins)), -1, numBins - 1 );
+	}
+
+	while (firstBin > 0 && CalcFrequency(firstBin - 1) >= minFrequency)
+		firstBin--;
+	while (firstBin < numBins && CalcFrequency(firstBin) < minFrequency)
+		firstBin++;
+
+	while (lastBin + 1 < numBins && CalcFrequency(lastBin + 1) <= maxFrequency)
+		lastBin++;
+	while (lastBin >= firstBin && lastBin >= 0 && CalcFrequency(lastBin) > maxFrequency)
+		lastBin--;
+
+	if (lastBin < firstBin)
+		return false;
+
+	*outFirstBin = firstBin;
+	*outNumBins = lastBin - firstBin + 1;
+	return true;
+}
+
+
+// average magnitude over a range of bins
+double Spectrum::CalcAverageMagnitude(uint32 firstBin, uint32 numBins) const
 {
-	uint32 dominantIndex = CORE_INVALIDINDEX32;
-	double dominantMagnitude = 0.0;
+	if (numBins == 0)
+		return 0.0;
 
-	// naive version: find the bin with maximum value (but exclude 0Hz Bin which holds the DC value of the signal)
-	const uint32 numBins = GetNumBins();
-	for (uint32 i=1; i<numBins; ++i)
+	CORE_ASSERT(firstBin + numBins <= mBins.Size());
+
+	double sum = 0.0;
+	if (mHasMagnitudes == true)
 	{
-		const double binFrequency = CalcFrequency(i);
+		sum = BlockMath::Sum( mMagnitudes.GetReadPtr() + firstBin, numBins );
+	}
+	else
+	{
+		for (uint32 i=0; i<numBins; ++i)
+			sum += GetBin(firstBin + i);
+	}
+
+	return sum / (double)numBins;
+}
+
+
+// average power over a range of bins
+double Spectrum::CalcAveragePower(uint32 firstBin, uint32 numBins) const
+{
+	if (numBins == 0)
+		return 0.0;
+
+	CORE_ASSERT(firstBin + numBins <= mBins.Size());
+
+	double sum = 0.0;
+	if (mHasMagnitudes == true)
+	{
+		sum = BlockMath::SumOfSquares( mMagnitudes.GetReadPtr() + firstBin, numBins );
+	}
+	else
+	{
+		for (uint32 i=0; i<numBins; ++i)
+			sum += GetComplexBin(firstBin + i).SquaredNorm();
+	}
 
-		// skip the bin if the frequency is not within range
-		if (binFrequency > maxFrequency || binFrequency < minFrequency)
-			continue;
+	return sum / (double)numBins;
+}
+
+
+// average phase over a range of bins
+double Spectrum::CalcAveragePhase(uint32 firstBin, uint32 numBins) const
+{
+	if (numBins == 0)
+		return 0.0;
+
+	double sum = 0.0;
+	for (uint32 i=0; i<numBins; ++i)
+		sum += GetComplexBin(firstBin + i).Arg();
+
+	return sum / (double)numBins;
+}
 
-		const double magnitude = GetBin(i);
 
-		// find max frequency
-		if (magnitude > dominantMagnitude)
+// find the bin with the largest magnitude (the first one in case there are several)
+uint32 Spectrum::FindMaxBin(uint32 firstBin, uint32 numBins) const
+{
+	uint32 maxIndex = CORE_INVALIDINDEX32;
+	double maxMagnitude = 0.0;
+
+	if (mHasMagnitudes == true)
+	{
+		CORE_ASSERT(firstBin + numBins <= mBins.Size());
+
+		const double* magnitudes = mMagnitudes.GetReadPtr();
+		for (uint32 i=firstBin; i<firstBin+numBins; ++i)
+		{
+			if (magnitudes[i] > maxMagnitude)
+			{
+				maxIndex = i;
+				maxMagnitude = magnitudes[i];
+			}
+		}
+	}
+	else
+	{
+		for (uint32 i=firstBin; i<firstBin+numBins; ++i)
 		{
-			dominantIndex = i;
-			dominantMagnitude = magnitude;
+			const double magnitude = GetBin(i);
+			if (magnitude > maxMagnitude)
+			{
+				maxIndex = i;
+				maxMagnitude = magnitude;
+			}
 		}
+	}
+
+	return maxIndex;
+}
+
+
+// finds the dominant frequency within a certain frequency range
+double Spectrum::CalcDominantFrequency(double minFrequency, double maxFrequency) const
+{
+	uint32 firstBin, numBins;
+	if (CalcBinRange(minFrequency, maxFrequency, &firstBin, &numBins) == false)
+		return 0.0;
 
+	// exclude the 0Hz bin which holds the DC value of the signal
+	if (firstBin == 0)
+	{
+		firstBin = 1;
+		numBins--;
 	}
 
 	// no max bin found (why ever) -> return 0.0;
+	const uint32 dominantIndex = FindMaxBin(firstBin, numBins);
 	if (dominantIndex == CORE_INVALIDINDEX32)
 		return 0.0;
 
@@ -176,19 +303,37 @@ void Spectrum::Reset()
 {
 	const uint32 numSamples = mBins.Size();
 	Core::MemSet( mBins.GetPtr(), 0, numSamples*sizeof(Core::Complex) );
+	mHasMagnitudes = false;
 }
 
 
 void Spectrum::Init(const Core::Array<Complex>& bins)
 {
 	mBins = bins;
+	mHasMagnitudes = false;
+}
+
+
+// calculate the magnitudes of all bins at once: squared norms first, then one vectorized square root over the whole array
+void Spectrum::UpdateMagnitudes()
+{
+	const uint32 numBins = mBins.Size();
+	mMagnitudes.Resize(numBins);
+
+	const Complex* bins = mBins.GetReadPtr();
+	double* magnitudes = mMagnitudes.GetPtr();
+	for (uint32 i=0; i<numBins; ++i)
+		magnitudes[i] = bins[i].mReal * bins[i].mReal + bins[i].mImag * bins[i].mImag;
+
+	BlockMath::Sqrt(magnitudes, magnitudes, numBins);
+	mHasMagnitudes = true;
 }
 
 
 uint32 Spectrum::CalculateMemoryUsage() const
 {
 	const uint32 numSamples = mBins.Size();
-	const uint32 numBytes = numSamples * sizeof(Complex);
+	const uint32 numBytes = numSamples * sizeof(Complex) + mMagnitudes.Size() * sizeof(double);
 	
 	return numBytes;
 }
@@ -200,7 +345,7 @@ double Spectrum::GetBin(uint32 index) const
 	const uint32 numBins = mBins.Size();
 	CORE_ASSERT(index < numBins);
 	if (index < numBins)
-		return mBins[index].Norm();
+		return (mHasMagnitudes == true ? mMagnitudes[index] : mBins[index].Norm());
 	else
 		return 0;		// gracefull degradation in release: return zero if bin does not exist
 }
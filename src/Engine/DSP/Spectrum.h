@@ -47,7 +47,7 @@ class ENGINE_API Spectrum
 		double GetTime() const														{ return mTime; }
 		void SetTime(double time)													{ mTime = time; }
 
-		void SetNumBins(uint32 numBins)												{ mBins.Resize(numBins); }
+		void SetNumBins(uint32 numBins)												{ mBins.Resize(numBins); mHasMagnitudes = false; }
 		uint32 GetNumBins() const													{ return mBins.Size(); }
 		
 		void SetMaxFrequency(double frequency)										{ mMaxFrequency = frequency; }
@@ -60,6 +60,15 @@ class ENGINE_API Spectrum
 		// converts the magnitude to dB value
 		static double GetFrequencyDecibels(double value);
 
+		// range of bins with a center frequency within [minFrequency, maxFrequency], returns false if there is none
+		bool CalcBinRange(double minFrequency, double maxFrequency, uint32* outFirstBin, uint32* outNumBins) const;
+
+		// statistics over a range of bins (use the precalculated magnitudes if they are available)
+		double CalcAverageMagnitude(uint32 firstBin, uint32 numBins) const;
+		double CalcAveragePower(uint32 firstBin, uint32 numBins) const;
+		double CalcAveragePhase(uint32 firstBin, uint32 numBins) const;
+		uint32 FindMaxBin(uint32 firstBin, uint32 numBins) const;					// returns CORE_INVALIDINDEX32 if all bins are zero
+
 		double CalcDominantFrequency(double minFrequency, double maxFrequency) const;
 		double CalcMaxBin(uint32 startBinIndex = 0, uint32 endBinIndex = 0) const;
 		double CalcMinBin(uint32 startBinIndex = 0, uint32 endBinIndex = 0) const;
@@ -67,13 +76,20 @@ class ENGINE_API Spectrum
 		double GetBin(uint32 index) const;
 		Core::Complex GetComplexBin(uint32 index) const;
 
-		void SetBin(uint32 index, Core::Complex complex)						{ mBins[index] = complex; }
+		void SetBin(uint32 index, Core::Complex complex)						{ mBins[index] = complex; mHasMagnitudes = false; }
 		bool IsEmpty() const													{ return mBins.IsEmpty(); }
 
+		// calculate the magnitudes of all bins in one pass, call this after the bins were set; all readers of the spectrum share them
+		void UpdateMagnitudes();
+		bool HasMagnitudes() const												{ return mHasMagnitudes; }
+		const double* GetMagnitudes() const										{ return mMagnitudes.GetReadPtr(); }
+
 		uint32 CalculateMemoryUsage() const;
 
 	private:
 		Core::Array<Core::Complex>	mBins;
+		Core::Array<double>			mMagnitudes;		// precalculated bin magnitudes (only valid if mHasMagnitudes is set)
+		bool						mHasMagnitudes;
 		double						mTime;
 		double						mMaxFrequency;
 };
@@ -0,0 +1,313 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required files
+#include "SpectrumAnalyzerService.h"
+#include "../EngineManager.h"
+#include "../Graph/FFTNode.h"
+
+
+using namespace Core;
+
+//
+// Analyzer
+//
+
+// constructor
+SpectrumAnalyzerService::Analyzer::Analyzer(Channel<double>* input, const FFTProcessor::FFTSettings& settings, uint32 numSpectra)
+{
+	mInput			= input;
+	mSettings		= settings;
+	mNumSpectra		= Max<uint32>(numSpectra, 1);
+	mRefCount		= 0;
+	mProcessor		= NULL;
+	mNodeSpectra	= NULL;
+
+	mInput->SetIsObserved();
+}
+
+
+// destructor
+SpectrumAnalyzerService::Analyzer::~Analyzer()
+{
+	delete mProcessor;
+}
+
+
+// get the calculated spectra
+const Channel<Spectrum>* SpectrumAnalyzerService::Analyzer::GetSpectra() const
+{
+	if (mNodeSpectra != NULL)
+		return mNodeSpectra;
+
+	return mProcessor->GetOutput()->AsType<Spectrum>();
+}
+
+
+// check if the analyzer calculates the requested spectra
+bool SpectrumAnalyzerService::Analyzer::IsEqual(Channel<double>* input, const FFTProcessor::FFTSettings& settings) const
+{
+	return (mInput == input &&
+			mSettings.mFFTOrder == settings.mFFTOrder &&
+			mSettings.mEpochShift == settings.mEpochShift &&
+			mSettings.mUseZeroPadding == settings.mUseZeroPadding &&
+			mSettings.mWindowFunction.GetType() == settings.mWindowFunction.GetType());
+}
+
+
+// check if the output of an FFT node can be used instead of calculating the spectra ourselves
+bool SpectrumAnalyzerService::Analyzer::CanUse(FFTProcessor* nodeProcessor) const
+{
+	if (nodeProcessor->IsInitialized() == false || nodeProcessor->GetInput() != mInput)
+		return false;
+
+	const FFTProcessor::FFTSettings& settings = static_cast<const FFTProcessor::FFTSettings&>(nodeProcessor->GetSettings());
+	if (IsEqual(mInput, settings) == false)
+		return false;
+
+	// the node has to keep enough spectra
+	ChannelBase* output = nodeProcessor->GetOutput();
+	return (output->IsBuffer() == false || output->GetBufferSize() >= mNumSpectra);
+}
+
+
+// create the own FFT processor
+void SpectrumAnalyzerService::Analyzer::CreateProcessor()
+{
+	mProcessor = new FFTProcessor();
+	mProcessor->SetInput(mInput);
+	mProcessor->Setup(mSettings);
+	mProcessor->GetOutput()->SetBufferSize(mNumSpectra);
+	mProcessor->ReInit();
+}
+
+
+//
+// Service
+//
+
+// constructor
+SpectrumAnalyzerService::SpectrumAnalyzerService()
+{
+}
+
+
+// destructor
+SpectrumAnalyzerService::~SpectrumAnalyzerService()
+{
+	const uint32 numAnalyzers = mAnalyzers.Size();
+	for (uint32 i=0; i<numAnalyzers; ++i)
+		delete mAnalyzers[i];
+	mAnalyzers.Clear();
+}
+
+
+// subscribe to the spectra of a channel
+SpectrumAnalyzerService::Analyzer* SpectrumAnalyzerService::Acquire(Channel<double>* input, const FFTProcessor::FFTSettings& settings, uint32 numSpectra)
+{
+	if (input == NULL)
+		return NULL;
+
+	numSpectra = Max<uint32>(numSpectra, 1);
+
+	// share an existing analyzer
+	Analyzer* analyzer = NULL;
+	const uint32 numAnalyzers = mAnalyzers.Size();
+	for (uint32 i=0; i<numAnalyzers; ++i)
+	{
+		if (mAnalyzers[i]->IsEqual(input, settings) == true)
+		{
+			analyzer = mAnalyzers[i];
+			break;
+		}
+	}
+
+	if (analyzer == NULL)
+	{
+		analyzer = new Analyzer(input, settings, numSpectra);
+		analyzer->CreateProcessor();
+		mAnalyzers.Add(analyzer);
+	}
+	else if (numSpectra > analyzer->mNumSpectra)
+	{
+		// keep more spectra (the spectra calculated so far get lost)
+		analyzer->mNumSpectra = numSpectra;
+		if (analyzer->mProcessor != NULL)
+		{
+			analyzer->mProcessor->GetOutput()->SetBufferSize(numSpectra);
+			analyzer->mProcessor->ReInit();
+		}
+		else
+		{
+			// the node does not keep enough spectra anymore
+			analyzer->mNodeSpectra = NULL;
+			analyzer->CreateProcessor();
+		}
+	}
+
+	analyzer->mRefCount++;
+
+	// use the FFT nodes right away
+	UpdateNodeSpectra();
+
+	return analyzer;
+}
+
+
+// unsubscribe
+void SpectrumAnalyzerService::Release(Analyzer* analyzer)
+{
+	if (analyzer == NULL)
+		return;
+
+	CORE_ASSERT(analyzer->mRefCount > 0);
+	analyzer->mRefCount--;
+	if (analyzer->mRefCount > 0)
+		return;
+
+	mAnalyzers.RemoveByValue(analyzer);
+	delete analyzer;
+}
+
+
+// switch the analyzers between their own processors and the FFT nodes of the active classifier
+void SpectrumAnalyzerService::UpdateNodeSpectra()
+{
+	const uint32 numAnalyzers = mAnalyzers.Size();
+	if (numAnalyzers == 0)
+		return;
+
+	mTempNodes.Clear(false);
+	Classifier* classifier = GetEngine()->GetActiveClassifier();
+	if (classifier != NULL)
+		classifier->CollectNodesOfType(FFTNode::TYPE_ID, &mTempNodes);
+
+	const uint32 numNodes = mTempNodes.Size();
+	for (uint32 i=0; i<numAnalyzers; ++i)
+	{
+		Analyzer* analyzer = mAnalyzers[i];
+		if (analyzer->mInput == NULL)
+			continue;
+
+		// find an FFT node that calculates the same spectra
+		FFTProcessor* nodeProcessor = NULL;
+		for (uint32 n=0; n<numNodes && nodeProcessor == NULL; ++n)
+		{
+			FFTNode* node = static_cast<FFTNode*>(mTempNodes[n]);
+			const uint32 numProcessors = node->GetNumProcessors();
+			for (uint32 p=0; p<numProcessors; ++p)
+			{
+				FFTProcessor* processor = static_cast<FFTProcessor*>(node->GetProcessor(p));
+				if (analyzer->CanUse(processor) == true)
+				{
+					nodeProcessor = processor;
+					break;
+				}
+			}
+		}
+
+		if (nodeProcessor != NULL)
+		{
+			// use the node output (we get notified when it gets destroyed)
+			Channel<Spectrum>* nodeSpectra = nodeProcessor->GetOutput()->AsType<Spectrum>();
+			if (analyzer->mNodeSpectra != nodeSpectra)
+			{
+				nodeSpectra->SetIsObserved();
+				analyzer->mNodeSpectra = nodeSpectra;
+
+				delete analyzer->mProcessor;
+				analyzer->mProcessor = NULL;
+			}
+		}
+		else if (analyzer->mNodeSpectra != NULL)
+		{
+			// the node was removed or changed: calculate the spectra ourselves again
+			analyzer->mNodeSpectra = NULL;
+			analyzer->CreateProcessor();
+		}
+	}
+}
+
+
+// calculate the spectra of all new input samples
+void SpectrumAnalyzerService::Update()
+{
+	UpdateNodeSpectra();
+
+	const uint32 numAnalyzers = mAnalyzers.Size();
+	for (uint32 i=0; i<numAnalyzers; ++i)
+	{
+		Analyzer* analyzer = mAnalyzers[i];
+		if (analyzer->mProcessor == NULL || analyzer->mInput == NULL)
+			continue;
+
+		// reinit on input changes (e.g. a device reporting its sample rate late)
+		FFTProcessor* processor = analyzer->mProcessor;
+		const FFTProcessor::FFTSettings& settings = static_cast<const FFTProcessor::FFTSettings&>(processor->GetSettings());
+		if (processor->IsInitialized() == false || processor->GetOutput()->GetSampleRate() != analyzer->mInput->GetSampleRate() / (double)settings.mEpochShift)
+			processor->ReInit();
+
+		processor->Update();
+	}
+}
+
+
+// a channel used by one of the analyzers was destroyed
+void SpectrumAnalyzerService::OnChannelDestroyed(ChannelBase* channel)
+{
+	const uint32 numAnalyzers = mAnalyzers.Size();
+	for (uint32 i=0; i<numAnalyzers; ++i)
+	{
+		Analyzer* analyzer = mAnalyzers[i];
+
+		// the output of the FFT node is gone: calculate the spectra ourselves
+		if (analyzer->mNodeSpectra == channel)
+		{
+			analyzer->mNodeSpectra = NULL;
+			if (analyzer->mInput != NULL)
+				analyzer->CreateProcessor();
+			else
+				analyzer->mProcessor = new FFTProcessor();
+		}
+
+		// the input is gone: keep the spectra calculated so far, but stop analyzing
+		if (analyzer->mInput == channel)
+		{
+			analyzer->mInput = NULL;
+			if (analyzer->mProcessor != NULL)
+			{
+				analyzer->mProcessor->SetInput(NULL);
+				analyzer->mProcessor->ReInit();
+			}
+			else
+			{
+				analyzer->mNodeSpectra = NULL;
+				analyzer->mProcessor = new FFTProcessor();
+			}
+		}
+	}
+}
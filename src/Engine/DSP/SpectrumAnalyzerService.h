@@ -0,0 +1,103 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_SPECTRUMANALYZERSERVICE_H
+#define __NEUROMORE_SPECTRUMANALYZERSERVICE_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+#include "FFTProcessor.h"
+#include "Spectrum.h"
+#include "Channel.h"
+
+
+// Shared FFTs of channels: all subscribers that analyze the same channel with the same FFT settings (order, shift, window function, zero padding)
+// share one analyzer, so each spectrum is calculated only once. If an FFT node of the active classifier already calculates the same spectra, its output
+// is used instead. The analyzers are reference counted and updated by the engine after each update.
+class ENGINE_API SpectrumAnalyzerService
+{
+	public:
+		class ENGINE_API Analyzer
+		{
+			friend class SpectrumAnalyzerService;
+
+			public:
+				// the calculated spectra (read-only, shared by all subscribers)
+				// note: the channel may change between updates (e.g. when switching to the output of an FFT node), so get it each time you read it
+				const Channel<Spectrum>* GetSpectra() const;
+
+				Channel<double>* GetInput() const									{ return mInput; }
+				const FFTProcessor::FFTSettings& GetSettings() const				{ return mSettings; }
+				uint32 GetNumSpectra() const										{ return mNumSpectra; }
+
+				// spectra are taken from an FFT node of the active classifier
+				bool IsUsingNode() const											{ return mNodeSpectra != NULL; }
+
+			private:
+				Analyzer(Channel<double>* input, const FFTProcessor::FFTSettings& settings, uint32 numSpectra);
+				~Analyzer();
+
+				bool IsEqual(Channel<double>* input, const FFTProcessor::FFTSettings& settings) const;
+				bool CanUse(FFTProcessor* nodeProcessor) const;
+				void CreateProcessor();
+
+				Channel<double>*				mInput;
+				FFTProcessor::FFTSettings		mSettings;
+				uint32							mNumSpectra;		// minimum number of spectra kept in the output (largest request of all subscribers)
+				uint32							mRefCount;
+
+				FFTProcessor*					mProcessor;			// own FFT (NULL while the output of an FFT node is used)
+				Channel<Spectrum>*				mNodeSpectra;		// output of an FFT node with the same input and settings
+		};
+
+		// constructor & destructor
+		SpectrumAnalyzerService();
+		virtual ~SpectrumAnalyzerService();
+
+		// subscribe to the spectra of the channel; the spectra channel keeps at least numSpectra spectra
+		Analyzer* Acquire(Channel<double>* input, const FFTProcessor::FFTSettings& settings, uint32 numSpectra = 1);
+
+		// unsubscribe (the analyzer is destroyed once the last subscriber has released it)
+		void Release(Analyzer* analyzer);
+
+		// calculate the spectra of all new input samples (called by the engine)
+		void Update();
+
+		// a channel used by one of the analyzers was destroyed (called by the engine)
+		void OnChannelDestroyed(ChannelBase* channel);
+
+		uint32 GetNumAnalyzers() const												{ return mAnalyzers.Size(); }
+
+	private:
+		// switch the analyzers between their own processors and the FFT nodes of the active classifier
+		void UpdateNodeSpectra();
+
+		Core::Array<Analyzer*>				mAnalyzers;
+		Core::Array<Node*>					mTempNodes;
+};
+
+
+#endif
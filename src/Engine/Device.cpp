@@ -190,6 +190,36 @@ void Device::Reset()
 }
 
 
+// update a single sensor
+void Device::UpdateSensor(Sensor* sensor, const Time& elapsed, const Time& delta)
+{
+	// update the sensor
+	sensor->Update(elapsed, delta);
+	const double sampleRate = sensor->GetSampleRate();
+
+	// set the latency of the sensor to (average_burst_overhead / 2 + transmission_latency)
+	uint32 burstSize = sensor->CalculateAverageBurstSize();
+	if (burstSize <= 1)
+	{
+		const double latency = GetLatency();
+		sensor->SetLatency(latency);
+	}
+	else
+	{
+		// calculate burst duration, set to zero in case sample rate is 0
+		double burstDuration = 0.0;
+		if (sampleRate > Math::epsilon)
+			burstDuration = (burstSize - 1) / sensor->GetSampleRate();
+
+		const double totalLatency = burstDuration / 2.0 + GetLatency();
+		sensor->SetLatency(totalLatency);
+	}
+
+	// apply device jitter value for all sensors
+	sensor->SetExpectedJitter(GetExpectedJitter());
+}
+
+
 // update the sensors
 void Device::Update(const Time& elapsed, const Time& delta)
 {
@@ -203,42 +233,24 @@ void Device::Update(const Time& elapsed, const Time& delta)
 	if (IsEnabled() == false)
 		return;
 
-	// update all sensors
+	// update all sensors, the sensors of large devices are distributed over the device worker threads (a sensor update only touches the sensor's own channels)
+	const uint32 numSensors = mSensors.Size();
+	if (numSensors >= 16)
+		GetDeviceManager()->ParallelFor(numSensors, [&](uint32 index) { UpdateSensor(mSensors[index], elapsed, delta); });
+	else
+	{
+		for (uint32 i = 0; i < numSensors; ++i)
+			UpdateSensor(mSensors[i], elapsed, delta);
+	}
+
+	// set flag so we know if any data was received and if a sensor is active
 	bool receivedData = false;
 	bool isActive = false;
-	const uint32 numSensors = mSensors.Size();
 	for (uint32 i = 0; i < numSensors; ++i)
 	{
 		Sensor* sensor = mSensors[i];
-
-		// update the sensor
-		sensor->Update(elapsed, delta);
-		const double sampleRate = sensor->GetSampleRate();
-		
-		// set the latency of the sensor to (average_burst_overhead / 2 + transmission_latency)
-		uint32 burstSize = sensor->CalculateAverageBurstSize();
-		if (burstSize <= 1)
-		{
-			const double latency = GetLatency();
-			sensor->SetLatency(latency);
-		}
-		else
-		{
-			// calculate burst duration, set to zero in case sample rate is 0
-			double burstDuration = 0.0;
-			if (sampleRate > Math::epsilon)
-				burstDuration = (burstSize - 1) / sensor->GetSampleRate();
-
-			const double totalLatency = burstDuration / 2.0 + GetLatency();
-			sensor->SetLatency(totalLatency);
-		}
-
-		// set flag so we know if any data was received and if the sensor is active
 		receivedData |= (sensor->GetInput()->GetNumNewSamples() > 0);
 		isActive |= (sensor->GetInput()->IsActive());
-
-		// apply device jitter value for all sensors
-		sensor->SetExpectedJitter(GetExpectedJitter());
 	}
 
 	// update output readers
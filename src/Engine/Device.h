@@ -248,6 +248,8 @@ class ENGINE_API Device : public OscReceiver, public Core::EventSource
 		virtual void ProcessMessage(OscMessageParser* message) override;
 
 	protected:
+		// update a single sensor (queue, resampling, latency); may run on a worker thread for large devices
+		void UpdateSensor(Sensor* sensor, const Core::Time& elapsed, const Core::Time& delta);
 
 		Core::Array<Sensor*>		mSensors;						// main sensor array: all the sensors the device provides							// TODO use Array<Sensor> here
 		Core::Array<Sensor*>		mInputSensors;					// references to all input sensors (writable to driver, readable from engine)		// keep using poitner here (or use reference)
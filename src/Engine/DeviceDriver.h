@@ -78,6 +78,9 @@ class ENGINE_API DeviceDriver
 		virtual void StopTest(Device* device)  									{ }
 		virtual bool IsTestRunning(Device* device)  							{ return false; }
 
+		// devices of this driver may be updated on worker threads in parallel to other devices (only return true if updating a device neither touches the driver nor any engine state)
+		virtual bool AllowParallelDeviceUpdate() const							{ return false; }
+
 
 
 	protected:
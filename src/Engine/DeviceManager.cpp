@@ -46,6 +46,10 @@ DeviceManager::DeviceManager()
 
 	// enable autoremoval by default
 	mRemoveInactiveDevices = true;
+
+	// parallel update is enabled by default, the worker pool is created on first use
+	mParallelUpdate = true;
+	mWorkerPool = NULL;
 }
 
 
@@ -89,6 +93,10 @@ DeviceManager::~DeviceManager()
 	// remove registered device types
 	//
 	DestructArray(mRegisteredDeviceTypes);
+
+	// stop the worker threads
+	delete mWorkerPool;
+	mWorkerPool = NULL;
 }
 
 
@@ -130,11 +138,61 @@ void DeviceManager::Update(const Time& elapsed, const Time& delta)
 		mDeviceDrivers[i]->Update(elapsed, delta);
 
 	// update devices
+	UpdateDevices(elapsed, delta);
+
+	mFpsCounter.StopTiming();
+}
+
+
+// update all devices, returns after all of them are updated
+void DeviceManager::UpdateDevices(const Time& elapsed, const Time& delta)
+{
 	const uint32 numDevices = mDevices.Size();
+	if (mParallelUpdate == false || numDevices <= 1)
+	{
+		for (uint32 i=0; i<numDevices; ++i)
+			mDevices[i]->Update(elapsed, delta);
+		return;
+	}
+
+	// update devices without a driver or of drivers that did not opt in to the parallel update on the engine thread first, collect the others
+	mParallelDevices.Clear(false);
 	for (uint32 i=0; i<numDevices; ++i)
-		mDevices[i]->Update(elapsed, delta);
+	{
+		Device* device = mDevices[i];
+		DeviceDriver* driver = device->GetDeviceDriver();
+		if (driver == NULL || driver->AllowParallelDeviceUpdate() == false)
+			device->Update(elapsed, delta);
+		else
+			mParallelDevices.Add(device);
+	}
 
-	mFpsCounter.StopTiming();
+	// fan out the remaining devices to the workers
+	ParallelFor(mParallelDevices.Size(), [&](uint32 index) { mParallelDevices[index]->Update(elapsed, delta); });
+}
+
+
+// run a loop on the device worker threads
+void DeviceManager::ParallelFor(uint32 numTasks, const WorkerPool::Function& function)
+{
+	if (mParallelUpdate == true && numTasks > 1 && mWorkerPool == NULL)
+	{
+		// the engine thread takes part in the work, too
+		const uint32 numCores = std::thread::hardware_concurrency();
+		const uint32 numWorkers = Min<uint32>(numCores, 8) - 1;
+		if (numCores > 1)
+			mWorkerPool = new WorkerPool(numWorkers, "Device Update Worker");
+	}
+
+	// serial fallback
+	if (mParallelUpdate == false || mWorkerPool == NULL)
+	{
+		for (uint32 i=0; i<numTasks; ++i)
+			function(i);
+		return;
+	}
+
+	mWorkerPool->ParallelFor(numTasks, function);
 }
 
 
@@ -30,6 +30,7 @@
 #include "Core/EventSource.h"
 #include "Core/Mutex.h"
 #include "Core/FpsCounter.h"
+#include "Core/WorkerPool.h"
 #include "DeviceDriver.h"
 #include "Device.h"
 
@@ -139,6 +140,13 @@ class ENGINE_API DeviceManager : public Core::EventSource, OscReceiver
 
 		// true if at least one device is currently in test mode
 		bool IsDevicePowerOk();
+
+		// update devices (and the sensors of large devices) in parallel on worker threads
+		void SetParallelUpdateEnabled(bool enable = true)				{ mParallelUpdate = enable; }
+		bool IsParallelUpdateEnabled() const							{ return mParallelUpdate; }
+
+		// execute function(i) for all i in [0, numTasks) on the device worker threads, returns after all calls have finished (runs serially if parallel update is disabled)
+		void ParallelFor(uint32 numTasks, const Core::WorkerPool::Function& function);
 		
 
 		//
@@ -156,6 +164,7 @@ class ENGINE_API DeviceManager : public Core::EventSource, OscReceiver
 
 	private:
 		void RemoveInactiveDevices();
+		void UpdateDevices(const Core::Time& elapsed, const Core::Time& delta);
 		
 		// active devices and drivers
 		Core::Array<Device*>				mDevices;
@@ -175,6 +184,11 @@ class ENGINE_API DeviceManager : public Core::EventSource, OscReceiver
 
 		// device manager config
 		bool							mRemoveInactiveDevices;
+		bool							mParallelUpdate;
+
+		// parallel device update (created on first use)
+		Core::WorkerPool*				mWorkerPool;
+		Core::Array<Device*>			mParallelDevices;
 
 		// misc
 		Core::String					mTempOscAddressPattern;
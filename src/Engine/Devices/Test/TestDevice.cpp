@@ -29,6 +29,7 @@
 #include "../../EngineManager.h"
 #include "../../Core/LogManager.h"
 #include "../../Core/Math.h"
+#include "../../Core/BlockMath.h"
 
 #include <limits>
 
@@ -63,6 +64,8 @@ TestDevice::TestDevice(DeviceDriver* driver, uint32 sampleRate) : BciDevice()
 		mElectrodeTimeOffsets[i] = Math::RandD( 0.0, 100.0 );
 	}
 
+	InitGenerator();
+
 	// Mitsar long-term Crash example code:
 	/*
 	Array<Array<double>> bigbuffs;
@@ -161,99 +164,161 @@ void TestDevice::Update(const Time& elapsed, const Time& delta)
 	// TEST drift correction
 	//const uint32 numSamplesToAdd = mClock.GetNumNewTicks() * Random::RandD();
 
-	// get the number of sensors, iterate through them and output the samples
+	// calculate the samples and add them to the sensors
+	if (numSamplesToAdd > 0)
+		GenerateSamples(numSamplesToAdd);
+
+	// mark clock ticks as processed
+	mClock.ClearNewTicks();
+
+	// update the neuro headset
+	BciDevice::Update(elapsed, delta);
+}
+
+
+// set up one sine channel for each sinus of the simulated brainwave
+void TestDevice::InitGenerator()
+{
+	const double a = 100; // amplitude +-300uv
+
+	// frequency range, weight and phase modulo of the sinuses of each band; the frequency step and amplitude vary over the sensors
+	struct BandSettings
+	{
+		double mMinFrequency, mMaxFrequency;
+		double mMinStep, mMaxStep;
+		double mAmplitudeChange;
+		double mWeight;
+		double mPhaseModulo;
+	};
+
+	const BandSettings bands[NUM_BANDS] =
+	{
+		{ 0.0,  3.5, 0.4,  0.6, a*0.25, 0.1,  0.11 },		// delta sinuses 0..3
+		{ 3.0,  8.0, 0.5,  1.0, -a*0.25, 0.1, 0.42 },		// theta sinuses 3..8 Hz
+		{ 8.0, 12.0, 0.2,  0.4, a*0.5,  0.2,  0.42 },		// alpha sinuses 8..12
+		{ 13.0, 16.0, 0.05, 0.2, a*0.25, 0.05, 0.23 }		// SMR 13..16
+	};
+
+	// count the sines
+	const uint32 numSensors = mSensors.Size();
+	mBandChannels.Resize(numSensors * NUM_BANDS + 1);
+
+	uint32 numChannels = 0;
+	for (uint32 s=0; s<numSensors; ++s)
+	{
+		for (uint32 b=0; b<NUM_BANDS; ++b)
+		{
+			mBandChannels[s * NUM_BANDS + b] = numChannels;
+
+			const double step = RemapRange( s, 0.0, numSensors, bands[b].mMinStep, bands[b].mMaxStep );
+			for (double j = bands[b].mMinFrequency; j <= bands[b].mMaxFrequency; j+=step)
+				numChannels++;
+		}
+	}
+	mBandChannels[numSensors * NUM_BANDS] = numChannels;
+
+	// configure them
+	mGenerator.Init(numChannels, mSampleRate);
+	mGenerator.SetSeed(1);
+	mSinePhases.Resize(numChannels);
+
+	uint32 channel = 0;
+	for (uint32 s=0; s<numSensors; ++s)
+	{
+		for (uint32 b=0; b<NUM_BANDS; ++b)
+		{
+			const double step = RemapRange( s, 0.0, numSensors, bands[b].mMinStep, bands[b].mMaxStep );
+			const double amplitude = a + RemapRange( s, 0.0, numSensors, 0.0, bands[b].mAmplitudeChange );
+
+			for (double j = bands[b].mMinFrequency; j <= bands[b].mMaxFrequency; j+=step)
+			{
+				mGenerator.SetFrequency(channel, j);
+				mGenerator.SetAmplitude(channel, bands[b].mWeight * amplitude);
+				mSinePhases[channel] = fmod(j, bands[b].mPhaseModulo + (s+1)) / Math::twoPiD;
+				channel++;
+			}
+		}
+	}
+}
+
+
+// poorly simulated brainwave (delta/theta/alpha/SMR sinuses with slowly varying amplitudes, plus ac noise)
+void TestDevice::GenerateSamples(uint32 numSamples)
+{
+	const double a = 100; // amplitude +-300uv
 	const uint32 numSensors = mSensors.Size();
-	for (uint32 s = 0; s<numSensors; ++s)
+	const uint32 numChannels = mGenerator.GetNumChannels();
+
+	// lock the phases of the sines to the time of the first new sample
+	const double startTime = mClock.GetTickTime(mClock.GetTick(0)).InSeconds();
+	for (uint32 s=0; s<numSensors; ++s)
 	{
-		// get the sensor
-		Sensor* sensor = mSensors[s];
+		const double sensorTime = mElectrodeTimeOffsets[s] + startTime;
+		for (uint32 c=mBandChannels[s * NUM_BANDS]; c<mBandChannels[(s+1) * NUM_BANDS]; ++c)
+			mGenerator.SetPhase(c, mSinePhases[c] + mGenerator.GetFrequency(c) * sensorTime);
+	}
+
+	// all sines of all sensors in one pass
+	mSineSamples.Resize(numChannels * numSamples);
+	mGenerator.Generate(numSamples, mSineSamples.GetPtr(), numSamples);
+
+	mSamples.Resize(numSamples);
+	mBandSamples.Resize(numSamples);
+	mModulation.Resize(numSamples);
+
+	double* samples		= mSamples.GetPtr();
+	double* bandSamples	= mBandSamples.GetPtr();
+	double* modulation	= mModulation.GetPtr();
 
-		// iterate through the samples, calculate the time and value and add them to the sensors channel
-		for (uint32 i = 0; i<numSamplesToAdd; ++i)
+	for (uint32 s=0; s<numSensors; ++s)
+	{
+		for (uint32 i=0; i<numSamples; ++i)
+			samples[i] = 0.0;
+
+		for (uint32 b=0; b<NUM_BANDS; ++b)
 		{
-			// timestamp of the oldest
-			const double sampleTime = mClock.GetTickTime(mClock.GetTick(i)).InSeconds();
-			const double offsetSampleTime = mElectrodeTimeOffsets[s] + sampleTime;
-			const double a = 100; // amplitude +-300uv
-			const double dc = 0; // DC voltage offset
-
-			// select test signal type here
-			const uint32 signalType = 4;
-
-			// value of the sample
-			double value;
-			switch (signalType)
-			{		
-				case 1: // variable amplitude, frequency and dc offset
-					value	= (numSensors-s) * sin( 2.0 * Math::pi * (s+1) * offsetSampleTime ) + s * dc;
-					break;
-
-				case 2:	// variable frequency (dc = 0V)
-					value = a * sin(2.0 * Math::pi * (s + 1) * offsetSampleTime) + dc;
-					break;
-
-				// equal distributed ac noise
-				case 3:
-					value = a * ((double)rand() / RAND_MAX -0.5) * 2.0 + dc;
-					break;
-
-				// poorly simulated brainwave (delta/alpha/SMR)
-				case 4:
-				{
-					double var, offset, amplitude;
-					value = 0;
-
-					// offset sinuses 0..3
-					offset = RemapRange( s, 0.0, numSensors, 0.4, 0.6 );
-					amplitude = a + RemapRange( s, 0.0, numSensors, 0.0, a*0.25 );
-					var = 1.0 + (sin((double)s + 2.0 * Math::pi * offsetSampleTime / 23.0) * sin(1.0 - 2.0 * Math::pi * offsetSampleTime / 13.0 ) +  sin((double)s - 2.0 * Math::pi * offsetSampleTime / 13.0 ) ) / 2.0;
-					for (double j = 0.0; j <= 3.5; j+=offset)
-						value += 0.1 * var * sin(fmod(j,0.11+(s+1)) + 2.0 * Math::pi * j * offsetSampleTime) * amplitude;
-
-					// theta sinuses 3..8 Hz
-					offset = RemapRange( s, 0.0, numSensors, 0.5, 1.0 );
-					amplitude = a - RemapRange( s, 0.0, numSensors, 0.0, a*0.25 );
-					var = 1.0 + (sin((double)s + 0.001743952 * offsetSampleTime * s) * sin(0.053309 * offsetSampleTime) + sin(0.1+0.04349 * offsetSampleTime) * sin((double)s - 2.0 * Math::pi * (0.0175543) * offsetSampleTime)) / 3.0;
-					for (double j = 3.0; j <= 8.0; j+=offset)
-						value +=  0.1 * var * sin(fmod(j,0.42+(s+1)) + 2.0 * Math::pi * j * offsetSampleTime) * amplitude;
-
-					// alpha sinuses 8..12
-					offset = RemapRange( s, 0.0, numSensors, 0.2, 0.4 );
-					amplitude = a + RemapRange( s, 0.0, numSensors, 0.0, a*0.5 );
-					var = 1.0 + (sin((double)s + 0.001284952 * offsetSampleTime * s) * sin(0.034309 * offsetSampleTime) + sin(0.1+0.01549 * offsetSampleTime) * sin((double)s - 2.0 * Math::pi * (0.0133543) * offsetSampleTime)) / 2.0;
-					for (double j = 8.0; j <= 12.0; j+=offset)
-						value +=  0.2 * var * sin(fmod(j,0.42+(s+1)) + 2.0 * Math::pi * j * offsetSampleTime) * amplitude;
-
-					// SMR 13..16
-					offset = RemapRange( s, 0.0, numSensors, 0.05, 0.2 );
-					amplitude = a + RemapRange( s, 0.0, numSensors, 0.0, a*0.25 );
-					var = 1.0 + (sin((double)s + 0.0284952 * offsetSampleTime) * sin(1.0+ 0.014309 * offsetSampleTime) + sin(0.01549 * offsetSampleTime) * sin((double)s - 2.0 + 2.0 * Math::pi * (0.033654) * offsetSampleTime) * sin(2.0 * Math::pi * (0.00765465) * offsetSampleTime))/2.0;
-					for (double j = 13.0; j <= 16.0; j+=offset)
-						value += 0.05 * var * sin(fmod(j,0.23+(s+1)) + 2.0 * Math::pi * j * offsetSampleTime) * amplitude;
-
-					// dc noise
-					//value += 0.1 * a * (double)rand() / RAND_MAX;
-
-					// ac noise
-					value += 0.3 * a * ((double)rand() / RAND_MAX -0.5) * 2.0;
-
-					value += Math::RandD( -a * 0.05, a * 0.05 );
-				}break;
-
-				default:
-					value = 0;
+			// sum of the sines of the band
+			for (uint32 i=0; i<numSamples; ++i)
+				bandSamples[i] = 0.0;
+
+			const uint32 firstChannel = mBandChannels[s * NUM_BANDS + b];
+			const uint32 endChannel = mBandChannels[s * NUM_BANDS + b + 1];
+			for (uint32 c=firstChannel; c<endChannel; ++c)
+				BlockMath::Add(bandSamples, mSineSamples.GetPtr() + c * numSamples, bandSamples, numSamples);
+
+			// multiplied with the slowly varying band amplitude
+			for (uint32 i=0; i<numSamples; ++i)
+			{
+				const double sampleTime = mElectrodeTimeOffsets[s] + mClock.GetTickTime(mClock.GetTick(i)).InSeconds();
+				modulation[i] = GetBandModulation((EBand)b, s, sampleTime);
 			}
 
-			// add the sample
-			sensor->AddQueuedSample(value);
+			BlockMath::Multiply(bandSamples, modulation, bandSamples, numSamples);
+			BlockMath::Add(samples, bandSamples, samples, numSamples);
 		}
+
+		// ac noise
+		mGenerator.GenerateWhiteNoise(numSamples, bandSamples);
+		BlockMath::AddScaled(bandSamples, 0.3 * a, samples, numSamples);
+		mGenerator.GenerateWhiteNoise(numSamples, bandSamples);
+		BlockMath::AddScaled(bandSamples, 0.05 * a, samples, numSamples);
+
+		mSensors[s]->AddQueuedSamples(samples, numSamples);
 	}
+}
 
-	// mark clock ticks as processed
-	mClock.ClearNewTicks();
 
-	// update the neuro headset
-	BciDevice::Update(elapsed, delta);
+// amplitude modulation of the bands
+double TestDevice::GetBandModulation(EBand band, double s, double t)
+{
+	switch (band)
+	{
+		case BAND_DELTA:	return 1.0 + (sin(s + 2.0 * Math::pi * t / 23.0) * sin(1.0 - 2.0 * Math::pi * t / 13.0 ) +  sin(s - 2.0 * Math::pi * t / 13.0 ) ) / 2.0;
+		case BAND_THETA:	return 1.0 + (sin(s + 0.001743952 * t * s) * sin(0.053309 * t) + sin(0.1+0.04349 * t) * sin(s - 2.0 * Math::pi * (0.0175543) * t)) / 3.0;
+		case BAND_ALPHA:	return 1.0 + (sin(s + 0.001284952 * t * s) * sin(0.034309 * t) + sin(0.1+0.01549 * t) * sin(s - 2.0 * Math::pi * (0.0133543) * t)) / 2.0;
+		case BAND_SMR:		return 1.0 + (sin(s + 0.0284952 * t) * sin(1.0+ 0.014309 * t) + sin(0.01549 * t) * sin(s - 2.0 + 2.0 * Math::pi * (0.033654) * t) * sin(2.0 * Math::pi * (0.00765465) * t))/2.0;
+		default:			return 0.0;
+	}
 }
 
 
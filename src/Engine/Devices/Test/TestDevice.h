@@ -27,6 +27,7 @@
 // include required headers
 #include "../../Config.h"
 #include "../../DSP/ClockGenerator.h"
+#include "../../DSP/SignalGenerator.h"
 #include "../../BciDevice.h"
 
 #ifdef INCLUDE_DEVICE_TEST
@@ -64,9 +65,31 @@ class ENGINE_API TestDevice : public BciDevice
 
 
 	private:
+		// simulated brainwave bands
+		enum EBand
+		{
+			BAND_DELTA,
+			BAND_THETA,
+			BAND_ALPHA,
+			BAND_SMR,
+			NUM_BANDS
+		};
+
+		void InitGenerator();
+		void GenerateSamples(uint32 numSamples);
+		static double GetBandModulation(EBand band, double sensorIndex, double time);
+
 		ClockGenerator			mClock;						// clock for generating samples
 		Core::Array<double>		mElectrodeTimeOffsets;		// random offset for each sensor
 		double					mSampleRate;				// output sample rate
+
+		SignalGenerator			mGenerator;					// one sine channel per sinus of each band and sensor
+		Core::Array<double>		mSinePhases;				// phase offset of each sine channel, in cycles
+		Core::Array<uint32>		mBandChannels;				// first sine channel of each sensor and band (NUM_BANDS entries per sensor, plus the end)
+		Core::Array<double>		mSineSamples;				// generated sines, one block per channel
+		Core::Array<double>		mSamples;					// samples of one sensor
+		Core::Array<double>		mBandSamples;				// sum of the sines of one band
+		Core::Array<double>		mModulation;				// band amplitude modulation
 };
 
 #endif
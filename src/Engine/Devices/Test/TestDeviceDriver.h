@@ -55,6 +55,9 @@ class ENGINE_API TestDeviceDriver : public DeviceDriver
 
 		bool HasAutoDetectionSupport() const override					{ return false; }
 
+		// the test devices only generate samples into their own sensors
+		bool AllowParallelDeviceUpdate() const override					{ return true; }
+
 	private:
 		double		mTimeSinceDeviceCheck;
 };
@@ -27,6 +27,7 @@
 // include required files
 #include "EngineManager.h"
 #include "Core/LogManager.h"
+#include "Core/BlockMath.h"
 #include "Devices/DeviceInventory.h"
 #include "Core/EventHandler.h"
 #include "Version.h"
@@ -45,6 +46,8 @@ EngineManager::EngineManager()
 	mCounter			= NULL;
 	mEventManager		= NULL;
 	mAttributeFactory	= NULL;
+	mSpectrumAnalyzerService = NULL;
+	mGraphTemplateCache	= NULL;
 
 	// set version
 	mVersion = Version( NEUROMORE_ENGINE_VERSION_MAJOR, NEUROMORE_ENGINE_VERSION_MINOR, NEUROMORE_ENGINE_VERSION_PATCH );
@@ -56,6 +59,14 @@ EngineManager::~EngineManager()
 {
 	LogDetailedInfo("Destructing engine manager");
 
+	// get rid of the shared spectrum analyzers first (channels destroyed below don't have to notify them anymore)
+	delete mSpectrumAnalyzerService;
+	mSpectrumAnalyzerService = NULL;
+
+	// get rid of the cached graph templates
+	delete mGraphTemplateCache;
+	mGraphTemplateCache = NULL;
+
 	// get rid of the loaded experience
 	delete mActiveExperience;
 
@@ -114,6 +125,12 @@ bool EngineManager::Init()
 	mLogManager			= new LogManager();
 	LogDetailedInfo("Initializing engine manager ...");
 
+#ifdef CORE_DEBUG
+	// make sure the vectorized block math kernels compute the same as the scalar ones
+	if (BlockMath::SelfTest() == false)
+		LogError("BlockMath self test failed, use the scalar kernels to compare the results.");
+#endif
+
 	mCounter			= new Counter();
 	mAttributeFactory	= new AttributeFactory();
 	mEventManager		= new EventManager();
@@ -148,6 +165,10 @@ bool EngineManager::Init()
 
 	// create the spectrum analyzer settings
 	mSpectrumAnalyzerSettings = new SpectrumAnalyzerSettings();
+	mSpectrumAnalyzerService = new SpectrumAnalyzerService();
+
+	// create the graph template cache
+	mGraphTemplateCache		= new GraphTemplateCache();
 
 	// create the osc router (must be created before device manager!)
 	mOscMessageRouter		= new OscMessageRouter();
@@ -224,6 +245,8 @@ void EngineManager::Update(Time delta)
 		//Sync();
 
 		mDoSync = false;
+
+		PublishChannelSnapshots();
 		return;
 	}
 
@@ -236,10 +259,64 @@ void EngineManager::Update(Time delta)
 	if (mActiveClassifier != NULL)
 		mActiveClassifier->Update(mElapsedTime, delta);
 
+	// 6) pack the OSC messages of this update into bundles and hand them over to the network thread
+	mOscMessageRouter->GetOutputBundleQueue()->Flush( mElapsedTime.InSeconds() );
+
+	// 7) calculate the shared spectra (after the classifier, so the outputs of its FFT nodes can be reused)
+	mSpectrumAnalyzerService->Update();
+
+	// 8) hand the new samples over to the readers on other threads
+	PublishChannelSnapshots();
+
 	mFpsCounter.StopTiming();
 }
 
 
+// register a channel snapshot
+void EngineManager::AddChannelSnapshot(ChannelSnapshot* snapshot)
+{
+	if (mChannelSnapshots.Contains(snapshot) == true)
+		return;
+
+	Channel<double>* source = snapshot->GetSource();
+	if (source != NULL)
+		source->SetIsObserved();
+
+	mChannelSnapshots.Add(snapshot);
+}
+
+
+// unregister a channel snapshot
+void EngineManager::RemoveChannelSnapshot(ChannelSnapshot* snapshot)
+{
+	mChannelSnapshots.RemoveByValue(snapshot);
+}
+
+
+// detach the snapshots of a channel that gets destroyed
+void EngineManager::OnChannelDestroyed(ChannelBase* channel)
+{
+	const uint32 numSnapshots = mChannelSnapshots.Size();
+	for (uint32 i=0; i<numSnapshots; ++i)
+	{
+		if (mChannelSnapshots[i]->GetSource() == channel)
+			mChannelSnapshots[i]->Detach();
+	}
+
+	if (mSpectrumAnalyzerService != NULL)
+		mSpectrumAnalyzerService->OnChannelDestroyed(channel);
+}
+
+
+// publish the new samples of all registered channel snapshots
+void EngineManager::PublishChannelSnapshots()
+{
+	const uint32 numSnapshots = mChannelSnapshots.Size();
+	for (uint32 i=0; i<numSnapshots; ++i)
+		mChannelSnapshots[i]->Publish();
+}
+
+
 void EngineManager::Reset()
 {
 	mElapsedTime = 0;
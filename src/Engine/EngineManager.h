@@ -36,12 +36,16 @@
 #include "Core/EventManager.h"
 #include "Core/EventSource.h"
 #include "Core/Counter.h"
+#include "Core/Mutex.h"
 #include "BciDevice.h"
 #include "EEGElectrodes.h"
 #include "Session.h"
 #include "Experience.h"
 #include "User.h"
 #include "DSP/SpectrumAnalyzerSettings.h"
+#include "DSP/ChannelSnapshot.h"
+#include "DSP/SpectrumAnalyzerService.h"
+#include "Graph/GraphTemplateCache.h"
 #include "Graph/GraphManager.h"
 #include "Graph/GraphObjectFactory.h"
 #include "Graph/Classifier.h"
@@ -108,6 +112,22 @@ class ENGINE_API EngineManager : public Core::EventSource
 		void Sync();
 		void SyncAsync();
 
+		//
+		// Threading
+		//
+
+		// serializes access to the engine in case it is updated on its own thread (see EngineThreadHandler)
+		void Lock()																{ mLock.Lock(); }
+		void Unlock()															{ mLock.Unlock(); }
+		bool TryLock()															{ return mLock.TryLock(); }
+
+		// snapshots of channels, published after each update so other threads can read them without locking the engine (engine has to be locked, the snapshot stays owned by the caller)
+		void AddChannelSnapshot(ChannelSnapshot* snapshot);
+		void RemoveChannelSnapshot(ChannelSnapshot* snapshot);
+
+		// detach the snapshots and spectrum analyzers of a channel that gets destroyed (called by the channel)
+		void OnChannelDestroyed(ChannelBase* channel);
+
 		//
 		// Loading 
 		//
@@ -217,6 +237,12 @@ class ENGINE_API EngineManager : public Core::EventSource
 		// spectrum analyzer settings
 		SpectrumAnalyzerSettings* GetSpectrumAnalyzerSettings()					{ return mSpectrumAnalyzerSettings; }
 
+		// shared FFTs of channels, updated after the classifier (engine has to be locked)
+		SpectrumAnalyzerService* GetSpectrumAnalyzerService()					{ return mSpectrumAnalyzerService; }
+
+		// parsed classifier and state machine files, reused when the same graph revision is loaded again
+		GraphTemplateCache* GetGraphTemplateCache()								{ return mGraphTemplateCache; }
+
 		// power line frequency
 		enum EPowerLineFrequencyType
 		{
@@ -302,6 +328,10 @@ class ENGINE_API EngineManager : public Core::EventSource
 
 		// signal processing
 		SpectrumAnalyzerSettings*		mSpectrumAnalyzerSettings;
+		SpectrumAnalyzerService*		mSpectrumAnalyzerService;
+
+		// graph loading
+		GraphTemplateCache*				mGraphTemplateCache;
 
 		// power line frequency
 		EPowerLineFrequencyType			mPowerLineFrequencyType;
@@ -331,6 +361,11 @@ class ENGINE_API EngineManager : public Core::EventSource
 		// performance timing
 		Core::FpsCounter				mFpsCounter;
 
+		// threading
+		void PublishChannelSnapshots();
+		Core::Mutex						mLock;
+		Core::Array<ChannelSnapshot*>	mChannelSnapshots;
+
 };
 
 
@@ -0,0 +1,141 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "EngineThreadHandler.h"
+#include "EngineManager.h"
+#include "Core/Thread.h"
+
+
+using namespace Core;
+
+// constructor
+EngineThreadHandler::EngineThreadHandler(double desiredFps) : ThreadHandler()
+{
+	mDesiredFps		= desiredFps;
+	mBreak			= false;
+	mHighPriority	= true;
+}
+
+
+// destructor
+EngineThreadHandler::~EngineThreadHandler()
+{
+}
+
+
+// check if the loop can be started
+bool EngineThreadHandler::Init()
+{
+	if (GetEngine() == NULL)
+	{
+		LogError("Cannot start engine thread. Engine manager not valid.");
+		return false;
+	}
+
+	return true;
+}
+
+
+// update the engine
+void EngineThreadHandler::Update(const Time& timeDelta)
+{
+	GetEngine()->Update(timeDelta);
+}
+
+
+// update the engine with the time since the last update (engine is locked)
+void EngineThreadHandler::UpdateLocked()
+{
+	const Time timeDelta = mRealTimer.GetTimeDelta();
+
+	// a large timeDelta indicates that either a severe lag has happened, or that the thread was halted for some time (e.g. PC was put in standby)
+	const double maxAllowedLag = 10.0;
+	if (timeDelta.InSeconds() > maxAllowedLag)
+	{
+		GetEngine()->SyncAsync();
+		LogError("EngineThreadHandler::UpdateLocked(): Detected a large jump in the realtime timer (%.2f s).", timeDelta.InSeconds());
+	}
+	else
+	{
+		// update engine
+		Update( timeDelta );
+	}
+}
+
+
+// start thread execution
+void EngineThreadHandler::Execute()
+{
+	mIsFinished = false;
+
+	if (Init() == false)
+	{
+		mIsFinished = true;
+		return;
+	}
+
+	if (mHighPriority == true)
+		Thread::SetCurrentThreadHighPriority();
+
+	// reset the timer
+	EngineManager* engine = GetEngine();
+	engine->Lock();
+	mRealTimer.GetTimeDelta();
+	engine->Unlock();
+
+	// real-time loop
+	while (mBreak == false)
+	{
+		mFpsCounter.BeginTiming();
+		mUpdateTimer.GetTimeDelta();
+
+		// update with the time since the last update (another thread may have updated the engine while we waited for the lock)
+		engine->Lock();
+		UpdateLocked();
+		engine->Unlock();
+
+		const double updateTime = mUpdateTimer.GetTimeDelta().InSeconds();
+		mFpsCounter.StopTiming();
+
+		OnUpdateFinished( mFpsCounter );
+
+		// update rate control
+		const double sleepTime = (1.0 / mDesiredFps) - updateTime;
+		if (mBreak == false && sleepTime > 0.0)
+			Thread::Sleep( sleepTime * 1000.0 );
+	}
+
+	mIsFinished = true;
+}
+
+
+// stop and terminate thread
+void EngineThreadHandler::Terminate()
+{
+	mBreak = true;
+}
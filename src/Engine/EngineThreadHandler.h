@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_ENGINETHREADHANDLER_H
+#define __NEUROMORE_ENGINETHREADHANDLER_H
+
+// include required headers
+#include "Config.h"
+#include "Core/StandardHeaders.h"
+#include "Core/ThreadHandler.h"
+#include "Core/Timer.h"
+#include "Core/FpsCounter.h"
+#include <atomic>
+
+
+// real-time loop that updates the engine on its own thread (run it using a Core::Thread)
+// the engine is locked during each update (see EngineManager::Lock()), so other threads have to lock it as well before accessing it
+class ENGINE_API EngineThreadHandler : public Core::ThreadHandler
+{
+	public:
+		// constructor & destructor
+		EngineThreadHandler(double desiredFps = 60.0);
+		virtual ~EngineThreadHandler();
+
+		// start thread execution
+		void Execute() override;
+
+		// stop and terminate thread
+		void Terminate() override;
+
+		// update rate of the loop (can be changed while the thread is running)
+		void SetDesiredFps(double fps)											{ mDesiredFps = fps; }
+		double GetDesiredFps() const											{ return mDesiredFps; }
+
+		// run the thread with real-time priority
+		void SetHighPriority(bool enabled = true)								{ mHighPriority = enabled; }
+
+		// update the engine from another thread that holds the engine lock while this thread can't get it (e.g. the main thread in a modal event loop);
+		// the time since the last update of either thread is counted once
+		void UpdateLocked();
+
+	protected:
+		// check if the loop can be started
+		virtual bool Init();
+
+		// update the engine (engine is locked)
+		virtual void Update(const Core::Time& timeDelta);
+
+		// called after each update with the updated fps statistics (engine is not locked)
+		virtual void OnUpdateFinished(const Core::FpsCounter& fpsCounter)		{}
+
+	private:
+		Core::FpsCounter		mFpsCounter;
+		Core::Timer				mRealTimer;			// times the differences between engine updates (real time!), only accessed while the engine is locked
+		Core::Timer				mUpdateTimer;		// times how long the engine->Update() call takes
+		std::atomic<double>		mDesiredFps;
+		std::atomic<bool>		mBreak;
+		bool					mHighPriority;
+};
+
+
+#endif
@@ -39,6 +39,8 @@ BinSelectorNode::BinSelectorNode(Graph* graph) : SPNode(graph)
 	mUseMultiChannel = true;
 	mFrequencyBand.SetMinFrequency(0);
 	mFrequencyBand.SetMaxFrequency(128);
+	mMinBinIndex = 0;
+	mNumBins = 0;
 }
 
 
@@ -115,6 +117,11 @@ void BinSelectorNode::ReInit(const Time& elapsed, const Time& delta)
 	{
 		// copy input spectrum for further reference (we only care about layout, not content)
 		mConfigSpectrum = GetInputPort(INPUTPORT_SPECTRUM).GetChannels()->GetChannel(0)->AsType<Spectrum>()->GetLastSample();
+
+		// precalculate the bin range
+		mMinBinIndex = GetMinBinIndex(mConfigSpectrum, mFrequencyBand);
+		mNumBins = GetNumBins(mConfigSpectrum, mFrequencyBand);
+
 		mIsInitialized = true;
 	}
 	else
@@ -140,9 +147,8 @@ void BinSelectorNode::Update(const Time& elapsed, const Time& delta)
 		return;	
 
 	// process all newly arrived input spectra
-	const uint32 minBinIndex = mConfigSpectrum.CalcBinIndex(mFrequencyBand.GetMinFrequency());
-	const uint32 maxBinIndex = mConfigSpectrum.CalcBinIndex(mFrequencyBand.GetMaxFrequency());
-	const int32 numBins = (maxBinIndex - minBinIndex + 1);
+	const uint32 minBinIndex = mMinBinIndex;
+	const uint32 numBins = mNumBins;
 	const uint32 numInputChannels = FindNumInputChannels();
 
 	for (uint32 i = 0; i < (uint32)numInputChannels; ++i)
@@ -152,12 +158,21 @@ void BinSelectorNode::Update(const Time& elapsed, const Time& delta)
 		const uint32 numSamples = reader->GetNumNewSamples();
 		for (uint32 s = 0; s < numSamples; ++s)
 		{
-			// copy bin values to the output channels
+			// copy bin values to the output channels (directly from the precalculated magnitudes, if the spectrum has them and the layout matches)
 			const Spectrum& spectrum = reader->PopOldestSample<Spectrum>();
-			for (uint32 b = 0; b < (uint32)numBins; ++b)
+			if (spectrum.HasMagnitudes() == true && minBinIndex + numBins <= spectrum.GetNumBins())
+			{
+				const double* magnitudes = spectrum.GetMagnitudes() + minBinIndex;
+				for (uint32 b = 0; b < numBins; ++b)
+					mOutputChannels[i*numBins + b].AddSample(magnitudes[b]);
+			}
+			else
 			{
-				const double binValue = spectrum.GetBin(minBinIndex + b);
-				mOutputChannels[i*numBins + b].AddSample(binValue);
+				for (uint32 b = 0; b < numBins; ++b)
+				{
+					const double binValue = spectrum.GetBin(minBinIndex + b);
+					mOutputChannels[i*numBins + b].AddSample(binValue);
+				}
 			}
 		}
 	}
@@ -84,6 +84,8 @@ class ENGINE_API BinSelectorNode : public SPNode
 		bool			mUseMultiChannel;
 		FrequencyBand	mFrequencyBand;				// selected frequency band
 		Spectrum		mConfigSpectrum;			// copy of first input spectrum, so we know the layout (don't care about the values)
+		uint32			mMinBinIndex;				// selected bin range, calculated on reinit
+		uint32			mNumBins;
 
 		Core::Array<Channel<double>> mOutputChannels;		// one channel per bin
 		
@@ -110,10 +110,11 @@ void BiquadFilterNode::Update(const Time& elapsed, const Time& delta)
 
 	// check filter stability  (FIXME: this is a temporary solution)
 	bool isUnstable = false;
-	const uint32 numProcessors = mProcessors.Size();
-	for (uint32 i=0; i<numProcessors; ++i)
+	MultiChannel* outputChannels = GetOutputPort(0).GetChannels();
+	const uint32 numChannels = outputChannels->GetNumChannels();
+	for (uint32 i=0; i<numChannels; ++i)
 	{
-		Channel<double>* outputChannel = mProcessors[i]->GetOutput()->AsType<double>();
+		Channel<double>* outputChannel = outputChannels->GetChannel(i)->AsType<double>();
 		if ( outputChannel->GetNumSamples() > 0 )
 		{
 			if ( Math::AbsD(outputChannel->GetLastSample()) > 10E6)
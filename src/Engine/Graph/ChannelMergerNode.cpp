@@ -108,28 +108,11 @@ void ChannelMergerNode::Update(const Time& elapsed, const Time& delta)
 	if (mIsInitialized == false)
 		return;
 
-	Port& outPort = GetOutputPort(OUTPUTPORT_MERGED); 
-	MultiChannel* outputSet = outPort.GetChannels();
-
-	const uint32 numChannels = mInputReader.GetNumChannels();
-	
 	// make sure Start() worked correctly
-	CORE_ASSERT(outputSet->GetNumChannels() == numChannels);
-
-	// forward all samples to the outputs
-	for (uint32 i = 0; i < numChannels; ++i)
-	{
-		Channel<double>* outputChannel = outputSet->GetChannel(i)->AsType<double>();
+	CORE_ASSERT(GetOutputPort(OUTPUTPORT_MERGED).GetChannels()->GetNumChannels() == mInputReader.GetNumChannels());
 
-		// read from the inputs and copy samples to output channels
-		ChannelReader* reader = mInputReader.GetReader(i);
-		const uint32 numSamples = reader->GetNumNewSamples();
-		for (uint32 s = 0; s < numSamples; ++s)
-		{
-			double sample = reader->PopOldestSample<double>();
-			outputChannel->AddSample(sample);
-		}
-	}
+	// the output channels are views of the inputs (updated in SPNode::Update()), nothing to copy
+	mInputReader.Flush(true);
 }
 
 
@@ -140,22 +123,13 @@ void ChannelMergerNode::Start(const Time& elapsed)
 	// just in case
 	CORE_ASSERT(outputSet->GetNumChannels() == 0);
 
-	// create output channels
+	// create output channels (they share the samples and parameters of the input channels)
 	const uint32 numChannels = mInputReader.GetNumChannels();
 	for (uint32 i = 0; i < numChannels; ++i)
 	{
-		// create channel if there isnt one already
 		Channel<double>* channel = new Channel<double>();
+		channel->SetViewSource(mInputReader.GetChannel(i)->AsType<double>());
 		outputSet->AddChannel(channel);
-		
-		// configure output channel to same parameters as input channel
-		Channel<double>* inputChannel = mInputReader.GetChannel(i)->AsType<double>();
-		channel->SetBufferSize(10);		// set any buffersize > 0
-		channel->SetName(inputChannel->GetName());
-		channel->SetSampleRate(inputChannel->GetSampleRate());
-		channel->SetMinValue(inputChannel->GetMinValue());
-		channel->SetMaxValue(inputChannel->GetMaxValue());
-		channel->SetColor(inputChannel->GetColor());
 	}
 
 	SPNode::Start(elapsed);
@@ -257,6 +231,5 @@ void ChannelMergerNode::DeleteOutputChannels()
 
 		outputSet->Clear();
 	}
-
 }
 
@@ -73,7 +73,6 @@ class ENGINE_API ChannelMergerNode : public SPNode
 		void UpdateInputPorts();
 		void DeleteOutputChannels();
 
-
 };
 
 
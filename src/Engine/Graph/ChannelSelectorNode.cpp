@@ -134,33 +134,18 @@ void ChannelSelectorNode::Update(const Time& elapsed, const Time& delta)
 	if (mIsInitialized == false)
 		return;
 
-	// forward all samples to the outputs
+	// the selected channels are views of the inputs (updated in SPNode::Update()); only the missing ones need samples
 	const uint32 numChannels = mMapping.Size();
 	for (uint32 i=0; i<numChannels; ++i)
 	{
 		const Mapping& m = mMapping[i];
-		ChannelReader* reader = mInputReader.FindReader(m.in);
 
 		// no input, output 0.0 at variable samplerate
-		if (!reader && m.out)
+		if (!m.in && m.out)
 			m.out->AddSample(0.0);
-
-		// no input and no output, do nothing
-		if (!reader || !m.out)
-			continue;
-
-		// forward samples from input to output
-		const uint32 numSamples = reader->GetNumNewSamples();
-		for (uint32 s = 0; s < numSamples; ++s)
-		{
-			// Note: don't pop samples here, just read them 
-			// (as we might forward one channel multiple times to different outputs)
-			double sample = reader->GetSample<double>(s);		
-			m.out->AddSample(sample);
-		}
 	}
 
-	// advance all input reader at once after samples have been processed
+	// advance all input reader at once
 	mInputReader.Flush(true);
 }
 
@@ -335,17 +320,14 @@ void ChannelSelectorNode::ReInitOutputChannels()
 	
 	for (uint32 i = 0; i < numChannels; ++i)
 	{
-		// configure output channel to same parameters as input channel
+		// selected output channels share the samples and parameters of the input channel
 		mMapping[i].out = new Channel<double>();
-		mMapping[i].out->SetBufferSize(10); // set any buffersize > 0
-		mMapping[i].out->SetName(mMapping[i].name);
 		if (mMapping[i].in)
-		{
-			mMapping[i].out->SetSampleRate(mMapping[i].in->GetSampleRate());
-			mMapping[i].out->SetMinValue(mMapping[i].in->GetMinValue());
-			mMapping[i].out->SetMaxValue(mMapping[i].in->GetMaxValue());
-			mMapping[i].out->SetColor(mMapping[i].in->GetColor());
-		}
+			mMapping[i].out->SetViewSource(mMapping[i].in);
+		else
+			mMapping[i].out->SetBufferSize(10); // set any buffersize > 0
+
+		mMapping[i].out->SetName(mMapping[i].name);
 	}
 
 	// now add connections to output ports
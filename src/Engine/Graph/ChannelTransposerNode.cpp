@@ -137,25 +137,8 @@ void ChannelTransposerNode::Update(const Time& elapsed, const Time& delta)
 
 	CORE_ASSERT(mOutputChannels.Size() == mSizeOut);
 
-	// forward all samples to the outputs transposed
-	for (uint32 i=0; i<mSizeIn; ++i)
-	{
-		CORE_ASSERT(i < mInputReader.GetNumChannels());
-		for (uint32 j=0; j<mSizeOut; ++j)
-		{
-			ChannelReader* reader = mInputReader.GetReader( mTransposedInputs[j][i] );
-			ChannelBase* output = mOutputChannels[j][i];
-
-			// TODO make forward loop independent from sample type
-			const uint32 numSamples = reader->GetNumNewSamples();
-			for (uint32 s = 0; s < numSamples; ++s)
-			{
-				double sample = reader->PopOldestSample<double>();	
-				output->AsType<double>()->AddSample(sample);
-			}
-		}
-	}
-	
+	// the output channels are transposed views of the inputs (updated in SPNode::Update()), nothing to copy
+	mInputReader.Flush(true);
 }
 
 
@@ -347,13 +330,9 @@ void ChannelTransposerNode::ReInitOutputChannels()
 			// create new channel name using the source node name
 			String newName = inputChannel->GetSourceNameString() + " " + inputChannel->GetName();
 
-			// configure output channel to same parameters as input channel
-			channel->SetBufferSize(10);		// set any buffersize > 0
+			// share the samples and parameters of the input channel
+			channel->SetViewSource(inputChannel);
 			channel->SetName(newName);
-			channel->SetSampleRate(inputChannel->GetSampleRate());
-			channel->SetMinValue(inputChannel->GetMinValue());
-			channel->SetMaxValue(inputChannel->GetMaxValue());
-			channel->SetColor(inputChannel->GetColor());
 
 			mOutputChannels[j].Add(channel);
 
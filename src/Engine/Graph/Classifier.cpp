@@ -30,6 +30,7 @@
 #include "GraphExporter.h"
 #include "../EngineManager.h"
 #include "FileWriterNode.h"
+#include "ProcessorNode.h"
 #include "VolumeControlNode.h"
 #include "ScreenBrightnessNode.h"
 #include "SpeedControlNode.h"
@@ -50,6 +51,8 @@ Classifier::Classifier(Graph* parentNode) : Graph(parentNode)
 	mIsDirty		= false;
 	mIsFinalized	= false;
 	mBufferDuration	= 10.0;
+	mAutoBufferSize	= true;
+	mIsFusionPlanDirty = true;
 
 	Core::AttributeSettings* attribInitTime = RegisterAttribute("Init Time (s)", "InitTime", "Required initialization time until classifier is stable.", Core::ATTRIBUTE_INTERFACETYPE_FLOATSPINNER);
 	attribInitTime->SetDefaultValue(Core::AttributeFloat::Create(DEFAULTINITTIME));
@@ -155,7 +158,10 @@ void Classifier::ReInit(const Time& elapsed, const Time& delta)
 	}
 
 	// resize buffers
-	ResizeBuffers(mBufferDuration);
+	if (mAutoBufferSize == true)
+		ResizeBuffers(0.0, AUTOBUFFER_RESERVE_DURATION);
+	else
+		ResizeBuffers(mBufferDuration);
 }
 
 
@@ -171,6 +177,9 @@ void Classifier::Finalize(const Time& elapsed, const Time& delta)
 	// collect all channels (must happen after reinit)
 	CollectViewChannels();
 
+	// fuse chains of element-wise nodes (must happen after reinit)
+	FuseElementwiseChains();
+
 	// collect all sensors
 	CollectUsedSensors();
 
@@ -231,7 +240,7 @@ void Classifier::ResetResizeBuffersReadyFlags()
 
 
 // resize all buffers in the graph to hold at least this many seconds of samples
-void Classifier::ResizeBuffers(double seconds)
+void Classifier::ResizeBuffers(double seconds, double reserveSeconds)
 {
 	// reset resize buffer flags of all nodes
 	ResetResizeBuffersReadyFlags();
@@ -239,7 +248,32 @@ void Classifier::ResizeBuffers(double seconds)
 	// call recursive buffer resize, beginning with the end nodes
 	const uint32 numEndNodes = mEndNodes.Size();
 	for (uint32 i = 0; i<numEndNodes; ++i)
-		mEndNodes[i]->ResizeBuffers(seconds);
+		mEndNodes[i]->ResizeBuffers(seconds, reserveSeconds, Max(seconds, AUTOBUFFER_MAX_DURATION));
+}
+
+
+// find the highest buffer high-water mark of all nodes
+uint32 Classifier::FindMaxBufferHighWaterMark() const
+{
+	uint32 highWaterMark = 0;
+
+	const uint32 numNodes = mNodes.Size();
+	for (uint32 i=0; i<numNodes; ++i)
+	{
+		Node* node = mNodes[i];
+		if (node->GetNodeType() == Node::NODE_TYPE)
+			continue;
+
+		const uint32 numOutputs = node->GetNumOutputPorts();
+		for (uint32 j=0; j<numOutputs; ++j)
+		{
+			MultiChannel* channels = node->GetOutputPort(j).GetChannels();
+			if (channels != NULL)
+				highWaterMark = Max(highWaterMark, channels->GetMaxHighWaterMark());
+		}
+	}
+
+	return highWaterMark;
 }
 
 
@@ -822,6 +856,130 @@ void Classifier::CollectViewChannels()
 }
 
 
+// find the pairs of processor nodes that may be fused, based on the graph structure only
+//  - a node is fused into its successor only if the successor is the one and only consumer of its output, so the samples of the node are not read by anyone else
+//  - the successor must not have other input connections
+void Classifier::BuildFusionPlan()
+{
+	mFusionSources.Clear(false);
+	mFusionTargets.Clear(false);
+
+	const uint32 numNodes = mNodes.Size();
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		if (mNodes[i]->GetNodeType() != ProcessorNode::NODE_TYPE)
+			continue;
+
+		ProcessorNode* node = static_cast<ProcessorNode*>(mNodes[i]);
+		if (CalcNumInputConnections(node) != 1)
+			continue;
+
+		// the only input connection
+		Connection* connection = NULL;
+		const uint32 numInputPorts = node->GetNumInputPorts();
+		for (uint32 p = 0; p < numInputPorts && connection == NULL; ++p)
+			connection = node->GetInputPort(p).GetConnection();
+
+		if (connection == NULL || connection->GetSourceNode()->GetNodeType() != ProcessorNode::NODE_TYPE)
+			continue;
+
+		ProcessorNode* sourceNode = static_cast<ProcessorNode*>(connection->GetSourceNode());
+		if (CalcNumOutputConnections(sourceNode) != 1)
+			continue;
+
+		mFusionSources.Add(sourceNode);
+		mFusionTargets.Add(node);
+	}
+
+	mIsFusionPlanDirty = false;
+}
+
+
+// fuse linear chains of element-wise processor nodes (e.g. Math1 -> Remap -> Smooth) into a single block kernel that is run by the last node of the chain
+// the structural part is taken from the fusion plan, here only the processor configuration (which may change on every reinit) is checked
+void Classifier::FuseElementwiseChains()
+{
+	if (mIsFusionPlanDirty == true)
+		BuildFusionPlan();
+
+	const uint32 numNodes = mNodes.Size();
+
+	// 1) reset fusion of all processor nodes
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		if (mNodes[i]->GetNodeType() != ProcessorNode::NODE_TYPE)
+			continue;
+
+		static_cast<ProcessorNode*>(mNodes[i])->ClearFusion();
+	}
+
+	// 2) link each element-wise node to its element-wise source node
+	const uint32 numPairs = mFusionTargets.Size();
+	for (uint32 i = 0; i < numPairs; ++i)
+	{
+		ProcessorNode* node = mFusionTargets[i];
+		ProcessorNode* sourceNode = mFusionSources[i];
+
+		// the connection must go to the element-wise input
+		const uint32 inputPort = node->GetElementwiseInputPort();
+		if (inputPort == CORE_INVALIDINDEX32)
+			continue;
+
+		Connection* connection = node->GetInputPort(inputPort).GetConnection();
+		if (connection == NULL || connection->GetSourceNode() != sourceNode)
+			continue;
+
+		// the source must be element-wise as well and have the same number of processors
+		if (sourceNode->IsElementwise() == false || sourceNode->GetNumProcessors() != node->GetNumProcessors())
+			continue;
+
+		sourceNode->SetFusedInto(node);
+	}
+
+	// 3) collect the chains at their last node
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		if (mNodes[i]->GetNodeType() != ProcessorNode::NODE_TYPE)
+			continue;
+
+		ProcessorNode* tailNode = static_cast<ProcessorNode*>(mNodes[i]);
+		if (tailNode->GetFusedInto() != NULL)
+			continue;
+
+		// walk upstream as long as the nodes are fused
+		ProcessorNode* node = tailNode;
+		uint32 numChainNodes = 0;
+		while (true)
+		{
+			const uint32 inputPort = node->GetElementwiseInputPort();
+			if (inputPort == CORE_INVALIDINDEX32)
+				break;
+
+			Connection* connection = node->GetInputPort(inputPort).GetConnection();
+			if (connection == NULL || connection->GetSourceNode()->GetNodeType() != ProcessorNode::NODE_TYPE)
+				break;
+
+			ProcessorNode* sourceNode = static_cast<ProcessorNode*>(connection->GetSourceNode());
+			if (sourceNode->GetFusedInto() != node)
+				break;
+
+			node = sourceNode;
+			numChainNodes++;
+		}
+
+		if (numChainNodes == 0)
+			continue;
+
+		// add the chain nodes to the tail, starting with the head
+		for (uint32 n = 0; n < numChainNodes; ++n)
+		{
+			tailNode->AddFusedNode(node);
+			node = node->GetFusedInto();
+		}
+	}
+}
+
+
 // collect all used sensors
 void Classifier::CollectUsedSensors()
 {
@@ -1048,6 +1206,9 @@ void Classifier::OnGraphModified(Graph* graph, GraphObject* object)
 
 	// immediately update nodes lists
 	CollectObjects();
+
+	// connections changed
+	mIsFusionPlanDirty = true;
 }
 
 
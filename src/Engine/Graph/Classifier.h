@@ -58,6 +58,11 @@ class ENGINE_API Classifier : public Graph, public Core::EventHandler
 		// default initialization time until e.g. filters are stable
 		constexpr static const double DEFAULTINITTIME = 0.0;
 
+		// automatic buffer size: realtime reserve every buffer holds on top of what its readers need (longer stalls grow the buffer at runtime),
+		// and how far buffers of lagging readers may grow beyond that (in seconds)
+		constexpr static const double AUTOBUFFER_RESERVE_DURATION = 1.0;
+		constexpr static const double AUTOBUFFER_MAX_DURATION = 60.0;
+
 		Classifier(Graph* parentNode=NULL);
 		virtual ~Classifier();
 
@@ -191,14 +196,22 @@ class ENGINE_API Classifier : public Graph, public Core::EventHandler
 		//  Buffers
 		//
 		
-		// the the number of seconds the buffers can hold at maximum
+		// the the number of seconds the buffers can hold at maximum (only used if the automatic buffer size is disabled)
 		void SetBufferDuration(double seconds)								{ mBufferDuration = seconds; }
+		double GetBufferDuration() const									{ return mBufferDuration; }
+
+		// automatic buffer size: every buffer only holds what its readers need plus a small realtime reserve, and grows at runtime if a reader falls behind
+		void SetAutoBufferSizeEnabled(bool enable = true)					{ mAutoBufferSize = enable; }
+		bool IsAutoBufferSizeEnabled() const								{ return mAutoBufferSize; }
 
 		// reset buffers
 		void ResetBuffers();
 
-		// recursive resize of all buffers
-		void ResizeBuffers(double seconds);
+		// recursive resize of all buffers (holding at least the given number of seconds, and the reserve on top of what the readers need)
+		void ResizeBuffers(double seconds, double reserveSeconds = 0.0);
+
+		// buffer telemetry: largest number of samples any reader required since the last reinit
+		uint32 FindMaxBufferHighWaterMark() const;
 		void ResetResizeBuffersReadyFlags();
 
 		//
@@ -264,6 +277,8 @@ class ENGINE_API Classifier : public Graph, public Core::EventHandler
 		Core::Array<SPNode*>					mEndNodes;				// all instances of nodes that have no children
 
 		void CollectViewChannels();
+		void FuseElementwiseChains();
+		void BuildFusionPlan();
 		Core::Array<MultiChannel>				mViewChannels;			// all view channels (double)
 		Core::Array<ViewNode*>					mViewNodeMap;			// all the nodes that provide the view channels
 		Core::Array<MultiChannel>				mViewSpectrumChannels;	// all view channels (Spectrum)
@@ -272,6 +287,12 @@ class ENGINE_API Classifier : public Graph, public Core::EventHandler
 		bool	mIsPaused;				
 		bool	mIsFinalized;			// true, after finalize() was called, until something is changed
 		double  mBufferDuration;		// number of seconds the buffers can take (also defines the absolute minimum update frequency)
+		bool	mAutoBufferSize;		// size the buffers by the requirements of their readers instead of mBufferDuration
+
+		// element-wise chain fusion plan (only depends on the graph structure, rebuilt after the graph was modified)
+		Core::Array<ProcessorNode*>				mFusionSources;			// processor nodes with exactly one consumer ...
+		Core::Array<ProcessorNode*>				mFusionTargets;			// ... which is this processor node, reading it through its only input connection
+		bool									mIsFusionPlanDirty;
 };
 
 
@@ -325,32 +325,74 @@ void CompareNode::Processor::Update()
 			y = mSettings.mStaticValue;
 
 		// compare both values
-		const bool compareResult = mSettings.mCalculateFunc(x,y);
-		double result = 0.0;
-
-		// output value depends on settings
-		if (compareResult == true)
-		{
-			// TRUE
-			if (mSettings.mTrueReturnMode == CompareNode::MODE_VALUE)
-				result = mSettings.mTrueValue;
-			else if (mSettings.mTrueReturnMode == CompareNode::MODE_X)
-				result = x;
-			else 
-				result = y;
-		}
-		else
-		{
-			// FALSE
-			if (mSettings.mFalseReturnMode == CompareNode::MODE_VALUE)
-				result = mSettings.mFalseValue;
-			else if (mSettings.mFalseReturnMode == CompareNode::MODE_X)
-				result = x;
-			else 
-				result = y;
-		}
+		const double result = Compare(x, y);
 
 		// add output sample
 		output->AsType<double>()->AddSample(result);
 	}
 }
+
+
+// compare the two values and select the output value
+double CompareNode::Processor::Compare(double x, double y) const
+{
+	const bool compareResult = mSettings.mCalculateFunc(x,y);
+	double result = 0.0;
+
+	// output value depends on settings
+	if (compareResult == true)
+	{
+		// TRUE
+		if (mSettings.mTrueReturnMode == CompareNode::MODE_VALUE)
+			result = mSettings.mTrueValue;
+		else if (mSettings.mTrueReturnMode == CompareNode::MODE_X)
+			result = x;
+		else 
+			result = y;
+	}
+	else
+	{
+		// FALSE
+		if (mSettings.mFalseReturnMode == CompareNode::MODE_VALUE)
+			result = mSettings.mFalseValue;
+		else if (mSettings.mFalseReturnMode == CompareNode::MODE_X)
+			result = x;
+		else 
+			result = y;
+	}
+
+	return result;
+}
+
+
+// element-wise only if a single channel is connected, the other operand is the static value then
+uint32 CompareNode::Processor::GetElementwiseInputIndex() const
+{
+	ChannelBase* channelX = GetInput(0);
+	ChannelBase* channelY = GetInput(1);
+
+	if (channelX != NULL && channelY == NULL)
+		return 0;
+
+	if (channelX == NULL && channelY != NULL)
+		return 1;
+
+	return CORE_INVALIDINDEX32;
+}
+
+
+void CompareNode::Processor::ProcessBlock(double* samples, uint32 numSamples)
+{
+	const double staticValue = mSettings.mStaticValue;
+
+	if (GetInput(0) != NULL)
+	{
+		for (uint32 i=0; i<numSamples; ++i)
+			samples[i] = Compare(samples[i], staticValue);
+	}
+	else
+	{
+		for (uint32 i=0; i<numSamples; ++i)
+			samples[i] = Compare(staticValue, samples[i]);
+	}
+}
@@ -156,7 +156,13 @@ class ENGINE_API CompareNode : public ProcessorNode
 				void ReInit() override;
 				void Update() override;
 
+				// element-wise block kernel
+				uint32 GetElementwiseInputIndex() const override;
+				void ProcessBlock(double* samples, uint32 numSamples) override;
+
 			private:
+				double Compare(double x, double y) const;
+
 				ProcessorSettings		mSettings;
 		};
 };
@@ -211,7 +211,7 @@ void DominantFrequencyNode::Processor::Update()
 	for (uint32 i = 0; i<numNewSpectrums; i++)
 	{
 		const Spectrum&  spectrum = input->PopOldestSample<Spectrum>();
-		const double dominantFrequency = spectrum.CalcDominantFrequency(mSettings.mBand.GetMinFrequency(), mSettings.mBand.GetMaxFrequency());
+		const double dominantFrequency = mSettings.mBand.CalcDominantFrequency(&spectrum);
 		output->AddSample(dominantFrequency);
 	}
 }
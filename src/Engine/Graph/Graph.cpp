@@ -41,6 +41,7 @@ Graph::Graph(Graph* parentGraph) : GraphObject(parentGraph)
 	// initialize to invalid revision
 	mRevision = CORE_INVALIDINDEX32;
 	mUseGraphSettings = false;
+	mIsLoading = false;
 }
 
 
@@ -125,7 +126,8 @@ void Graph::AddNode(Node* node)
 	node->SetParent(this);
 
 	// graph callback
-	OnGraphModified(this, node);
+	if (mIsLoading == false)
+		OnGraphModified(this, node);
 	OnCreatedNode(this, node);
 	// TODO add tochild graph list if node is a graph
 
@@ -333,7 +335,8 @@ bool Graph::AddConnection(Connection* connection)
 	mObjects.Add(connection);
 
 	// graph callbacks
-	OnGraphModified(this, connection);
+	if (mIsLoading == false)
+		OnGraphModified(this, connection);
 	OnCreatedConnection(this, connection);
 
 	// fire signal after connection got added
@@ -682,8 +685,11 @@ bool Graph::ApplySettings(const GraphSettings& settings)
 	{
 		const char* attributeName = settings.GetName(i);
 
+		// hash the name only once, it is looked up in all objects of the graph
+		const NameKey attributeKey(attributeName);
+
 		// graph's attributes
-		const uint32 graphAttribute = FindAttributeIndexByInternalName(attributeName);
+		const uint32 graphAttribute = FindAttributeIndexByInternalName(attributeKey);
 		if (graphAttribute != CORE_INVALIDINDEX32)
 			GetAttributeValue(graphAttribute)->InitFromString(settings.GetValue(i));
 
@@ -703,7 +709,7 @@ bool Graph::ApplySettings(const GraphSettings& settings)
 
 			if (typeMatched && (uuidMatched || nameMatched))
 			{
-				uint32 attributeIndex = object->FindAttributeIndexByInternalName(attributeName);
+				uint32 attributeIndex = object->FindAttributeIndexByInternalName(attributeKey);
 
 				// settings not found; this is not an error, we don't know if the graph has the settings or not. Just continue.
 				if (attributeIndex == CORE_INVALIDINDEX32)
@@ -875,6 +881,9 @@ bool Graph::Load(const Json& json, const Json::Item& item)
 	if (!AttributeSet::Read(json, item, true))
 		success = false;
 
+	// don't rebuild the node lists for every single node and connection, only once the graph is complete
+	mIsLoading = true;
+
 	// 1: load all nodes
 	if (GraphImporter::LoadNodes(json, item, this) == false)
 		success = false;
@@ -883,6 +892,9 @@ bool Graph::Load(const Json& json, const Json::Item& item)
 	if (GraphImporter::LoadConnections(json, item, this) == false)
 		success = false;
 
+	mIsLoading = false;
+	OnGraphModified(this, NULL);
+
 	return success;
 }
 
@@ -185,6 +185,7 @@ class ENGINE_API Graph : public GraphObject
 		uint32						mRevision;
 
 		bool						mUseGraphSettings;	// if graph settings were applied
+		bool						mIsLoading;			// the graph modified callback is called only once after all nodes and connections were loaded
 
 		Core::FpsCounter			mFpsCounter;
 
@@ -38,8 +38,12 @@
 using namespace Core;
 
 
-bool GraphImporter::LoadFromJSON(const Json& json, const Json::Item& rootItem, Graph* rootNode)
+bool GraphImporter::LoadFromJSON(const Json& json, const Json::Item& rootItem, Graph* rootNode, bool translateDeprecated)
 {
+	// translate deprecated nodes
+	if (translateDeprecated == true)
+		TranslateDeprecatedNodes(rootItem);
+
 	// disable events when loading the graph
 	rootNode->SetEmitEvents( false );
 
@@ -137,6 +141,22 @@ bool GraphImporter::LoadFromFile(const char* filename, Graph* rootNode)
 // Nodes
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// translate the deprecated nodes
+void GraphImporter::TranslateDeprecatedNodes(const Json::Item& rootItem)
+{
+	Json::Item nodesItem = rootItem.Find("nodes");
+	if (nodesItem.IsArray() == false)
+		return;
+
+	const uint32 numNodes = nodesItem.Size();
+	for (uint32 i=0; i<numNodes; ++i)
+	{
+		Json::Item nodeItem = nodesItem[i];
+		DeprecatedGraphObjects::TranslateNode(nodeItem);
+	}
+}
+
+
 // load the graph nodes
 bool GraphImporter::LoadNodes(const Json& json, const Json::Item& item, Graph* graph)
 {
@@ -173,10 +193,7 @@ bool GraphImporter::LoadNode(const Json& json, const Json::Item& nodeItem, Graph
 	Json::Item typeItem = nodeItem.Find("type");
 	if (typeItem.IsString() == false)
 		return false;
-	
-	// translate deprecated nodes
-	DeprecatedGraphObjects::TranslateNode(const_cast<Json::Item&>(nodeItem)); // CONST CAST
-	
+
 	// create the node
 	GraphObject* object = GetGraphObjectFactory()->CreateObjectByTypeUuid( graph, typeItem.GetString() );
 	if (object == NULL)
@@ -214,6 +231,34 @@ bool GraphImporter::LoadNode(const Json& json, const Json::Item& nodeItem, Graph
 // Connections
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// build the node lookup table (uuids are compared case insensitive, like in Graph::FindNodeByUuid())
+GraphImporter::NodeUuidIndex::NodeUuidIndex(Graph* graph)
+{
+	const uint32 numNodes = graph->GetNumNodes();
+	mNodes.reserve(numNodes);
+
+	for (uint32 i=0; i<numNodes; ++i)
+	{
+		Node* node = graph->GetNode(i);
+		mNodes.emplace( node->GetUuidString().Lowered(), node );
+	}
+}
+
+
+// find a node by uuid, returns NULL if there is none
+Node* GraphImporter::NodeUuidIndex::Find(const char* uuid) const
+{
+	String key = uuid;
+	key.ToLower();
+
+	auto it = mNodes.find(key);
+	if (it == mNodes.end())
+		return NULL;
+
+	return it->second;
+}
+
+
 // load the connections
 bool GraphImporter::LoadConnections(const Json& json, const Json::Item& item, Graph* graph)
 {
@@ -225,11 +270,14 @@ bool GraphImporter::LoadConnections(const Json& json, const Json::Item& item, Gr
 		return true;
 	}
 
+	// find the nodes by uuid through a lookup table instead of searching the graph for every connection
+	const NodeUuidIndex nodeIndex(graph);
+
 	// get the number of child items and iterate through them
 	bool success = true;
 	const uint32 numConnections = connectionsItem.Size();
 	for (uint32 i = 0; i < numConnections; ++i)
-		if (LoadConnection(json, connectionsItem[i], graph) == NULL)
+		if (LoadConnection(json, connectionsItem[i], graph, nodeIndex) == NULL)
 			success = false;
 
 	return success;
@@ -237,7 +285,7 @@ bool GraphImporter::LoadConnections(const Json& json, const Json::Item& item, Gr
 
 
 // load a connection from the given json item
-Connection* GraphImporter::LoadConnection(const Json& json, const Json::Item& connectionItem, Graph* graph)
+Connection* GraphImporter::LoadConnection(const Json& json, const Json::Item& connectionItem, Graph* graph, const NodeUuidIndex& nodeIndex)
 {
 	// make sure the given item is valid
 	if (connectionItem.IsNull() == true)
@@ -256,8 +304,8 @@ Connection* GraphImporter::LoadConnection(const Json& json, const Json::Item& co
 		targetNodeUuid = targetNodeItem.GetString();
 
 	// get the source and the target node and check if they are valid
-	Node* sourceNode = graph->FindNodeByUuid( sourceNodeUuid.AsChar() );
-	Node* targetNode = graph->FindNodeByUuid( targetNodeUuid.AsChar() );
+	Node* sourceNode = nodeIndex.Find( sourceNodeUuid.AsChar() );
+	Node* targetNode = nodeIndex.Find( targetNodeUuid.AsChar() );
 	if (sourceNode == NULL || targetNode == NULL)
 	{
 		LogError( "GraphImporter::LoadGraphConnection() - Connection cannot be created because the source or target node cannot be found (sourceNodeUuid='%s' targetNodeUuid='%s').", sourceNodeUuid.AsChar(), targetNodeUuid.AsChar() );
@@ -319,12 +367,15 @@ bool GraphImporter::LoadTransitions(const Json& json, const Json::Item& item, Gr
 	// type-cast graph to state machine
 	StateMachine* stateMachine = static_cast<StateMachine*>(graph);
 
+	// find the states by uuid through a lookup table
+	const NodeUuidIndex nodeIndex(graph);
+
 	// get the number of child items and iterate through them
 	bool success = true;
 	const uint32 numTransitions = transitionsItem.Size();
 	for (uint32 i=0; i<numTransitions; ++i)
 	{
-		if (LoadTransition(json, transitionsItem[i], stateMachine) == false)
+		if (LoadTransition(json, transitionsItem[i], stateMachine, nodeIndex) == false)
 			success = false;
 	}
 
@@ -333,7 +384,7 @@ bool GraphImporter::LoadTransitions(const Json& json, const Json::Item& item, Gr
 
 
 // load a connection from the given json item
-bool GraphImporter::LoadTransition(const Json& json, const Json::Item& transitionItem, StateMachine* stateMachine)
+bool GraphImporter::LoadTransition(const Json& json, const Json::Item& transitionItem, StateMachine* stateMachine, const NodeUuidIndex& nodeIndex)
 {
 	// make sure the given item is valid
 	if (transitionItem.IsNull() == true)
@@ -354,8 +405,8 @@ bool GraphImporter::LoadTransition(const Json& json, const Json::Item& transitio
 		targetNodeUuid = targetNodeItem.GetString();
 
 	// get the source and the target node and check if they are valid
-	Node* sourceNode = stateMachine->FindNodeByUuid( sourceNodeUuid.AsChar() );
-	Node* targetNode = stateMachine->FindNodeByUuid( targetNodeUuid.AsChar() );
+	Node* sourceNode = nodeIndex.Find( sourceNodeUuid.AsChar() );
+	Node* targetNode = nodeIndex.Find( targetNodeUuid.AsChar() );
 	if (sourceNode == NULL || targetNode == NULL)
 	{
 		LogError( "GraphImporter::LoadTransition() - Transition cannot be created because the source or target state cannot be found (sourceStateUuid='%s' targetStateUuid='%s').", sourceNodeUuid.AsChar(), targetNodeUuid.AsChar() );
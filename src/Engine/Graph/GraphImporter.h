@@ -31,6 +31,7 @@
 #include "Graph.h"
 #include "Classifier.h"
 #include "StateMachine.h"
+#include <unordered_map>
 
 
 class ENGINE_API GraphImporter
@@ -40,21 +41,36 @@ class ENGINE_API GraphImporter
 	friend class Graph;
 
 	public:
-		static bool LoadFromJSON(const Core::Json& json, const Core::Json::Item& rootItem, Graph* rootNode);
+		// the deprecated nodes are translated in place first, unless the JSON was already translated (e.g. a cached graph template, which must not be modified)
+		static bool LoadFromJSON(const Core::Json& json, const Core::Json::Item& rootItem, Graph* rootNode, bool translateDeprecated = true);
 		static bool LoadFromFile(const char* filename, Graph* rootNode);
 		static bool LoadFromString(const char* jsonString, Graph* rootNode);
 
+		// translate the deprecated nodes of the graph with the given root item
+		static void TranslateDeprecatedNodes(const Core::Json::Item& rootItem);
+
 	private:
+		// lookup table of the nodes by uuid, built once before the connections are loaded
+		class NodeUuidIndex
+		{
+			public:
+				NodeUuidIndex(Graph* graph);
+				Node* Find(const char* uuid) const;
+
+			private:
+				std::unordered_map<Core::String, Node*, Core::StringHasher> mNodes;
+		};
+
 		// nodes
 		static bool LoadNode(const Core::Json& json, const Core::Json::Item& nodeItem, Graph* graph);
 		static bool LoadNodes(const Core::Json& json, const Core::Json::Item& item, Graph* graph);
 	
 		// connection loading helpers
-		static Connection* LoadConnection(const Core::Json& json, const Core::Json::Item& connectionItem, Graph* graph);
+		static Connection* LoadConnection(const Core::Json& json, const Core::Json::Item& connectionItem, Graph* graph, const NodeUuidIndex& nodeIndex);
 		static bool LoadConnections(const Core::Json& json, const Core::Json::Item& item, Graph* graph);
 
 		// transition loading helpers
-		static bool LoadTransition(const Core::Json& json, const Core::Json::Item& transitionItem, StateMachine* stateMachine);
+		static bool LoadTransition(const Core::Json& json, const Core::Json::Item& transitionItem, StateMachine* stateMachine, const NodeUuidIndex& nodeIndex);
 		static bool LoadTransitions(const Core::Json& json, const Core::Json::Item& item, Graph* graph);
 };
 
@@ -135,10 +135,9 @@ bool GraphObject::OnAttributeChanged(Attribute* attribute)
 			continue;
 
 		AttributeSettings* settings = GetAttributeSettings(i);
-		const char* internalName = settings->GetInternalName();
 
-		// already containe in modified attributes list?
-		const uint32 modifiedIndex = mChangedAttributes.FindAttributeIndexByInternalName(internalName);
+		// already containe in modified attributes list? (reuse the name hash of the settings)
+		const uint32 modifiedIndex = mChangedAttributes.FindAttributeIndexByInternalName( NameKey(settings->GetInternalName(), settings->GetInternalNameHash()) );
 		if (modifiedIndex == CORE_INVALIDINDEX32)
 		{
 			// add attribute to modified list
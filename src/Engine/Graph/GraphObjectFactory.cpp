@@ -79,6 +79,7 @@
 // DSP
 #include "FFTNode.h"
 #include "LinearFilterNode.h"
+#include "SpatialFilterNode.h"
 #include "FrequencyBandNode.h"
 #include "DominantFrequencyNode.h"
 #include "BiquadFilterNode.h"
@@ -210,6 +211,7 @@ GraphObjectFactory::GraphObjectFactory()
 		// DSP nodes
 		RegisterObjectType( new FFTNode(NULL) );
 		RegisterObjectType( new LinearFilterNode(NULL) );
+		RegisterObjectType( new SpatialFilterNode(NULL) );
 		RegisterObjectType( new FrequencyBandNode(NULL) );
 		RegisterObjectType( new DominantFrequencyNode(NULL) );
 		RegisterObjectType( new BiquadFilterNode(NULL) );
@@ -0,0 +1,255 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required files
+#include "GraphTemplateCache.h"
+#include "GraphImporter.h"
+#include "../Core/LogManager.h"
+#include "../Core/Timer.h"
+
+
+using namespace Core;
+
+// constructor
+GraphTemplateCache::GraphTemplateCache(uint32 maxNumTemplates)
+{
+	mMaxNumTemplates	= Max<uint32>(1, maxNumTemplates);
+	mUseCounter			= 0;
+}
+
+
+// destructor
+GraphTemplateCache::~GraphTemplateCache()
+{
+	Clear();
+}
+
+
+// parse the json and translate deprecated objects
+Json* GraphTemplateCache::CreateTemplate(const char* jsonContent)
+{
+	Json* json = new Json();
+	if (json->Parse(jsonContent) == false)
+	{
+		LogWarning("GraphTemplateCache: JSON parser failed.");
+		delete json;
+		return NULL;
+	}
+
+	// translate deprecated nodes now, so the template is only read when graphs are instantiated from it
+	GraphImporter::TranslateDeprecatedNodes(json->GetRootItem());
+
+	return json;
+}
+
+
+// parse the JSON and add it as template
+bool GraphTemplateCache::Add(const char* jsonContent, const char* uuid, int32 revision)
+{
+	if (jsonContent == NULL || uuid == NULL || uuid[0] == '\0')
+		return false;
+
+	const uint32 contentHash	= String::CalcHash(jsonContent);
+	const uint32 contentLength	= String::CalcLength(jsonContent);
+
+	mLock.Lock();
+	const bool isCached = (FindTemplate(uuid, revision, contentHash, contentLength) != CORE_INVALIDINDEX32);
+	mLock.Unlock();
+
+	if (isCached == true)
+		return true;
+
+	// parse without holding the lock (this is the expensive part)
+	Json* json = CreateTemplate(jsonContent);
+	if (json == NULL)
+		return false;
+
+	mLock.Lock();
+	AddTemplate(uuid, revision, contentHash, contentLength, json);
+	mLock.Unlock();
+
+	return true;
+}
+
+
+// load the graph from the cached template
+bool GraphTemplateCache::Load(const char* jsonContent, const char* uuid, int32 revision, Graph* graph)
+{
+	// not cacheable
+	if (uuid == NULL || uuid[0] == '\0')
+		return GraphImporter::LoadFromString(jsonContent, graph);
+
+	Timer loadTimer;
+
+	const uint32 contentHash	= String::CalcHash(jsonContent);
+	const uint32 contentLength	= String::CalcLength(jsonContent);
+
+	// the lock is held while the graph is instantiated, so the template can't be evicted in the meantime
+	mLock.Lock();
+
+	bool wasCached = true;
+	uint32 index = FindTemplate(uuid, revision, contentHash, contentLength);
+	if (index == CORE_INVALIDINDEX32)
+	{
+		wasCached = false;
+
+		Json* json = CreateTemplate(jsonContent);
+		if (json == NULL)
+		{
+			mLock.Unlock();
+			return false;
+		}
+
+		AddTemplate(uuid, revision, contentHash, contentLength, json);
+		index = FindTemplate(uuid, revision, contentHash, contentLength);
+	}
+
+	Template& graphTemplate = mTemplates[index];
+	graphTemplate.mLastUsed = ++mUseCounter;
+
+	const Json& json = *graphTemplate.mJson;
+	const bool success = GraphImporter::LoadFromJSON(json, json.GetRootItem(), graph, false);
+
+	mLock.Unlock();
+
+	// log the timing information
+	const float loadTime = loadTimer.GetTime().InSeconds();
+	LogInfo( "Loading %s took %.1f ms (%s).", graph->GetReadableType(), loadTime * 1000.0f, wasCached ? "cached template" : "new template" );
+
+	return success;
+}
+
+
+// check if there is a template for the given graph revision
+bool GraphTemplateCache::Contains(const char* uuid, int32 revision) const
+{
+	bool result = false;
+
+	mLock.Lock();
+	const uint32 numTemplates = mTemplates.Size();
+	for (uint32 i=0; i<numTemplates; ++i)
+	{
+		if (mTemplates[i].mRevision == revision && mTemplates[i].mUuid.IsEqual(uuid) == true)
+		{
+			result = true;
+			break;
+		}
+	}
+	mLock.Unlock();
+
+	return result;
+}
+
+
+// get the number of cached templates
+uint32 GraphTemplateCache::GetNumTemplates() const
+{
+	mLock.Lock();
+	const uint32 result = mTemplates.Size();
+	mLock.Unlock();
+
+	return result;
+}
+
+
+// remove all templates
+void GraphTemplateCache::Clear()
+{
+	mLock.Lock();
+
+	const uint32 numTemplates = mTemplates.Size();
+	for (uint32 i=0; i<numTemplates; ++i)
+		delete mTemplates[i].mJson;
+
+	mTemplates.Clear();
+
+	mLock.Unlock();
+}
+
+
+// find the template with the given key
+uint32 GraphTemplateCache::FindTemplate(const char* uuid, int32 revision, uint32 contentHash, uint32 contentLength) const
+{
+	const uint32 numTemplates = mTemplates.Size();
+	for (uint32 i=0; i<numTemplates; ++i)
+	{
+		const Template& graphTemplate = mTemplates[i];
+		if (graphTemplate.mRevision == revision && graphTemplate.mContentHash == contentHash && graphTemplate.mContentLength == contentLength && graphTemplate.mUuid.IsEqual(uuid) == true)
+			return i;
+	}
+
+	return CORE_INVALIDINDEX32;
+}
+
+
+// add a template, replaces older templates of the same graph and evicts the least recently used one if the cache is full
+void GraphTemplateCache::AddTemplate(const char* uuid, int32 revision, uint32 contentHash, uint32 contentLength, Json* json)
+{
+	// another thread added the same template in the meantime
+	if (FindTemplate(uuid, revision, contentHash, contentLength) != CORE_INVALIDINDEX32)
+	{
+		delete json;
+		return;
+	}
+
+	// remove outdated templates of the same graph
+	for (uint32 i=0; i<mTemplates.Size();)
+	{
+		if (mTemplates[i].mUuid.IsEqual(uuid) == true)
+		{
+			delete mTemplates[i].mJson;
+			mTemplates.Remove(i);
+		}
+		else
+			i++;
+	}
+
+	// evict the least recently used template
+	if (mTemplates.Size() >= mMaxNumTemplates)
+	{
+		uint32 oldestIndex = 0;
+		const uint32 numTemplates = mTemplates.Size();
+		for (uint32 i=1; i<numTemplates; ++i)
+		{
+			if (mTemplates[i].mLastUsed < mTemplates[oldestIndex].mLastUsed)
+				oldestIndex = i;
+		}
+
+		delete mTemplates[oldestIndex].mJson;
+		mTemplates.Remove(oldestIndex);
+	}
+
+	Template graphTemplate;
+	graphTemplate.mUuid				= uuid;
+	graphTemplate.mRevision			= revision;
+	graphTemplate.mContentHash		= contentHash;
+	graphTemplate.mContentLength	= contentLength;
+	graphTemplate.mJson				= json;
+	graphTemplate.mLastUsed			= ++mUseCounter;
+
+	mTemplates.Add(graphTemplate);
+}
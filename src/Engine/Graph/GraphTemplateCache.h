@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_GRAPHTEMPLATECACHE_H
+#define __NEUROMORE_GRAPHTEMPLATECACHE_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/String.h"
+#include "../Core/Array.h"
+#include "../Core/Json.h"
+#include "../Core/Mutex.h"
+#include "Graph.h"
+
+
+// Parsed and validated graph JSON (classifiers and state machines), keyed by the uuid and revision of the graph file.
+// Loading a graph that is already cached skips parsing and the deprecated object translation, only the objects are
+// instantiated. Templates can be added from any thread, so the next graph can be prepared while a session is running.
+class ENGINE_API GraphTemplateCache
+{
+	public:
+		// constructor & destructor
+		GraphTemplateCache(uint32 maxNumTemplates = 8);
+		~GraphTemplateCache();
+
+		// parse the JSON and add it as template (does nothing if the same content is already cached); thread safe
+		bool Add(const char* jsonContent, const char* uuid, int32 revision);
+
+		// load the graph from the cached template; the template is created first if it isn't cached yet
+		// graphs without uuid are not cached (e.g. manually loaded files), they are loaded directly from the JSON
+		bool Load(const char* jsonContent, const char* uuid, int32 revision, Graph* graph);
+
+		bool Contains(const char* uuid, int32 revision) const;
+		uint32 GetNumTemplates() const;
+		void Clear();
+
+	private:
+		struct Template
+		{
+			Core::String	mUuid;
+			int32			mRevision;
+			uint32			mContentHash;		// hash and length of the JSON content, to detect changed files that didn't get a new revision
+			uint32			mContentLength;
+			Core::Json*		mJson;
+			uint64			mLastUsed;
+		};
+
+		// parse the json and translate deprecated objects, returns NULL on failure
+		static Core::Json* CreateTemplate(const char* jsonContent);
+
+		// the mutex has to be locked
+		uint32 FindTemplate(const char* uuid, int32 revision, uint32 contentHash, uint32 contentLength) const;
+		void AddTemplate(const char* uuid, int32 revision, uint32 contentHash, uint32 contentLength, Core::Json* json);
+
+		Core::Array<Template>	mTemplates;
+		uint32					mMaxNumTemplates;
+		uint64					mUseCounter;
+		mutable Core::Mutex		mLock;
+};
+
+
+#endif
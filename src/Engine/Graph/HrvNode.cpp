@@ -36,6 +36,9 @@ HrvNode::HrvNode(Graph* graph) : ProcessorNode( graph, new HrvProcessor() )
 	mSettings.mOutputSampleRate	= 128;
 	mSettings.mTimeDomainMethod	= HrvTimeDomain::METHOD_RMSSD;
 	mSettings.mNumRRIntervals	= 10;
+	mSettings.mUseFrequencyDomain		= false;
+	mSettings.mFrequencyDomainMethod	= HrvFrequencyDomain::METHOD_LF;
+	mSettings.mWindowLength				= 300;
 }
 
 
@@ -55,16 +58,18 @@ void HrvNode::Init()
 
 	GetInputPort(INPUTPORT_CHANNEL).Setup("RR", "x", AttributeChannels<double>::TYPE_ID, PORTID_INPUT);
 	GetOutputPort(OUTPUTPORT_CHANNEL).Setup("Out", "y", AttributeChannels<double>::TYPE_ID, PORTID_OUTPUT);
-	GetOutputPort(OUTPUTPORT_CHANNEL).SetName( HrvTimeDomain::GetName(mSettings.mTimeDomainMethod) );
+	GetOutputPort(OUTPUTPORT_CHANNEL).SetName( GetMethodName() );
 	
 	// ATTRIBUTES
 
-	// analysis method
-	const uint32 defaultMode = (uint32)mSettings.mTimeDomainMethod;
+	// analysis method (time domain methods first, followed by the frequency domain methods)
+	const uint32 defaultMode = GetMethodIndex();
 	AttributeSettings* methodAttr = RegisterAttribute("Method", "Method", "The calculated HRV metric.", ATTRIBUTE_INTERFACETYPE_COMBOBOX);
-	methodAttr->ResizeComboValues(HrvTimeDomain::NUM_TIME_DOMAIN_METHODS);
+	methodAttr->ResizeComboValues(HrvTimeDomain::NUM_TIME_DOMAIN_METHODS + HrvFrequencyDomain::NUM_FREQUENCY_DOMAIN_METHODS);
 	for (uint32 i = 0; i < HrvTimeDomain::NUM_TIME_DOMAIN_METHODS; i++)
 		methodAttr->SetComboValue(i, HrvTimeDomain::GetName((HrvTimeDomain::EMethod)i));
+	for (uint32 i = 0; i < HrvFrequencyDomain::NUM_FREQUENCY_DOMAIN_METHODS; i++)
+		methodAttr->SetComboValue(HrvTimeDomain::NUM_TIME_DOMAIN_METHODS + i, HrvFrequencyDomain::GetName((HrvFrequencyDomain::EMethod)i));
 	methodAttr->SetDefaultValue(AttributeInt32::Create(defaultMode));
 
 	// num RR intervals
@@ -72,6 +77,12 @@ void HrvNode::Init()
 	numRRAttr->SetDefaultValue( AttributeInt32::Create(mSettings.mNumRRIntervals) );
 	numRRAttr->SetMinValue( AttributeInt32::Create(2) );
 	numRRAttr->SetMaxValue( AttributeInt32::Create(CORE_INT32_MAX) );
+
+	// window length (frequency domain methods only)
+	AttributeSettings* windowAttr = RegisterAttribute("Window Length", "WindowLength", "Length of the analysis window in seconds (frequency domain methods only).", ATTRIBUTE_INTERFACETYPE_FLOATSPINNER);
+	windowAttr->SetDefaultValue( AttributeFloat::Create(mSettings.mWindowLength) );
+	windowAttr->SetMinValue( AttributeFloat::Create(HrvFrequencyDomain::MIN_WINDOW_LENGTH) );
+	windowAttr->SetMaxValue( AttributeFloat::Create(HrvFrequencyDomain::MAX_WINDOW_LENGTH) );
 }
 
 
@@ -95,7 +106,7 @@ void HrvNode::Start(const Time& elapsed)
 	ProcessorNode::Start(elapsed);
 
 	// update output port names
-	GetOutputPort(OUTPUTPORT_CHANNEL).SetName(HrvTimeDomain::GetName(mSettings.mTimeDomainMethod));
+	GetOutputPort(OUTPUTPORT_CHANNEL).SetName( GetMethodName() );
 }
 
 
@@ -116,15 +127,47 @@ void HrvNode::OnAttributesChanged()
 	// check if attributes have changed
 	const uint32 methodID = GetInt32Attribute(ATTRIB_METHOD);
 	const uint32 numRRIntervals = GetInt32Attribute(ATTRIB_NUM_RR_INTERVALS);
+	const double windowLength = GetFloatAttribute(ATTRIB_WINDOW_LENGTH);
 
 	// do not reinit if nothing has changed
-	if (mSettings.mNumRRIntervals == numRRIntervals && methodID == (uint32)mSettings.mTimeDomainMethod)
+	if (mSettings.mNumRRIntervals == numRRIntervals && methodID == GetMethodIndex() && mSettings.mWindowLength == windowLength)
 		return;
 
-	mSettings.mTimeDomainMethod = (HrvTimeDomain::EMethod)methodID;
+	if (methodID < HrvTimeDomain::NUM_TIME_DOMAIN_METHODS)
+	{
+		mSettings.mUseFrequencyDomain	= false;
+		mSettings.mTimeDomainMethod		= (HrvTimeDomain::EMethod)methodID;
+	}
+	else
+	{
+		mSettings.mUseFrequencyDomain		= true;
+		mSettings.mFrequencyDomainMethod	= (HrvFrequencyDomain::EMethod)(methodID - HrvTimeDomain::NUM_TIME_DOMAIN_METHODS);
+	}
+
 	mSettings.mNumRRIntervals	= numRRIntervals;
+	mSettings.mWindowLength		= windowLength;
 	
-	GetOutputPort(OUTPUTPORT_CHANNEL).SetName(HrvTimeDomain::GetName(mSettings.mTimeDomainMethod));
+	GetOutputPort(OUTPUTPORT_CHANNEL).SetName( GetMethodName() );
 
 	ResetAsync();
 }
+
+
+// combobox index of the current method
+uint32 HrvNode::GetMethodIndex() const
+{
+	if (mSettings.mUseFrequencyDomain == true)
+		return HrvTimeDomain::NUM_TIME_DOMAIN_METHODS + (uint32)mSettings.mFrequencyDomainMethod;
+
+	return (uint32)mSettings.mTimeDomainMethod;
+}
+
+
+// name of the current method
+const char* HrvNode::GetMethodName() const
+{
+	if (mSettings.mUseFrequencyDomain == true)
+		return HrvFrequencyDomain::GetName(mSettings.mFrequencyDomainMethod);
+
+	return HrvTimeDomain::GetName(mSettings.mTimeDomainMethod);
+}
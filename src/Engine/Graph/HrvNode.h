@@ -40,7 +40,8 @@ class ENGINE_API HrvNode : public ProcessorNode
 		enum
 		{
 			ATTRIB_METHOD			= 0,
-			ATTRIB_NUM_RR_INTERVALS = 1
+			ATTRIB_NUM_RR_INTERVALS = 1,
+			ATTRIB_WINDOW_LENGTH	= 2
 		};
 		
 		enum
@@ -77,6 +78,11 @@ class ENGINE_API HrvNode : public ProcessorNode
 
 		const ChannelProcessor::Settings& GetSettings() override			{ return mSettings; }
 
+	private:
+		// the method combobox lists the time domain methods followed by the frequency domain methods
+		uint32 GetMethodIndex() const;
+		const char* GetMethodName() const;
+
 	public:
 		HrvProcessor::Settings mSettings;
 };
@@ -261,3 +261,18 @@ void Math1Node::Processor::Update()
 		output->AsType<double>()->AddSample(result);
 	}
 }
+
+
+// the output only depends on the single input
+uint32 Math1Node::Processor::GetElementwiseInputIndex() const
+{
+	return 0;
+}
+
+
+void Math1Node::Processor::ProcessBlock(double* samples, uint32 numSamples)
+{
+	const Math1Function calculateFunc = mSettings.mCalculateFunc;
+	for (uint32 i=0; i<numSamples; ++i)
+		samples[i] = calculateFunc(samples[i]);
+}
@@ -366,3 +366,37 @@ void Math2Node::Processor::Update()
 		output->AsType<double>()->AddSample(result);
 	}
 }
+
+
+// element-wise only if a single uniform channel is connected, the other operand is the static default value then
+uint32 Math2Node::Processor::GetElementwiseInputIndex() const
+{
+	ChannelBase* channelX = GetInput(0);
+	ChannelBase* channelY = GetInput(1);
+
+	if (channelX != NULL && channelY == NULL && channelX->GetSampleRate() > 0)
+		return 0;
+
+	if (channelX == NULL && channelY != NULL && channelY->GetSampleRate() > 0)
+		return 1;
+
+	return CORE_INVALIDINDEX32;
+}
+
+
+void Math2Node::Processor::ProcessBlock(double* samples, uint32 numSamples)
+{
+	const Math2Function calculateFunc = mSettings.mCalculateFunc;
+	const double defaultValue = mSettings.mDefaultValue;
+
+	if (GetInput(0) != NULL)
+	{
+		for (uint32 i=0; i<numSamples; ++i)
+			samples[i] = calculateFunc(samples[i], defaultValue);
+	}
+	else
+	{
+		for (uint32 i=0; i<numSamples; ++i)
+			samples[i] = calculateFunc(defaultValue, samples[i]);
+	}
+}
@@ -67,6 +67,10 @@ void OscOutputNode::Init()
 	// create the OSC address
 	AttributeSettings* attributeOscAddress = RegisterAttribute("OSC Address", "oscAddress", "e.g. /out/1.", ATTRIBUTE_INTERFACETYPE_STRING);
 	attributeOscAddress->SetDefaultValue( AttributeString::Create( uniqueOscAddress.AsChar() ) );
+
+	// send all samples of an update as timestamped bundles (together with the other bundled outputs)
+	AttributeSettings* attributeSendBundles = RegisterAttribute("Send Bundles", "sendBundles", "Pack all samples of an engine update into timestamped OSC bundles (fewer, larger packets).", ATTRIBUTE_INTERFACETYPE_CHECKBOX);
+	attributeSendBundles->SetDefaultValue( AttributeBool::Create(false) );
 	
 	// hide upload attribute
 	GetAttributeSettings(ATTRIB_UPLOAD)->SetVisible(false);
@@ -112,9 +116,27 @@ void OscOutputNode::Update(const Time& elapsed, const Time& delta)
 
 	UpdateResamplers(elapsed, delta);
 
-	// queue a packet for each new sample
 	Channel<double >* channel = GetOutputChannel(INPUTPORT_VALUE);
 	const uint32 numNewSamples = channel->GetNumNewSamples();
+
+	// add each new sample with its timestamp to the bundles (sent after the engine update)
+	if (GetSendBundles() == true)
+	{
+		if (IsValidInput(INPUTPORT_VALUE) == false)
+			return;
+
+		OscBundleQueue* bundleQueue = GetOscMessageRouter()->GetOutputBundleQueue();
+		const uint64 firstNewSampleIndex = channel->GetMaxSampleIndex() + 1 - numNewSamples;
+		for (uint32 i = 0; i < numNewSamples; ++i)
+		{
+			const uint64 sampleIndex = firstNewSampleIndex + i;
+			bundleQueue->AddMessage( GetOscAddress(), (float)channel->GetSample(sampleIndex), channel->GetSampleTime(sampleIndex).InSeconds() );
+		}
+
+		return;
+	}
+
+	// queue a packet for each new sample
 	for (uint32 i = 0; i < numNewSamples; ++i)
 	{
 		// get free packet from server
@@ -44,7 +44,8 @@ class ENGINE_API OscOutputNode: public OutputNode
 		
 		enum
 		{
-			ATTRIB_OSCADDRESS		= NUM_BASEATTRIBUTES + 0
+			ATTRIB_OSCADDRESS		= NUM_BASEATTRIBUTES + 0,
+			ATTRIB_SENDBUNDLES		= NUM_BASEATTRIBUTES + 1
 		};
 
 		enum EError
@@ -75,6 +76,7 @@ class ENGINE_API OscOutputNode: public OutputNode
 
 		// OSC
 		const char* GetOscAddress() const										{ return GetStringAttribute(ATTRIB_OSCADDRESS); }
+		bool GetSendBundles() const												{ return GetBoolAttribute(ATTRIB_SENDBUNDLES); }
 
 		double GetCurrentValue() const											{ return mChannels[INPUTPORT_VALUE]->GetLastSample(); }
 		bool IsEmpty() const													{ return mChannels[INPUTPORT_VALUE]->GetNumSamples() == 0; }
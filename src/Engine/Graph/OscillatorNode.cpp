@@ -226,9 +226,6 @@ void OscillatorNode::OscillatorProcessor::Update()
 	ChannelBase* phaseInput = GetInput(INPUTPORT_PHASE);
 	Channel<double>* output = GetOutput()->AsType<double>();
 	
-	// waveform function
-	WaveformFunction mWaveformFunction = GetWaveformFunction(mSettings.mWaveformType);
-
 	// default parameters
 	double amplitude = mSettings.mDefaultAmplitude;
 	double frequency = mSettings.mDefaultFrequency;
@@ -260,22 +257,33 @@ void OscillatorNode::OscillatorProcessor::Update()
 	// new samples we have to output
 	const uint32 numNewSamples = mOutputClock.GetNumNewTicks();
 
-	// generate samples
-	for (uint32 i = 0; i < numNewSamples; i++)
+	// generate samples in one block (the waveform and phase input are constant within one update)
+	if (numNewSamples > 0)
 	{
-		//const Time sampleTime = mOutputClock.GetTickTime(mOutputClock.GetTick(i));
-
-		const double value = amplitude / 2.0 * (this->*mWaveformFunction)(mPhaseAccumulator + phase);
-
-		// increase the phase
-		mPhaseAccumulator += Math::twoPiD * frequency / (double)mSettings.mSampleRate;
-
-		output->AddSample(value);
+		// square and triangle start at the negative peak, phase input is in radians
+		SignalGenerator::EWaveform waveform;
+		double scale = amplitude / 2.0;
+		switch (mSettings.mWaveformType)
+		{
+			case WAVEFORM_SQUARE:		waveform = SignalGenerator::WAVEFORM_SQUARE;		scale = -scale;		break;
+			case WAVEFORM_TRIANGLE:		waveform = SignalGenerator::WAVEFORM_TRIANGLE;		scale = -scale;		break;
+			case WAVEFORM_SAWTOOTH:		waveform = SignalGenerator::WAVEFORM_SAWTOOTH;							break;
+			default:					waveform = SignalGenerator::WAVEFORM_SINE;								break;
+		}
+
+		const double phaseIncrement = frequency / (double)mSettings.mSampleRate;
+
+		mSamples.Resize(numNewSamples);
+		double* samples = mSamples.GetPtr();
+		SignalGenerator::GenerateWaveform(waveform, mPhaseAccumulator + phase / Math::twoPiD, phaseIncrement, 0.5, numNewSamples, samples);
+
+		for (uint32 i = 0; i < numNewSamples; i++)
+			output->AddSample(scale * samples[i]);
+
+		// increase the phase (wrapped to keep rounding errors in check)
+		mPhaseAccumulator = SignalGenerator::WrapPhase(mPhaseAccumulator + numNewSamples * phaseIncrement);
 	}
 
-	// fmod the phase accumulator to keep rounding errors in check
-	mPhaseAccumulator = Math::FModD(mPhaseAccumulator, Math::twoPiD);
-
 	mOutputClock.ClearNewTicks();
 }
 
@@ -288,50 +296,3 @@ void OscillatorNode::OscillatorProcessor::Update(const Time& elapsed, const Time
 	// base update as last stept
 	ChannelProcessor::Update(elapsed, delta);
 }
-
-
-// get the function pointer of an algorithm
-OscillatorNode::OscillatorProcessor::WaveformFunction OscillatorNode::OscillatorProcessor::GetWaveformFunction(EWaveformType waveform)
-{
-	// get the corresponding function pointer
-	WaveformFunction selectedFunction = NULL;
-	switch (waveform)
-	{
-		case WAVEFORM_SINE:			selectedFunction = &OscillatorProcessor::SineWaveFunction;			break;
-		case WAVEFORM_SQUARE:		selectedFunction = &OscillatorProcessor::SquareWaveFunction;		break;
-		case WAVEFORM_TRIANGLE:		selectedFunction = &OscillatorProcessor::TriangleWaveFunction;		break;
-		case WAVEFORM_SAWTOOTH:		selectedFunction = &OscillatorProcessor::SawtoothWaveFunction;		break;
-		default:																						break;
-	}
-
-	return selectedFunction;
-}
-
-double OscillatorNode::OscillatorProcessor::SineWaveFunction(double phi)
-{
-	return Math::SinD(phi);
-}
-
-
-// rectangle function with duty cycle (value normalized to -1 .. 1)
-double OscillatorNode::OscillatorProcessor::SquareWaveFunction(double phi)
-{
-	if (Math::FModD(phi, Math::twoPiD) > Math::piD)
-		return 1.0;
-	else
-		return -1.0;
-}
-
-
-// sawtooth function
-double OscillatorNode::OscillatorProcessor::SawtoothWaveFunction(double phi)
-{
-	return (Math::FModD(phi, Math::twoPiD) - Math::piD) / Math::piD;
-}
-
-
-// triangle function
-double OscillatorNode::OscillatorProcessor::TriangleWaveFunction(double phi)
-{
-	return Math::AbsD(2.0 * SawtoothWaveFunction(phi)) - 1.0;
-}
@@ -29,6 +29,7 @@
 #include "../Core/StandardHeaders.h"
 #include "ProcessorNode.h"
 #include "../DSP/ResampleProcessor.h"
+#include "../DSP/SignalGenerator.h"
 
 
 class ENGINE_API OscillatorNode : public ProcessorNode
@@ -136,17 +137,8 @@ class ENGINE_API OscillatorNode : public ProcessorNode
 				Settings			mSettings;
 				ClockGenerator		mOutputClock;
 				
-				double				mPhaseAccumulator;		// required for perfect smooth swept wave generation
-
-				// waveform function pointer
-				typedef double (CORE_CDECL OscillatorProcessor::*WaveformFunction)(double phi);
-
-				WaveformFunction GetWaveformFunction(EWaveformType waveform);
-
-				double CORE_CDECL SineWaveFunction(double phi);
-				double CORE_CDECL SquareWaveFunction(double phi);
-				double CORE_CDECL TriangleWaveFunction(double phi);
-				double CORE_CDECL SawtoothWaveFunction(double phi);
+				double				mPhaseAccumulator;		// phase of the next sample in cycles, required for perfect smooth swept wave generation
+				Core::Array<double>	mSamples;				// the samples generated in one update
 		};
 
 		OscillatorProcessor::Settings		mSettings;
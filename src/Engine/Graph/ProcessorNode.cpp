@@ -36,6 +36,7 @@ using namespace Core;
 ProcessorNode::ProcessorNode(Graph* graph, ChannelProcessor* processor) : SPNode(graph)
 {
 	mProcessorPrototype		= processor;
+	mFusedInto				= NULL;
 }
 
 
@@ -133,8 +134,10 @@ void ProcessorNode::Start(const Time& elapsed)
 	// note: this is no longer required, because SPNode verifies the connections in SPNode::ReInit()
 	//CORE_ASSERT(ValidateConnections() == true);
 
-	// find the number of processors we have to create
-	const uint32 numProcessors = FindMaxInputMultiChannelSize();
+	// find the number of channels and processors we have to create (multi-channel processors handle all channels in a single instance)
+	const uint32 numChannels = FindMaxInputMultiChannelSize();
+	const bool isMultiChannel = (mProcessorPrototype->IsMultiChannel() == true && HasUniformInputSampleRate() == true);
+	const uint32 numProcessors = (isMultiChannel == true ? Min<uint32>(numChannels, 1) : numChannels);
 
 	//////////////////////////////////////////////////////////////////////////////////////////////
 	// 2. allocate new processors
@@ -160,6 +163,9 @@ void ProcessorNode::Start(const Time& elapsed)
 	for (uint32 i = 0; i<numProcessors; ++i)
 	{
 		ChannelProcessor* processor = mProcessorPrototype->Clone();
+		if (isMultiChannel == true)
+			processor->SetNumChannels(numChannels);
+
 		mProcessors.Add(processor);
 	}
 
@@ -170,16 +176,20 @@ void ProcessorNode::Start(const Time& elapsed)
 	// connect inputs
 	for (uint32 i = 0; i<numInputs; ++i)
 	{
-		for (uint32 p = 0; p < numProcessors; ++p)
+		for (uint32 c = 0; c < numChannels; ++c)
 		{
+			// the processor and its input index for this channel
+			ChannelProcessor* processor = (isMultiChannel == true ? mProcessors[0] : mProcessors[c]);
+			const uint32 inputIndex = (isMultiChannel == true ? c * numInputs + i : i);
+
 			// find the index of the channel reader (Multichannel Multiplication comes into play here)
-			const uint32 readerIndex = mChannelReaderMap[i * numProcessors + p];
+			const uint32 readerIndex = mChannelReaderMap[i * numChannels + c];
 
 			// connection is missing -> remove delegate input reader and give it no input channel (processors handle this correctly)
 			if (GetInputPort(i).HasConnection() == false || readerIndex == CORE_INVALIDINDEX32)
 			{
-				mProcessors[p]->RemoveDelegateInputReader(i);
-				mProcessors[p]->SetInput(NULL, i);
+				processor->RemoveDelegateInputReader(inputIndex);
+				processor->SetInput(NULL, inputIndex);
 			}
 			else
 			{
@@ -187,7 +197,7 @@ void ProcessorNode::Start(const Time& elapsed)
 				
 				// get the reader and tell the processor to use it for reading
 				ChannelReader* reader = mInputReader.GetReader(readerIndex);
-				mProcessors[p]->SetDelegateInputReader(i, reader);
+				processor->SetDelegateInputReader(inputIndex, reader);
 			}
 		}
 	}
@@ -195,10 +205,12 @@ void ProcessorNode::Start(const Time& elapsed)
 	// connect outputs
 	for (uint32 i = 0; i < numOutputs; ++i)
 	{
-		for (uint32 p = 0; p < numProcessors; ++p)
+		for (uint32 c = 0; c < numChannels; ++c)
 		{
+			ChannelBase* output = (isMultiChannel == true ? mProcessors[0]->GetOutput(i, c) : mProcessors[c]->GetOutput(i));
+
 			MultiChannel* channels = GetOutputPort(i).GetChannels();
-			channels->AddChannel(mProcessors[p]->GetOutput(i));
+			channels->AddChannel(output);
 		}
 	}
 
@@ -234,6 +246,17 @@ void ProcessorNode::Update(const Time& elapsed, const Time& delta)
 
 	if (mIsInitialized == true)
 	{
+		// this node is part of a fused chain: its samples are processed by the last node of the chain
+		if (mFusedInto != NULL)
+			return;
+
+		// last node of a fused chain: evaluate the whole chain
+		if (mFusedChain.IsEmpty() == false)
+		{
+			UpdateFusedChain();
+			return;
+		}
+
 		// update all processors
 		uint32 numProcessors = mProcessors.Size();
 		for (uint32 i = 0; i < numProcessors; ++i)
@@ -248,6 +271,120 @@ void ProcessorNode::Update(const Time& elapsed, const Time& delta)
 }
 
 
+// run the fused element-wise kernel: read the input samples of the chain head, apply all processors of the chain block-wise and write the result to our output (the intermediate outputs only get the last value)
+void ProcessorNode::UpdateFusedChain()
+{
+	ProcessorNode* head = mFusedChain[0];
+	const uint32 headInputPort = head->GetElementwiseInputPort();
+	const uint32 numStages = mFusedChain.Size();
+
+	// the input ports the intermediate outputs are connected to
+	mFusedInputPorts.Resize(numStages);
+	for (uint32 s = 0; s < numStages; ++s)
+	{
+		ProcessorNode* nextNode = (s + 1 < numStages ? mFusedChain[s + 1] : this);
+		mFusedInputPorts[s] = nextNode->GetElementwiseInputPort();
+	}
+
+	const uint32 numProcessors = mProcessors.Size();
+	for (uint32 p = 0; p < numProcessors; ++p)
+	{
+		// the intermediate outputs are only read by the next node of the chain, which skips them
+		for (uint32 s = 0; s < numStages; ++s)
+		{
+			ProcessorNode* nextNode = (s + 1 < numStages ? mFusedChain[s + 1] : this);
+			nextNode->mProcessors[p]->GetInputReader(mFusedInputPorts[s])->Flush();
+		}
+
+		// the head processor does not read its input itself while fused
+		ChannelReader* input = head->mProcessors[p]->GetInputReader(headInputPort);
+		const uint32 numSamples = input->GetNumNewSamples();
+		if (numSamples == 0)
+			continue;
+
+		mFusedBlock.Resize(numSamples);
+		double* samples = mFusedBlock.GetPtr();
+		for (uint32 i = 0; i < numSamples; ++i)
+			samples[i] = input->PopOldestSample<double>();
+
+		// apply all processors of the chain, ending with our own
+		for (uint32 s = 0; s < numStages; ++s)
+		{
+			ChannelProcessor* processor = mFusedChain[s]->mProcessors[p];
+			processor->ProcessBlock(samples, numSamples);
+
+			// the intermediate outputs are only read by the next node of the chain: keep just the last value (e.g. for port values),
+			// unless the samples are observed from outside the graph (e.g. channel snapshots)
+			Channel<double>* output = processor->GetOutput()->AsType<double>();
+			if (output->IsObserved() == false && output->IsBuffer() == true && output->HasTimeIndex() == false)
+				output->SkipSamples(numSamples, samples[numSamples - 1]);
+			else
+			{
+				for (uint32 i = 0; i < numSamples; ++i)
+					output->AddSample(samples[i]);
+			}
+		}
+		mProcessors[p]->ProcessBlock(samples, numSamples);
+
+		// add results to the output
+		Channel<double>* output = mProcessors[p]->GetOutput()->AsType<double>();
+		for (uint32 i = 0; i < numSamples; ++i)
+			output->AddSample(samples[i]);
+	}
+}
+
+
+// returns the input port all processors compute their output from element-wise, or CORE_INVALIDINDEX32 if the node cannot be fused
+uint32 ProcessorNode::GetElementwiseInputPort() const
+{
+	if (mIsInitialized == false || GetNumOutputPorts() != 1)
+		return CORE_INVALIDINDEX32;
+
+	const uint32 numProcessors = mProcessors.Size();
+	if (numProcessors == 0)
+		return CORE_INVALIDINDEX32;
+
+	// all processors must agree on the input
+	const uint32 inputIndex = mProcessors[0]->GetElementwiseInputIndex();
+	for (uint32 p = 1; p < numProcessors; ++p)
+	{
+		if (mProcessors[p]->GetElementwiseInputIndex() != inputIndex)
+			return CORE_INVALIDINDEX32;
+	}
+
+	return inputIndex;
+}
+
+
+// check if all input channels have the same sample rate (requirement for multi-channel processors)
+bool ProcessorNode::HasUniformInputSampleRate()
+{
+	bool hasSampleRate = false;
+	double sampleRate = 0.0;
+
+	const uint32 numInputs = GetNumInputPorts();
+	for (uint32 i = 0; i < numInputs; ++i)
+	{
+		MultiChannel* channels = GetInputPort(i).GetChannels();
+		if (channels == NULL)
+			continue;
+
+		const uint32 numChannels = channels->GetNumChannels();
+		for (uint32 c = 0; c < numChannels; ++c)
+		{
+			const double channelSampleRate = channels->GetChannel(c)->GetSampleRate();
+			if (hasSampleRate == true && channelSampleRate != sampleRate)
+				return false;
+
+			sampleRate = channelSampleRate;
+			hasSampleRate = true;
+		}
+	}
+
+	return true;
+}
+
+
 // check and verify all connections
 bool ProcessorNode::ValidateConnections()
 {
@@ -63,18 +63,39 @@ class ENGINE_API ProcessorNode : public SPNode
 
 		virtual Core::String& GetDebugString(Core::String& inout) override;
 
+		// element-wise chain fusion (see Classifier::FuseElementwiseChains())
+		uint32 GetElementwiseInputPort() const;
+		bool IsElementwise() const										{ return GetElementwiseInputPort() != CORE_INVALIDINDEX32; }
+		uint32 GetNumProcessors() const									{ return mProcessors.Size(); }
+		ChannelProcessor* GetProcessor(uint32 index) const				{ return mProcessors[index]; }
+
+		void ClearFusion()												{ mFusedChain.Clear(false); mFusedInto = NULL; }
+		void AddFusedNode(ProcessorNode* node)							{ mFusedChain.Add(node); }
+		void SetFusedInto(ProcessorNode* node)							{ mFusedInto = node; }
+		ProcessorNode* GetFusedInto() const								{ return mFusedInto; }
+		bool IsFused() const											{ return mFusedInto != NULL || mFusedChain.IsEmpty() == false; }
+
 	protected:
 		void Start(const Core::Time& elapsed) override;
 
 		void SetupProcessors();
 		void ReInitProcessors();
 		bool ValidateConnections();
+		bool HasUniformInputSampleRate();
 
 		Core::Array<ChannelProcessor*>	mProcessors;
 
 	private:
+		void UpdateFusedChain();
+
 		ChannelProcessor*				mProcessorPrototype;
 
+		// element-wise chain fusion
+		Core::Array<ProcessorNode*>		mFusedChain;		// upstream nodes evaluated by this node, starting with the chain head
+		ProcessorNode*					mFusedInto;			// the downstream node this node's output is fused into
+		Core::Array<double>				mFusedBlock;		// sample block the fused kernel runs on
+		Core::Array<uint32>				mFusedInputPorts;	// input port of the next chain node that reads the output of each upstream chain node
+
 };
 
 
@@ -238,3 +238,33 @@ void RemapNode::Processor::Update()
 		output->AddSample(value);
 	}
 }
+
+
+// element-wise only if the range inputs are not connected (the ranges from the attributes are used then)
+uint32 RemapNode::Processor::GetElementwiseInputIndex() const
+{
+	if (GetInput(INPUTPORT_MAX_IN) != NULL || GetInput(INPUTPORT_MIN_IN) != NULL || GetInput(INPUTPORT_MAX_OUT) != NULL || GetInput(INPUTPORT_MIN_OUT) != NULL)
+		return CORE_INVALIDINDEX32;
+
+	return INPUTPORT_X;
+}
+
+
+void RemapNode::Processor::ProcessBlock(double* samples, uint32 numSamples)
+{
+	const double minInput  = mSettings.mMinInput;
+	const double maxInput  = mSettings.mMaxInput;
+	const double minOutput = mSettings.mMinOutput;
+	const double maxOutput = mSettings.mMaxOutput;
+
+	if (mSettings.mClampOutput == true)
+	{
+		for (uint32 i=0; i<numSamples; ++i)
+			samples[i] = ClampedRemapRange( samples[i], minInput, maxInput, minOutput, maxOutput );
+	}
+	else
+	{
+		for (uint32 i=0; i<numSamples; ++i)
+			samples[i] = RemapRange( samples[i], minInput, maxInput, minOutput, maxOutput );
+	}
+}
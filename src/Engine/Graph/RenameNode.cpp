@@ -122,16 +122,8 @@ void RenameNode::Update(const Time& elapsed, const Time& delta)
 		return;
 
 
-	// simply forward all samples
-	const uint32 numSamples = mInputReader.GetMinNumNewSamples();
-	const uint32 numChannels = mInputReader.GetNumChannels();
-	for (uint32 c = 0; c < numChannels; ++c)
-	{
-		for (uint32 i = 0; i < numSamples; ++i)
-		{
-			mChannels[c]->AddSample(mInputReader.GetReader(c)->PopOldestSample<double>());
-		}
-	}
+	// the output channels are views of the inputs (updated in SPNode::Update()), nothing to copy
+	mInputReader.Flush(true);
 }
 
 
@@ -149,19 +141,12 @@ void RenameNode::Start(const Time& elapsed)
 		Channel<double>* outChannel = new Channel<double>();
 		Channel<double>* inChannel = inChannels->GetChannel(i)->AsType<double>();
 		
-		// set any buffersize > 0
-		outChannel->SetBufferSize(10);		
+		// share the samples and properties of the input, only the name is changed
+		outChannel->SetViewSource(inChannel);
 
 		// add and connect to outputport
 		mChannels.Add(outChannel);
 		GetOutputPort(OUTPUTPORT).GetChannels()->AddChannel(outChannel);
-
-		// forward properties
-		outChannel->SetSampleRate(inChannel->GetSampleRate());
-		outChannel->SetMinValue(inChannel->GetMinValue());
-		outChannel->SetMaxValue(inChannel->GetMaxValue());
-		outChannel->SetUnit(inChannel->GetUnit());
-		outChannel->SetColor(inChannel->GetColor());
 	}
 
 	UpdateOutputChannelNames();
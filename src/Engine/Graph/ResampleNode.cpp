@@ -69,14 +69,11 @@ void ResampleNode::Init()
 	attr->SetMinValue(Core::AttributeFloat::Create(FLT_EPSILON));
 	attr->SetMaxValue(Core::AttributeFloat::Create(FLT_MAX));
 
-	// Resample Mode (disabled for now)
-	const uint32 defaultMode = (uint32)mSettings.mResampleMode;
-	attr = RegisterAttribute("Mode", "ResampleMode", "Select Realtime for applications where a zero delay is most important. Use 'Best Quality' if the signal's frequency spectrum is more important.", Core::ATTRIBUTE_INTERFACETYPE_COMBOBOX);
+	// Resample Mode (note: combo index is not the enum value, 'Good Quality' is not offered)
+	attr = RegisterAttribute("Mode", "ResampleMode", "Select Realtime for applications where a zero delay is most important. Use 'Best Quality' if the signal's frequency spectrum is more important: it applies an anti-aliasing polyphase filter, which delays the signal.", Core::ATTRIBUTE_INTERFACETYPE_COMBOBOX);
 	attr->AddComboValue("Realtime");
-	attr->AddComboValue("Good Quality");
-	//attr->AddComboValue("Best Quality");
-	attr->SetDefaultValue(Core::AttributeInt32::Create(defaultMode));
-	attr->SetIsEnabled(false);
+	attr->AddComboValue("Best Quality");
+	attr->SetDefaultValue(Core::AttributeInt32::Create(MODE_REALTIME));
 }
 
 
@@ -146,15 +143,15 @@ void ResampleNode::OnAttributesChanged()
 {
 	// check if attributes have changed
 	const double sampleRate =  GetFloatAttribute(ATTRIB_SAMPLERATE);
-	const uint32 resampleMode = GetInt32Attribute(ATTRIB_MODE);
+	const ResampleProcessor::EResampleMode resampleMode = (GetInt32Attribute(ATTRIB_MODE) == MODE_BESTQUALITY ? ResampleProcessor::BEST_QUALITY : ResampleProcessor::REALTIME);
 	
 	// nothing changed?
 	if (mSettings.mTargetSampleRate == sampleRate && 
-		mSettings.mResampleMode == (ResampleProcessor::EResampleMode)resampleMode)
+		mSettings.mResampleMode == resampleMode)
 		return;
 	
 	mSettings.mTargetSampleRate = sampleRate;
-	mSettings.mResampleMode = (ResampleProcessor::EResampleMode)resampleMode;
+	mSettings.mResampleMode = resampleMode;
 	
 	ResetAsync();
 }
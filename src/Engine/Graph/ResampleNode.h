@@ -43,6 +43,13 @@ class ENGINE_API ResampleNode : public ProcessorNode
 			ATTRIB_MODE			 	= 1,
 			ATTRIB_ALGORITHM		= 2,
 		};
+
+		// entries of the mode combobox
+		enum
+		{
+			MODE_REALTIME			= 0,
+			MODE_BESTQUALITY		= 1,
+		};
 		
 		enum
 		{
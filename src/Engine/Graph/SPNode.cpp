@@ -342,10 +342,20 @@ void SPNode::Update(const Time& elapsed, const Time& delta)
 		Port& output = GetOutputPort(i);
 
 		MultiChannel* channels = output.GetChannels();
+
+		// grow the buffers of lagging readers before we add new samples
+		if (channels->ApplyRequestedBufferSize() == true)
+			LogDetailedInfo("Buffer of output '%s' of node '%s' grown to %i samples (high-water mark %i)", output.GetName(), GetName(), channels->GetMinBufferSize(), channels->GetMaxHighWaterMark());
+
 		const uint32 numChannels = channels->GetNumChannels();
 		for (uint32 c = 0; c < numChannels; c++)
 		{
 			channels->GetChannel(c)->BeginAddSamples();
+
+			// views share the samples of their source: just take over the new ones (an uninitialized node flushes its inputs, so its views only follow the source)
+			if (channels->GetChannel(c)->IsView() == true)
+				channels->GetChannel(c)->UpdateView(mIsInitialized);
+
 			channels->GetChannel(c)->SetElapsedTime(elapsed);
 			channels->GetChannel(c)->UpdateLatency();
 		}
@@ -652,7 +662,7 @@ void SPNode::UpdateChannelActivity(double timePassedInSeconds)
 
 
 // this resizes the output buffers recursively
-void SPNode::ResizeBuffers(double seconds)
+void SPNode::ResizeBuffers(double seconds, double reserveSeconds, double maxSeconds)
 {
 	LogTraceRT("ResizeBuffers");
 
@@ -676,7 +686,7 @@ void SPNode::ResizeBuffers(double seconds)
 			CORE_ASSERT(parentNode->GetNodeType() != Node::NODE_TYPE);
 			
 			SPNode* parentSPNode = static_cast<SPNode*>(parentNode);
-			parentSPNode->ResizeBuffers(seconds);
+			parentSPNode->ResizeBuffers(seconds, reserveSeconds, maxSeconds);
 		}
 	}
 
@@ -697,31 +707,103 @@ void SPNode::ResizeBuffers(double seconds)
 		if (channels->IsBuffer() == false)
 			continue;
 
-		uint32 minBufferSizeForReader = 1;
+		const double sampleRate = channels->GetSampleRate();
 
 		// 1) find the number of minimum required samples by iterating over all child nodes
-		const uint32 numChildren = mParentGraph->CalcNumOutputConnections(this, i);
-		for (uint32 c = 0; c < numChildren; c++)
-		{
-			Connection* connection = mParentGraph->GetConnection(mParentGraph->FindOutputConnection(this, i, c));
-			Node* childNode = connection->GetTargetNode();
-			CORE_ASSERT(childNode->GetNodeType() != Node::NODE_TYPE);
-			SPNode* childSPNode = static_cast<SPNode*>(childNode);
-
-			// find max buffer size of all children
-			const uint32 portIndex = connection->GetTargetPort();
-			minBufferSizeForReader = Max(minBufferSizeForReader, childSPNode->GetNumEpochSamples(portIndex));
-		}
+		const uint32 minBufferSizeForReader = CalcNumRequiredSamples(i);
 
-		// 2) calculate minimum buffer size, by time
+		// 2) add the realtime reserve, and calculate minimum buffer size, by time
 		const uint32 defaultMinBufferSize = 500;
-		const double sampleRate = channels->GetSampleRate();
+		const uint32 reserveBufferSize = (sampleRate > 0 ? reserveSeconds * sampleRate : 0);
 		const uint32 minBufferSizeForRealtime = (sampleRate > 0 ? seconds * sampleRate : defaultMinBufferSize);
-		const uint32 newBufferSize = ::std::max(minBufferSizeForReader, minBufferSizeForRealtime);
+		const uint32 newBufferSize = ::std::max(minBufferSizeForReader + reserveBufferSize, minBufferSizeForRealtime);
 
 		// 3) resize all buffers, but DO NOT RESET
 		channels->SetBufferSize(newBufferSize, false);
+
+		// 4) allow lagging readers to grow the buffers at runtime (by the lag limit on top of what the readers need), and restart the high-water mark telemetry
+		const uint32 maxBufferSizeForRealtime = (sampleRate > 0 ? maxSeconds * sampleRate : 0);
+		channels->SetMaxBufferSize( ::std::max(newBufferSize * 4, minBufferSizeForReader + maxBufferSizeForRealtime) );
+		channels->ResetHighWaterMarks();
+	}
+}
+
+
+
+// find the number of samples the readers of an output need
+uint32 SPNode::CalcNumRequiredSamples(uint32 outputPortIndex)
+{
+	uint32 minBufferSizeForReader = 1;
+	const double sampleRate = GetOutputPort(outputPortIndex).GetChannels()->GetSampleRate();
+	double outputDelay = -1.0;
+
+	const uint32 numChildren = mParentGraph->CalcNumOutputConnections(this, outputPortIndex);
+	for (uint32 c = 0; c < numChildren; c++)
+	{
+		Connection* connection = mParentGraph->GetConnection(mParentGraph->FindOutputConnection(this, outputPortIndex, c));
+		Node* childNode = connection->GetTargetNode();
+		CORE_ASSERT(childNode->GetNodeType() != Node::NODE_TYPE);
+		SPNode* childSPNode = static_cast<SPNode*>(childNode);
+
+		// samples the child needs for one epoch (also covers the visualization window of views)
+		const uint32 portIndex = connection->GetTargetPort();
+		uint32 numRequiredSamples = childSPNode->GetNumEpochSamples(portIndex);
+
+		// a child with several inputs waits for its slowest input, so this output has to hold the delay difference to that input
+		const uint32 numChildInputs = childSPNode->GetNumInputPorts();
+		uint32 numConnectedChildInputs = 0;
+		for (uint32 p = 0; p < numChildInputs; ++p)
+		{
+			if (childSPNode->GetInputPort(p).HasConnection() == true)
+				numConnectedChildInputs++;
+		}
+
+		if (sampleRate > 0 && numConnectedChildInputs > 1)
+		{
+			if (outputDelay < 0.0)
+				outputDelay = FindMaximumDelayForOutput(outputPortIndex);
+
+			double maxChildInputDelay = 0.0;
+			for (uint32 p = 0; p < numChildInputs; ++p)
+				maxChildInputDelay = Max(maxChildInputDelay, childSPNode->FindMaximumDelayForInput(p));
+
+			if (maxChildInputDelay > outputDelay)
+				numRequiredSamples += (uint32)Math::CeilD((maxChildInputDelay - outputDelay) * sampleRate);
+		}
+
+		// a forwarding child (rename, selector, merger, ...) has no buffer of its own, its readers read from this buffer through the views
+		numRequiredSamples = Max(numRequiredSamples, childSPNode->CalcNumRequiredViewSamples());
+
+		// find max buffer size of all children
+		minBufferSizeForReader = Max(minBufferSizeForReader, numRequiredSamples);
 	}
+
+	return minBufferSizeForReader;
+}
+
+
+// find the number of samples the readers of the output views of this node need (0 if the node has no views)
+uint32 SPNode::CalcNumRequiredViewSamples()
+{
+	uint32 numRequiredSamples = 0;
+
+	const uint32 numOutPorts = GetNumOutputPorts();
+	for (uint32 i = 0; i < numOutPorts; ++i)
+	{
+		MultiChannel* channels = GetOutputPort(i).GetChannels();
+		if (channels == NULL)
+			continue;
+
+		bool hasViews = false;
+		const uint32 numChannels = channels->GetNumChannels();
+		for (uint32 c = 0; c < numChannels && hasViews == false; ++c)
+			hasViews = channels->GetChannel(c)->IsView();
+
+		if (hasViews == true)
+			numRequiredSamples = Max(numRequiredSamples, CalcNumRequiredSamples(i));
+	}
+
+	return numRequiredSamples;
 }
 
 
@@ -1138,6 +1220,10 @@ void SPNode::PropagateChannelMetadata()
 		{
 			ChannelBase* input = inputPort.GetChannels()->GetChannel(i);
 			ChannelBase* output = outputPort.GetChannels()->GetChannel(i);
+
+			// views: use the channel they share the samples with
+			if (output->IsView() == true)
+				input = output->GetViewSource();
 		
 			// forward channel names
 			if (mUseChannelNamePropagation == true)
@@ -1182,9 +1268,23 @@ void SPNode::PropagateChannelMetadata()
 				// flag so we can use the fallback method if the first one fails
 				bool success = false;
 
+				// views: use the channel they share the samples with (the channel order may differ from the inputs)
+				ChannelBase* outChannel = outPort.GetChannels()->GetChannel(c);
+				if (outChannel->IsView() == true)
+				{
+					ChannelBase* source = outChannel->GetViewSource();
+					if (strlen(source->GetName()) > 0)
+						outChannelName = source->GetName();
+
+					outChannelColor = source->GetColor();
+					outChannelIndependence = source->IsIndependent();
+
+					success = true;
+				}
+
 				//  go through input channels and find the first non-empty name of an input;
 				//       Important: this step requires that the multichannel size of the input _matches_ the output channel size
-				for (uint32 i = 0; i < numInputs; ++i)
+				for (uint32 i = 0; i < numInputs && success == false; ++i)
 				{
 					Port& inPort = GetInputPort(i);
 					if (inPort.HasConnection() == false || inPort.GetChannels() == NULL)
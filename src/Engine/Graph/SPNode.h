@@ -123,11 +123,16 @@ class ENGINE_API SPNode : public Node
 		// reset output channels
 		void ResetBuffers();
 
-		// resize buffers and that of and all parent nodes recursively
-		void ResizeBuffers(double seconds);
+		// resize buffers and that of and all parent nodes recursively: each buffer holds what its readers need (epoch, delay differences) plus reserveSeconds,
+		// but at least the given number of seconds; lagging readers can grow it by maxSeconds at runtime
+		void ResizeBuffers(double seconds, double reserveSeconds, double maxSeconds);
 		bool IsResizeBuffersReady() const							{ return mIsResizeBuffersReady; }
 		void SetResizeBuffersReady(bool isReady)					{ mIsResizeBuffersReady = isReady; }
 
+		// number of samples the readers of an output need; includes the readers behind forwarding nodes, their output views read from this buffer as well
+		uint32 CalcNumRequiredSamples(uint32 outputPortIndex);
+		uint32 CalcNumRequiredViewSamples();
+
 		// recursively find maxmimum delay of this node
 		virtual double FindMaximumDelay();
 		virtual double FindMaximumDelayForInput(uint32 inputPortIndex);
@@ -201,7 +206,7 @@ class ENGINE_API SPNode : public Node
 		// check that the sample timing accuracy of multi input nodes is valid
 		bool ValidateInputTiming();
 
-		// Propagate channel names, colores etc from input to output (you may override this)
+		// Propagate channel names, colores etc from input to output; views get them from the channel they share the samples with (you may override this)
 		virtual void PropagateChannelMetadata();
 		
 		// set output channel source names (you may override this)
@@ -101,7 +101,7 @@ void SignalGeneratorNode::Init()
 	attributeSettings->SetMaxValue( Core::AttributeFloat::Create(FLT_MAX) );
 
 	// amplitude
-	attributeSettings = RegisterAttribute("Amplitude", "amplitude", "Amplitude of the waveform (half of peak-to-peak).", Core::ATTRIBUTE_INTERFACETYPE_FLOATSPINNER);
+	attributeSettings = RegisterAttribute("Amplitude", "amplitude", "Amplitude of the waveform (half of peak-to-peak, standard deviation of gaussian and pink noise).", Core::ATTRIBUTE_INTERFACETYPE_FLOATSPINNER);
 	attributeSettings->SetDefaultValue( Core::AttributeFloat::Create(defaultAmplitude) );
 	attributeSettings->SetMinValue( Core::AttributeFloat::Create(0.0) );
 	attributeSettings->SetMaxValue( Core::AttributeFloat::Create(FLT_MAX) );
@@ -156,6 +156,10 @@ void SignalGeneratorNode::Start(const Time& elapsed)
 	// construct a name for the channel
 	UpdateSensorName();
 
+	// restart the waveforms and noise filters
+	mGenerator.SetSampleRate(sampleRate);
+	mGenerator.Reset();
+
 	// configure and start clock
 	mClock.Reset();
 	mClock.SetStartTime(elapsed);
@@ -223,144 +227,124 @@ void SignalGeneratorNode::GenerateSamples()
 	const double dcoffset = GetFloatAttribute(ATTRIB_DCOFFSET);
 	const double dutycycle = GetFloatAttribute(ATTRIB_DUTYCYCLE);
 
-	//configure channel
-	mSensor.GetChannel()->SetMinValue(dcoffset - amplitude);
-	mSensor.GetChannel()->SetMaxValue(dcoffset + amplitude);
+	//configure channel (the amplitude of the gaussian and pink noise is the standard deviation, so almost all samples fall within four of them)
+	const bool isNormalNoise = (signalType == SIGNALTYPE_GAUSSIANNOISE || signalType == SIGNALTYPE_PINKNOISE);
+	const double range = (isNormalNoise == true ? 4.0 * amplitude : amplitude);
+	mSensor.GetChannel()->SetMinValue(dcoffset - range);
+	mSensor.GetChannel()->SetMaxValue(dcoffset + range);
+
+	if (numNewSamples == 0)
+		return;
 
-	double time, value;
+	mSamples.Resize(numNewSamples);
+	double* samples = mSamples.GetPtr();
 
 	// create the samples
 	switch (signalType)
 	{
-		// sinusoidal waveform
-	case SIGNALTYPE_SINE:
-	{
-		for (uint32 i = 0; i<numNewSamples; ++i)
-		{
-			time = mClock.GetTickTime(mClock.PopOldestTick()).InSeconds();
-
-			// calculate the sin of the current time value
-			value = dcoffset + Math::Sin(time * Math::twoPi * frequency) * amplitude;
-
-			// add the sample
-			mSensor.AddQueuedSample(value);
-		}
-		break;
-	}
-
-		// rectangle function, with duty cycle parameter
-	case SIGNALTYPE_SQUARE:
-	{
-		for (uint32 i = 0; i<numNewSamples; ++i)
+		// periodic waveforms, phase locked to the time of the first new tick
+		case SIGNALTYPE_SINE:
+		case SIGNALTYPE_SQUARE:
+		case SIGNALTYPE_SAWTOOTH:
+		case SIGNALTYPE_TRIANGLE:
 		{
-			time = mClock.GetTickTime(mClock.PopOldestTick()).InSeconds();
-
-			// generate rectangle wave, scale to amplitude and add dc-offset
-			value = dcoffset + amplitude * RectangleWaveFunction(time, frequency, dutycycle);
-
-			mSensor.AddQueuedSample(value);
+			const double startTime = mClock.GetTickTime(mClock.GetTick(0)).InSeconds();
+
+			mGenerator.SetFrequency(0, frequency);
+			mGenerator.SetPhase(0, startTime * frequency);
+			mGenerator.SetDutyCycle(0, dutycycle);
+
+			// the sine swings around the dc-offset, the other waveforms go from dc-offset to dc-offset + amplitude
+			if (signalType == SIGNALTYPE_SINE)
+			{
+				mGenerator.SetWaveform(0, SignalGenerator::WAVEFORM_SINE);
+				mGenerator.SetAmplitude(0, amplitude);
+				mGenerator.SetOffset(0, dcoffset);
+			}
+			else
+			{
+				if (signalType == SIGNALTYPE_SQUARE)		mGenerator.SetWaveform(0, SignalGenerator::WAVEFORM_SQUARE);
+				else if (signalType == SIGNALTYPE_SAWTOOTH)	mGenerator.SetWaveform(0, SignalGenerator::WAVEFORM_SAWTOOTH);
+				else										mGenerator.SetWaveform(0, SignalGenerator::WAVEFORM_TRIANGLE);
+
+				mGenerator.SetAmplitude(0, 0.5 * amplitude);
+				mGenerator.SetOffset(0, dcoffset + 0.5 * amplitude);
+			}
+
+			mGenerator.GenerateChannel(0, numNewSamples, samples);
+			break;
 		}
-		break;
-	}
 
-		// white noise 
-	case SIGNALTYPE_NOISE:
-	{
-		for (uint32 i = 0; i<numNewSamples; ++i)
+		// noise, amplitude centered around the dcoffset
+		case SIGNALTYPE_NOISE:
+		case SIGNALTYPE_GAUSSIANNOISE:
+		case SIGNALTYPE_PINKNOISE:
 		{
-			// generate random values (amplitude centered around the dcoffset)
-			value = Math::RandD(dcoffset - amplitude, dcoffset + amplitude);
+			if (signalType == SIGNALTYPE_NOISE)				mGenerator.SetWaveform(0, SignalGenerator::WAVEFORM_WHITENOISE);
+			else if (signalType == SIGNALTYPE_GAUSSIANNOISE)	mGenerator.SetWaveform(0, SignalGenerator::WAVEFORM_GAUSSIANNOISE);
+			else											mGenerator.SetWaveform(0, SignalGenerator::WAVEFORM_PINKNOISE);
 
-			mSensor.AddQueuedSample(value);
+			mGenerator.SetAmplitude(0, amplitude);
+			mGenerator.SetOffset(0, dcoffset);
+			mGenerator.GenerateChannel(0, numNewSamples, samples);
+			break;
 		}
-		break;
-	}
 
 		// ramp function (monotonously increases by $amplitude per 1/$frequency)
-	case SIGNALTYPE_RAMP:
-	{
-		for (uint32 i = 0; i<numNewSamples; ++i)
-		{
-			time = mClock.GetTickTime(mClock.PopOldestTick()).InSeconds();
-
-			// generate linear ramp
-			value = dcoffset + amplitude * time / frequency;
-
-			mSensor.AddQueuedSample(value);
-		}
-		break;
-	}
-
-		// sawtooth function (like ramp, but periodically)
-	case SIGNALTYPE_SAWTOOTH:
-	{
-		for (uint32 i = 0; i<numNewSamples; ++i)
-		{
-			time = mClock.GetTickTime(mClock.PopOldestTick()).InSeconds();
-
-			// generate rectangle wave, scale to amplitude and add dc-offset
-			value = dcoffset + amplitude * SawtoothWaveFunction(time, frequency);
-
-			mSensor.AddQueuedSample(value);
-		}
-		break;
-	}
-
-		// triangular waveform (like sawtooth, but ramping up AND down in one cycle)
-	case SIGNALTYPE_TRIANGLE:
-	{
-		for (uint32 i = 0; i<numNewSamples; ++i)
+		case SIGNALTYPE_RAMP:
 		{
-			time = mClock.GetTickTime(mClock.PopOldestTick()).InSeconds();
+			for (uint32 i = 0; i<numNewSamples; ++i)
+			{
+				const double time = mClock.GetTickTime(mClock.GetTick(i)).InSeconds();
 
-			// generate rectangle wave, scale to amplitude and add dc-offset
-			value = dcoffset + amplitude * TriangleWaveFunction(time, frequency);
-
-			mSensor.AddQueuedSample(value);
+				// generate linear ramp
+				samples[i] = dcoffset + amplitude * time / frequency;
+			}
+			break;
 		}
-		break;
-	}
 
 		// TODO: remove this or replace it with something better, but leave it for the beta
-	case SIGNALTYPE_BRAINWAVE:
-	{
-		const double a = amplitude;
-		const double s = 10;
-
-		for (uint32 i = 0; i<numNewSamples; ++i)
+		case SIGNALTYPE_BRAINWAVE:
 		{
-			time = mClock.GetTickTime(mClock.PopOldestTick()).InSeconds();
-			value = 0;
-
-			// delta sinuses 0..3
-			double var = 1.0 + (sin((double)s + 2.0 * Core::Math::pi * time / 23.0) * sin(1.0 - 2.0 * Core::Math::pi * time / 13.0) + sin((double)s - 2.0 * Core::Math::pi * time / 13.0)) / 2.0;
-			for (double j = 0.0; j <= 3.5; j += 0.31)
-				value += 0.1 * var * sin(fmod(j, 0.11 + (s + 1)) + 2.0 * Core::Math::pi * j * time) * a;
-
-			// alpha sinuses 8..12
-			var = 1.0 + (sin((double)s + 0.001284952 * time) * sin(0.034309 * time) + sin(0.1 + 0.01549 * time) * sin((double)s - 2.0 * Core::Math::pi * (0.0133543) * time)) / 2.0;
-			for (double j = 8.0; j <= 12.0; j += 0.23)
-				value += 0.1 * var * sin(fmod(j, 0.42 + (s + 1)) + 2.0 * Core::Math::pi * j * time) * a;
-
-			// SMR 13..16
-			var = 1.0 + (sin((double)s + 0.0284952 * time) * sin(1.0 + 0.034309 * time) + sin(0.01549 * time) * sin((double)s - 2.0 + 2.0 * Core::Math::pi * (0.033654) * time) * sin(2.0 * Core::Math::pi * (0.00765465) * time)) / 2.0;
-			for (double j = 13.0; j <= 16.0; j += 0.17)
-				value += 0.1 * var * sin(fmod(j, 0.23 + (s + 1)) + 2.0 * Core::Math::pi * j * time) * a;
-
-			// dc noise
-			//value += 0.1 * a * (double)rand() / RAND_MAX;
-
-			// ac noise
-			value += 0.3 * a * ((double)rand() / RAND_MAX - 0.5) * 2.0;
-
-			mSensor.AddQueuedSample(value);
+			const double a = amplitude;
+			const double s = 10;
+
+			for (uint32 i = 0; i<numNewSamples; ++i)
+			{
+				const double time = mClock.GetTickTime(mClock.GetTick(i)).InSeconds();
+				double value = 0;
+
+				// delta sinuses 0..3
+				double var = 1.0 + (sin((double)s + 2.0 * Core::Math::pi * time / 23.0) * sin(1.0 - 2.0 * Core::Math::pi * time / 13.0) + sin((double)s - 2.0 * Core::Math::pi * time / 13.0)) / 2.0;
+				for (double j = 0.0; j <= 3.5; j += 0.31)
+					value += 0.1 * var * sin(fmod(j, 0.11 + (s + 1)) + 2.0 * Core::Math::pi * j * time) * a;
+
+				// alpha sinuses 8..12
+				var = 1.0 + (sin((double)s + 0.001284952 * time) * sin(0.034309 * time) + sin(0.1 + 0.01549 * time) * sin((double)s - 2.0 * Core::Math::pi * (0.0133543) * time)) / 2.0;
+				for (double j = 8.0; j <= 12.0; j += 0.23)
+					value += 0.1 * var * sin(fmod(j, 0.42 + (s + 1)) + 2.0 * Core::Math::pi * j * time) * a;
+
+				// SMR 13..16
+				var = 1.0 + (sin((double)s + 0.0284952 * time) * sin(1.0 + 0.034309 * time) + sin(0.01549 * time) * sin((double)s - 2.0 + 2.0 * Core::Math::pi * (0.033654) * time) * sin(2.0 * Core::Math::pi * (0.00765465) * time)) / 2.0;
+				for (double j = 13.0; j <= 16.0; j += 0.17)
+					value += 0.1 * var * sin(fmod(j, 0.23 + (s + 1)) + 2.0 * Core::Math::pi * j * time) * a;
+
+				// ac noise
+				value += 0.3 * a * ((double)rand() / RAND_MAX - 0.5) * 2.0;
+
+				samples[i] = value;
+			}
+			break;
 		}
-		break;
-	}
 
-	default: break;
+		default:
+			for (uint32 i = 0; i<numNewSamples; ++i)
+				samples[i] = 0.0;
+			break;
 	}
 
+	mSensor.AddQueuedSamples(samples, numNewSamples);
+
 	// mark ticks as processed
 	mClock.ClearNewTicks();
 }
@@ -389,6 +373,8 @@ const char* SignalGeneratorNode::GetSignalTypeName (ESignalType type)
 		case SIGNALTYPE_SAWTOOTH:	return "Sawtooth"; break;
 		case SIGNALTYPE_TRIANGLE:	return "Triangle"; break;
 		case SIGNALTYPE_BRAINWAVE:	return "Brainwaves"; break;
+		case SIGNALTYPE_GAUSSIANNOISE:	return "Gaussian Noise"; break;
+		case SIGNALTYPE_PINKNOISE:	return "Pink Noise"; break;
 		default:					return "Unknown";
 	}
 
@@ -421,6 +407,8 @@ void SignalGeneratorNode::ShowAttributesForSignalType(ESignalType type)
 
 		// noise and brainwave have no frequency
 		case SIGNALTYPE_NOISE:
+		case SIGNALTYPE_GAUSSIANNOISE:
+		case SIGNALTYPE_PINKNOISE:
 		case SIGNALTYPE_BRAINWAVE:
 			GetAttributeSettings(ATTRIB_AMPLITUDE)->SetVisible(true);
 			GetAttributeSettings(ATTRIB_DCOFFSET)->SetVisible(true);
@@ -28,6 +28,7 @@
 #include "../Config.h"
 #include "../Core/StandardHeaders.h"
 #include "../DSP/ClockGenerator.h"
+#include "../DSP/SignalGenerator.h"
 #include "InputNode.h"
 
 class ENGINE_API SignalGeneratorNode : public InputNode
@@ -60,6 +61,8 @@ class ENGINE_API SignalGeneratorNode : public InputNode
 			SIGNALTYPE_SAWTOOTH, 
 			SIGNALTYPE_TRIANGLE, 
 			SIGNALTYPE_BRAINWAVE, 
+			SIGNALTYPE_GAUSSIANNOISE, 
+			SIGNALTYPE_PINKNOISE, 
 			NUM_SIGNALTYPES
 		};
 
@@ -94,62 +97,12 @@ class ENGINE_API SignalGeneratorNode : public InputNode
 		void UpdateSensorName();
 
 	private:
-		Sensor			mSensor;	// holds output channel
-		ClockGenerator	mClock;		// for creating aequidistant samples
+		Sensor				mSensor;		// holds output channel
+		ClockGenerator		mClock;			// for creating aequidistant samples
+		SignalGenerator		mGenerator;		// block-based waveform and noise synthesis
+		Core::Array<double>	mSamples;		// the samples generated in one update
 
 		void ShowAttributesForSignalType(ESignalType type);
-
-	/////////////////////////////////////////////
-
-		// rectangle function with duty cycle (value normalized to 0 .. 1)
-		inline double RectangleWaveFunction (double time, double frequency, double dutycycle)
-		{
-			// relative position in time within one wave period
-			const double t = Core::Math::FModD(time, 1.0 / frequency);
-			
-			// within one period, the signal is high first, then becomes low after dutycycle seconds
-			if (t < dutycycle / frequency)
-				return 1.0;
-			else
-				return 0.0;
-		}
-
-		// sawtooth function
-		inline double SawtoothWaveFunction (double time, double frequency)
-		{
-			if (frequency == 0)
-				return 0.0;
-
-			// relative position in time within one wave period
-			const double periodDuration = 1.0 / frequency;
-			const double t = Core::Math::FModD(time, periodDuration);
-			
-			// within one period, the signal ramps up from 0 to 1
-			return t / periodDuration;
-		}
-
-
-		// triangle function
-		inline double TriangleWaveFunction (double time, double frequency)
-		{
-			if (frequency == 0)
-				return 0.0;
-
-			// relative position in time within one wave period
-			const double periodDuration = 1.0 / frequency;
-			const double t = Core::Math::FModD(time, periodDuration);
-			
-			// within one period, the signal ramps up from 0 to 1, then back down to 0
-			const double halfPeriod = periodDuration / 2.0;
-			double value = 0.0;
-			value =  t / halfPeriod;
-
-			// flip second half 
-			if (t > halfPeriod)
-				value = 2.0 - value;
-
-			return value;
-		}
 };
 
 
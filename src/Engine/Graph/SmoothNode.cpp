@@ -179,3 +179,38 @@ void SmoothNode::Processor::Update()
 }
 
 
+
+
+// the output only depends on the single input and the current interpolation state (requires a uniform input channel)
+uint32 SmoothNode::Processor::GetElementwiseInputIndex() const
+{
+	ChannelBase* channel = GetInput();
+	if (channel == NULL || channel->GetSampleRate() <= 0)
+		return CORE_INVALIDINDEX32;
+
+	return 0;
+}
+
+
+void SmoothNode::Processor::ProcessBlock(double* samples, uint32 numSamples)
+{
+	// no interpolation: the output follows the input
+	if (mSettings.mInterpolationSpeed >= 0.99999f)
+	{
+		if (numSamples > 0)
+			mCurrentValue = samples[numSamples-1];
+		return;
+	}
+
+	const double frameDeltaTime = 1.0 / GetInput()->GetSampleRate();
+	const double interpolationSpeed = mSettings.mInterpolationSpeed * frameDeltaTime;
+
+	double currentValue = mCurrentValue;
+	for (uint32 i=0; i<numSamples; ++i)
+	{
+		currentValue = Core::LinearInterpolate<double>( currentValue, samples[i], interpolationSpeed );
+		samples[i] = currentValue;
+	}
+
+	mCurrentValue = currentValue;
+}
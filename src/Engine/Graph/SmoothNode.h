@@ -117,6 +117,10 @@ class ENGINE_API SmoothNode : public ProcessorNode
 				void ReInit() override;
 				void Update() override;
 
+				// element-wise block kernel
+				uint32 GetElementwiseInputIndex() const override;
+				void ProcessBlock(double* samples, uint32 numSamples) override;
+
 			private:
 				ProcessorSettings	mSettings;
 				double				mCurrentValue;
@@ -0,0 +1,321 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "SpatialFilterNode.h"
+#include "../Core/AttributeSettings.h"
+#include "../EngineManager.h"
+
+
+using namespace Core;
+
+// constructor
+SpatialFilterNode::SpatialFilterNode(Graph* graph) : SPNode(graph)
+{
+	mMethod			= METHOD_COMMONAVERAGE;
+	mNumNeighbours	= 4;
+}
+
+
+// destructor
+SpatialFilterNode::~SpatialFilterNode()
+{
+	// the output channels are owned by the block
+	GetOutputPort(OUTPUTPORT).GetChannels()->Clear();
+}
+
+
+// initialize the node
+void SpatialFilterNode::Init()
+{
+	// init base class first
+	SPNode::Init();
+
+	// configure SPNode behaviour
+	RequireMatchingSampleRates();
+	RequireInputConnection();
+	UseChannelMetadataPropagation(false);		// output channels are set up in Start()
+
+	// PORTS
+
+	InitInputPorts(1);
+	GetInputPort(INPUTPORT).SetupAsChannels<double>("In", "x", INPUTPORT);
+
+	InitOutputPorts(1);
+	GetOutputPort(OUTPUTPORT).SetupAsChannels<double>("Out", "y", OUTPUTPORT);
+
+	// ATTRIBUTES
+
+	// filter method
+	AttributeSettings* methodParam = RegisterAttribute("Method", "method", "How the output channels are calculated from the input channels.", ATTRIBUTE_INTERFACETYPE_COMBOBOX);
+	methodParam->ResizeComboValues( (uint32)METHOD_NUMMETHODS );
+	for (uint32 i=0; i<METHOD_NUMMETHODS; ++i)
+		methodParam->SetComboValue( i, GetMethodString((EMethod)i) );
+	methodParam->SetDefaultValue( AttributeInt32::Create(mMethod) );
+
+	// number of neighbours for the Laplacian
+	AttributeSettings* neighboursParam = RegisterAttribute("Neighbours", "neighbours", "Number of nearest electrodes used for the surface Laplacian.", ATTRIBUTE_INTERFACETYPE_INTSPINNER);
+	neighboursParam->SetDefaultValue( AttributeInt32::Create(mNumNeighbours) );
+	neighboursParam->SetMinValue( AttributeInt32::Create(1) );
+	neighboursParam->SetMaxValue( AttributeInt32::Create(32) );
+	neighboursParam->SetVisible(false);
+
+	// matrix file
+	AttributeSettings* fileParam = RegisterAttribute("Matrix File", "matrixFile", "Text file with the filter matrix (e.g. ICA unmixing or LORETA transfer matrix), one row per output channel and one column per input channel.", ATTRIBUTE_INTERFACETYPE_STRING);
+	fileParam->SetDefaultValue( AttributeString::Create() );
+	fileParam->SetVisible(false);
+}
+
+
+// reset the node
+void SpatialFilterNode::Reset()
+{
+	SPNode::Reset();
+
+	GetOutputPort(OUTPUTPORT).GetChannels()->Clear();
+	mOutputBlock.Release();
+	mInputBlock.Release();
+	mFilter.Clear();
+}
+
+
+// reinitialize the node
+void SpatialFilterNode::ReInit(const Time& elapsed, const Time& delta)
+{
+	if (BaseReInit(elapsed, delta) == false)
+		return;
+
+	// reinit baseclass
+	SPNode::ReInit(elapsed, delta);
+
+	// the matrix is only calculated (or loaded) once per reset
+	if (mIsInitialized == true && mFilter.GetNumInputs() != mInputReader.GetNumChannels())
+		mIsInitialized = InitFilter();
+	else if (mIsInitialized == true)
+		mIsInitialized = mFilter.IsValid();
+
+	PostReInit(elapsed, delta);
+}
+
+
+// create the output channels
+void SpatialFilterNode::Start(const Time& elapsed)
+{
+	const uint32 numInputs = mFilter.GetNumInputs();
+	const uint32 numOutputs = mFilter.GetNumOutputs();
+	const double sampleRate = mInputReader.GetSampleRate();
+
+	mInputBlock.Init(numInputs, sampleRate, 10);
+	mOutputBlock.Init(numOutputs, sampleRate, 10);		// set any buffersize > 0
+
+	for (uint32 i=0; i<numOutputs; ++i)
+	{
+		Channel<double>* channel = mOutputBlock.GetChannel(i);
+
+		// re-referenced channels keep the names of the electrodes, other matrices output components
+		if (mMethod != METHOD_MATRIX)
+		{
+			ChannelBase* inputChannel = mInputReader.GetChannel(i);
+			channel->SetName(inputChannel->GetName());
+			channel->SetColor(inputChannel->GetColor());
+			channel->SetMinValue(inputChannel->GetMinValue());
+			channel->SetMaxValue(inputChannel->GetMaxValue());
+		}
+		else
+		{
+			mTempString.Format("C%i", i+1);
+			channel->SetName(mTempString.AsChar());
+			channel->SetColorByID(i);
+		}
+	}
+
+	GetOutputPort(OUTPUTPORT).GetChannels()->SetBlock(&mOutputBlock);
+
+	SPNode::Start(elapsed);
+}
+
+
+// update the node
+void SpatialFilterNode::Update(const Time& elapsed, const Time& delta)
+{
+	if (BaseUpdate(elapsed, delta) == false)
+		return;
+
+	// update base class
+	SPNode::Update(elapsed, delta);
+
+	// do nothing if node is not fully initialized
+	if (mIsInitialized == false)
+		return;
+
+	const uint32 numSamples = mInputReader.GetMinNumNewSamples();
+	if (numSamples == 0)
+		return;
+
+	// collect the new samples of all inputs in the input block
+	if (mInputBlock.GetBufferSize() < numSamples)
+		mInputBlock.SetBufferSize(numSamples);
+
+	const uint32 numInputs = mInputBlock.GetNumChannels();
+	for (uint32 i=0; i<numInputs; ++i)
+	{
+		ChannelReader* reader = mInputReader.GetReader(i);
+		Channel<double>* channel = mInputBlock.GetChannel(i);
+		for (uint32 s=0; s<numSamples; ++s)
+			channel->AddSample( reader->PopOldestSample<double>() );
+	}
+
+	// apply the matrix to the whole block
+	const uint64 firstSampleIndex = mInputBlock.GetSampleCounter() - numSamples;
+	mFilter.Process(mInputBlock, firstSampleIndex, numSamples, &mOutputBlock);
+}
+
+
+// an attribute has changed
+void SpatialFilterNode::OnAttributesChanged()
+{
+	const EMethod method = (EMethod)GetInt32Attribute(ATTRIB_METHOD);
+	const uint32 numNeighbours = GetInt32Attribute(ATTRIB_NEIGHBOURS);
+	const char* matrixFile = GetStringAttribute(ATTRIB_MATRIXFILE);
+
+	// only show the attributes of the selected method
+	GetAttributeSettings(ATTRIB_NEIGHBOURS)->SetVisible(method == METHOD_LAPLACIAN);
+	GetAttributeSettings(ATTRIB_MATRIXFILE)->SetVisible(method == METHOD_MATRIX);
+	EMIT_EVENT( OnAttributeUpdated(mParentGraph, this, GetAttributeValue(ATTRIB_NEIGHBOURS)) );
+	EMIT_EVENT( OnAttributeUpdated(mParentGraph, this, GetAttributeValue(ATTRIB_MATRIXFILE)) );
+
+	// recalculate the matrix if something changed
+	if (mMethod != method || mNumNeighbours != numNeighbours || mMatrixFile.Compare(matrixFile) != 0)
+	{
+		mMethod			= method;
+		mNumNeighbours	= numNeighbours;
+		mMatrixFile		= matrixFile;
+
+		ResetAsync();
+	}
+}
+
+
+// calculate or load the matrix for the current input channels
+bool SpatialFilterNode::InitFilter()
+{
+	mFilter.Clear();
+
+	const uint32 numInputs = mInputReader.GetNumChannels();
+	if (numInputs == 0)
+		return false;
+
+	switch (mMethod)
+	{
+		case METHOD_COMMONAVERAGE:
+		{
+			mFilter.InitCommonAverageReference(numInputs);
+			break;
+		}
+
+		case METHOD_LAPLACIAN:
+		{
+			// find the electrodes of the input channels
+			const EEGElectrodes* electrodes = GetEngine()->GetEEGElectrodes();
+			Array<EEGElectrodes::Electrode> channelElectrodes;
+			for (uint32 i=0; i<numInputs; ++i)
+			{
+				const String& name = mInputReader.GetChannel(i)->GetNameString();
+				if (electrodes->IsValidElectrodeID(name) == false)
+				{
+					SetError(ERROR_ELECTRODE_NAMES, "Input channels are not named like electrodes (case-sensitive).");
+					return false;
+				}
+
+				channelElectrodes.Add( electrodes->GetElectrodeByID(name) );
+			}
+
+			ClearError(ERROR_ELECTRODE_NAMES);
+
+			if (mFilter.InitSurfaceLaplacian(electrodes, channelElectrodes, mNumNeighbours) == false)
+			{
+				SetError(ERROR_MATRIX, "The surface Laplacian requires at least two electrodes.");
+				return false;
+			}
+
+			break;
+		}
+
+		case METHOD_MATRIX:
+		{
+			// HACKFIX backslash escape sequences are interpreted somewhere in the attribute stack (see FileReaderNode)
+			String filename = mMatrixFile;
+			filename.Trim();
+			filename.Replace(StringCharacter::backSlash, StringCharacter::forwardSlash);
+
+			if (filename.IsEmpty() == true)
+			{
+				SetError(ERROR_MATRIX, "No matrix file specified.");
+				return false;
+			}
+
+			if (mFilter.LoadMatrix(filename.AsChar(), numInputs, &mTempString) == false)
+			{
+				SetError(ERROR_MATRIX, mTempString.AsChar());
+				return false;
+			}
+
+			break;
+		}
+
+		default: { CORE_ASSERT(false); return false; }
+	}
+
+	ClearError(ERROR_MATRIX);
+	if (mMethod != METHOD_LAPLACIAN)
+		ClearError(ERROR_ELECTRODE_NAMES);
+
+	return true;
+}
+
+
+const char* SpatialFilterNode::GetMethodString(EMethod method)
+{
+	switch (method)
+	{
+		case METHOD_COMMONAVERAGE:	{ return "Common Average Reference"; }
+		case METHOD_LAPLACIAN:		{ return "Surface Laplacian"; }
+		case METHOD_MATRIX:			{ return "Matrix File"; }
+		default:					{ return ""; }
+	}
+}
+
+
+String& SpatialFilterNode::GetDebugString(String& inout)
+{
+	SPNode::GetDebugString(inout);
+
+	mTempString.Format("Matrix: %i x %i\n", mFilter.GetNumOutputs(), mFilter.GetNumInputs());
+	inout += mTempString;
+
+	return inout;
+}
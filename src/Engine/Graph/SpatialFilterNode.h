@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_SPATIALFILTERNODE_H
+#define __NEUROMORE_SPATIALFILTERNODE_H
+
+// include the required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "SPNode.h"
+#include "../DSP/SpatialFilter.h"
+#include "../DSP/MultiChannelBlock.h"
+
+
+class ENGINE_API SpatialFilterNode : public SPNode
+{
+	public:
+		enum { TYPE_ID = 0x005B };
+		static const char* Uuid () { return "84da6e68-cbc4-11f1-befc-02fc00000001"; }
+
+		enum
+		{
+			INPUTPORT	= 0,
+		};
+
+		enum
+		{
+			OUTPUTPORT	= 0,
+		};
+
+		enum
+		{
+			ATTRIB_METHOD		= 0,
+			ATTRIB_NEIGHBOURS	= 1,
+			ATTRIB_MATRIXFILE	= 2,
+		};
+
+		enum EMethod
+		{
+			METHOD_COMMONAVERAGE	= 0,
+			METHOD_LAPLACIAN		= 1,
+			METHOD_MATRIX			= 2,
+			METHOD_NUMMETHODS
+		};
+
+		enum EError
+		{
+			ERROR_ELECTRODE_NAMES	= GraphObjectError::ERROR_CONFIGURATION | 0x01,
+			ERROR_MATRIX			= GraphObjectError::ERROR_CONFIGURATION | 0x02,
+		};
+
+		// constructor & destructor
+		SpatialFilterNode(Graph* graph);
+		~SpatialFilterNode();
+
+		// initialize & update
+		void Init() override;
+		void Reset() override;
+		void ReInit(const Core::Time& elapsed, const Core::Time& delta) override;
+		void Start(const Core::Time& elapsed) override;
+		void Update(const Core::Time& elapsed, const Core::Time& delta) override;
+		void OnAttributesChanged() override;
+
+		Core::Color GetColor() const override								{ return Core::RGBA(20, 110, 105); }
+		uint32 GetType() const override										{ return TYPE_ID; }
+		const char* GetTypeUuid() const override final						{ return Uuid(); }
+		const char* GetReadableType() const override						{ return "Spatial Filter"; }
+		const char* GetRuleName() const override final						{ return "NODE_SpatialFilter"; }
+		uint32 GetPaletteCategory() const override							{ return CATEGORY_DSP; }
+		GraphObject* Clone(Graph* graph) override							{ SpatialFilterNode* clone = new SpatialFilterNode(graph); return clone; }
+
+		Core::String& GetDebugString(Core::String& inout) override;
+
+	private:
+		static const char* GetMethodString(EMethod method);
+
+		// calculate or load the matrix for the current input channels
+		bool InitFilter();
+
+		SpatialFilter			mFilter;
+		MultiChannelBlock		mInputBlock;		// the new input samples of each update, copied into one block
+		MultiChannelBlock		mOutputBlock;		// the output channels
+
+		// for detecting attribute changes
+		EMethod					mMethod;
+		uint32					mNumNeighbours;
+		Core::String			mMatrixFile;
+};
+
+
+#endif
@@ -26,6 +26,7 @@
 
 // include required headers
 #include "State.h"
+#include "StateTransition.h"
 #include "../EngineManager.h"
 #include "GraphManager.h"
 #include "Classifier.h"
@@ -163,6 +164,40 @@ double State::GetTransitionProgress() const
 }
 
 
+// number of transitions that start at this state
+uint32 State::GetNumOutTransitions() const
+{
+	if (mOutputPorts.IsEmpty() == true)
+		return 0;
+
+	return mOutputPorts[PORTID_OUTPUT].GetNumConnection();
+}
+
+
+// get an outgoing transition (the state machine only contains transitions, so the cast is safe)
+StateTransition* State::GetOutTransition(uint32 index) const
+{
+	return static_cast<StateTransition*>( mOutputPorts[PORTID_OUTPUT].GetConnection(index) );
+}
+
+
+// number of transitions that end at this state
+uint32 State::GetNumInTransitions() const
+{
+	if (mInputPorts.IsEmpty() == true)
+		return 0;
+
+	return mInputPorts[PORTID_INPUT].GetNumConnection();
+}
+
+
+// get an incoming transition
+StateTransition* State::GetInTransition(uint32 index) const
+{
+	return static_cast<StateTransition*>( mInputPorts[PORTID_INPUT].GetConnection(index) );
+}
+
+
 void State::ForceActivate()
 {
 	mState = STATE_ACTIVE;
@@ -294,7 +329,7 @@ bool State::OnTryStateEntered(State* previousState, StateTransition* usedTransit
 	}
 
 	// Dead End behaviour
-	if (mParentStateMachine->FindNumOutTransitions(this, true) == 0)		// TODO optimize this, state should have access to a static list of all outgoing transitions!
+	if (mParentStateMachine->FindNumOutTransitions(this, true) == 0)
 	{
 		if (GetDeadEndMode() == DEADEND_DEACTIVATE)
 		{
@@ -99,6 +99,12 @@ class ENGINE_API State : public Node
 
 		void ForceActivate();
 
+		// outgoing and incoming transitions of this state (taken from the connections attached to the output and input port)
+		uint32 GetNumOutTransitions() const;
+		StateTransition* GetOutTransition(uint32 index) const;
+		uint32 GetNumInTransitions() const;
+		StateTransition* GetInTransition(uint32 index) const;
+
 		// serialization
 		virtual Core::Json::Item Save(Core::Json& json, Core::Json::Item& item) override;
 		virtual bool Load(const Core::Json& json, const Core::Json::Item& item) override;
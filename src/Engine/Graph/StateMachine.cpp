@@ -48,6 +48,7 @@ StateMachine::StateMachine(Graph* parentGraph) : Graph(parentGraph)
 	mIsRunning			= true;// FIXME: false; ??
 	mExitStatus			= 0;
 	mAssetsInitialized	= false;
+	mActiveSetsDirty	= true;
 }
 
 
@@ -86,6 +87,11 @@ void StateMachine::Start()
 		entryState->ForceActivate();
 	}
 
+	// the entry states are active now
+	CollectActiveStates();
+	CollectTransitions();
+	mActiveSetsDirty = false;
+
 	mIsRunning = true;
 	mExitStatus = 0;
 }
@@ -143,23 +149,18 @@ StateTransition* StateMachine::GetTransition(uint32 connectionIndex) const
 }
 
 
+// count the outgoing transitions of a state (uses the per-state transition index, see State::GetOutTransition())
 uint32 StateMachine::FindNumOutTransitions(const State* sourceState, bool ignoreDisabled) const
 {
-	const uint32 numTransitions = mConnections.Size();
+	const uint32 numTransitions = sourceState->GetNumOutTransitions();
+	if (ignoreDisabled == false)
+		return numTransitions;
 
 	uint32 count = 0;
 	for (uint32 i = 0; i < numTransitions; ++i)
 	{
-		StateTransition* transition = GetTransition(i);
-
-		if (transition->GetSourceState() != sourceState)
-			continue;
-
-		if (ignoreDisabled == true && transition->IsDisabled() == true)
-			continue;
-
-		// found one
-		count++;
+		if (sourceState->GetOutTransition(i)->IsDisabled() == false)
+			count++;
 	}
 
 	return count;
@@ -168,17 +169,15 @@ uint32 StateMachine::FindNumOutTransitions(const State* sourceState, bool ignore
 
 StateTransition* StateMachine::FindOutTransition(const State* sourceState, uint32 index, bool ignoreDisabled) const
 {
-	const uint32 numTransitions = mConnections.Size();
+	const uint32 numTransitions = sourceState->GetNumOutTransitions();
+	if (ignoreDisabled == false)
+		return (index < numTransitions ? sourceState->GetOutTransition(index) : NULL);
 
 	uint32 count = 0;
 	for (uint32 i = 0; i < numTransitions; ++i)
 	{
-		StateTransition* transition = GetTransition(i);
-
-		if (transition->GetSourceState() != sourceState)
-			continue;
-
-		if (ignoreDisabled == true && transition->IsDisabled() == true)
+		StateTransition* transition = sourceState->GetOutTransition(i);
+		if (transition->IsDisabled() == true)
 			continue;
 
 		if (count == index)
@@ -191,23 +190,18 @@ StateTransition* StateMachine::FindOutTransition(const State* sourceState, uint3
 }
 
 
+// count the incoming transitions of a state
 uint32 StateMachine::FindNumInTransitions(const State* targetState, bool ignoreDisabled) const
 {
-	const uint32 numTransitions = mConnections.Size();
+	const uint32 numTransitions = targetState->GetNumInTransitions();
+	if (ignoreDisabled == false)
+		return numTransitions;
 
 	uint32 count = 0;
 	for (uint32 i = 0; i < numTransitions; ++i)
 	{
-		StateTransition* transition = GetTransition(i);
-
-		if (transition->GetTargetState() != targetState)
-			continue;
-
-		if (ignoreDisabled == true && transition->IsDisabled() == true)
-			continue;
-
-		// found one
-		count++;
+		if (targetState->GetInTransition(i)->IsDisabled() == false)
+			count++;
 	}
 
 	return count;
@@ -216,23 +210,20 @@ uint32 StateMachine::FindNumInTransitions(const State* targetState, bool ignoreD
 
 StateTransition* StateMachine::FindInTransition(const State* targetState, uint32 index, bool ignoreDisabled) const
 {
-	const uint32 numTransitions = mConnections.Size();
+	const uint32 numTransitions = targetState->GetNumInTransitions();
+	if (ignoreDisabled == false)
+		return (index < numTransitions ? targetState->GetInTransition(index) : NULL);
 
 	uint32 count = 0;
 	for (uint32 i = 0; i < numTransitions; ++i)
 	{
-		StateTransition* transition = GetTransition(i);
-
-		if (transition->GetTargetState() != targetState)
-			continue;
-
-		if (ignoreDisabled == true && transition->IsDisabled() == true)
+		StateTransition* transition = targetState->GetInTransition(i);
+		if (transition->IsDisabled() == true)
 			continue;
 
 		if (count == index)
 			return transition;
 
-		// found one
 		count++;
 	}
 
@@ -287,6 +278,9 @@ void StateMachine::StartTransition(StateTransition* transition)
 
 	sourceState->OnTryStateExit(transition);
 
+	// the active states and transitions have to be collected again
+	mActiveSetsDirty = true;
+
 	//  if target node is already in active or transition state, dont enter the state again the transition (so it behaves as if it was activated)
 	if (targetState->OnTryStateEnter(sourceState, transition) == true)
 		transition->OnStartTransition();
@@ -308,26 +302,23 @@ void StateMachine::CheckConditions(State* sourceState)
 	if (sourceState == NULL)
 		return;
 
-	// num transitions total
-	const uint32 numTransitions	= GetNumConnections();
+	// only the transitions that start from the given state have to be checked
+	const uint32 numTransitions = sourceState->GetNumOutTransitions();
+	if (numTransitions == 0)
+		return;
 
-	// FIXME optimize alloc
-	// arrays to collect all ready transitions from this node
-	Array<StateTransition*> readyTransitions;
-	readyTransitions.Reserve(10);
+	// collect all ready transitions from this node (the array is reused to avoid allocations)
+	Array<StateTransition*>& readyTransitions = mReadyTransitions;
+	readyTransitions.Clear(false);
 
 	// find ready transitions
 	for (uint32 i=0; i<numTransitions; ++i)
 	{
 		// get the current transition and skip it directly if in case it is disabled
-		StateTransition* curTransition = GetTransition(i);
+		StateTransition* curTransition = sourceState->GetOutTransition(i);
 		if (curTransition->IsDisabled() == true)
 			continue;
 
-		// skip transitions that don't start from our given start node
-		if (curTransition->GetSourceState() != sourceState)
-			continue;
-
 		// make sure source node can exit
 		if (sourceState->CanExit(curTransition) == false)
 			continue;
@@ -399,19 +390,15 @@ void StateMachine::UpdateConditions(State* state, const Time& elapsed, const Tim
 	if (state == NULL)
 		return;
 
-	// get the number of transitions and iterate through them
-	const uint32 numTransitions = GetNumConnections();
+	// get the number of outgoing transitions and iterate through them
+	const uint32 numTransitions = state->GetNumOutTransitions();
 	for (uint32 i=0; i<numTransitions; ++i)
 	{
 		// get the current transition and skip it directly if in case it is disabled
-		StateTransition* transition = GetTransition(i);
+		StateTransition* transition = state->GetOutTransition(i);
 		if (transition->IsDisabled() == true)
 			continue;
 
-		// skip transitions that don't start from our given current node
-		if (transition->GetSourceNode() != state)
-			continue;
-
 		// skip transitions that are not made for interrupting when we are currently transitioning
 		if (transition->IsTransitioning() == true)
 			continue;
@@ -434,7 +421,7 @@ void StateMachine::Update(const Time& elapsed, const Time& delta)
 	if (mIsRunning == false ||  mCreud.Execute() == false)
 		return;
 
-	// PHASE 1: check all conditions and collect all states and Transitions
+	// PHASE 1: check all conditions of the transitions that start from an active state
 	
 	// update all conditions from the transitions that start from an active state state
 	const uint32 numActiveStates = mActiveStates.Size();
@@ -451,10 +438,15 @@ void StateMachine::Update(const Time& elapsed, const Time& delta)
 		CheckConditions(activeState);
 	}
 
-	CollectStates();
-	CollectTransitions();
+	// only collect the active transitions again if one of them was started
+	if (mActiveSetsDirty == true)
+	{
+		CollectTransitions();
+		mActiveSetsDirty = false;
+	}
 
 	// PHASE 2: Check if a transition has finished
+	bool transitionEnded = false;
 	const uint32 numTransitions = mActiveTransitions.Size();
 	for (uint32 i = 0; i < numTransitions; ++i)
 	{
@@ -481,11 +473,16 @@ void StateMachine::Update(const Time& elapsed, const Time& delta)
 
 			// reset the transition
 			transition->Reset();
+			transitionEnded = true;
 		}
 	}
 
-	// collect states again, the active ones might have changed
-	CollectStates();
+	// remove the finished transitions; the active states might have changed, too
+	if (transitionEnded == true)
+	{
+		CollectTransitions();
+		CollectActiveStates();
+	}
 	
 	// PHASE 3: Check if exit state was reached
 	if (ExitStateReached() == true)
@@ -498,18 +495,18 @@ void StateMachine::Update(const Time& elapsed, const Time& delta)
 		return;
 	}
 
-	// PHASE 4: Update all states
-	
+	// PHASE 4: Update all states and collect the active ones (states may activate or disable themselves during the update)
+	mActiveStates.Clear(false);
+
 	const uint32 numStates = mNodes.Size();
 	for (uint32 i = 0; i<numStates; ++i)
 	{
 		State* state = GetState(i);
 		state->Update(elapsed, delta);
-	}
 
-	// TODO I don't think this is necessary here? check again!
-	// collects states again, states may have disabled themselfs
-	CollectStates();
+		if (state->IsActive() == true || state->IsTransitioning())
+			mActiveStates.Add(state);
+	}
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -565,6 +562,9 @@ bool StateMachine::Load(const Json& json, const Json::Item& item)
 	// TODO FIXME this has serialized by graph object, but this is not permitted by the structure right now (root object is not written correctly)
 	//Read(jsonParser, parentItem, true);
 
+	// collect the states only once the state machine is complete
+	mIsLoading = true;
+
 	// 1: load all nodes
 	if (GraphImporter::LoadNodes(json, item, this) == false)
 		success = false;
@@ -573,6 +573,9 @@ bool StateMachine::Load(const Json& json, const Json::Item& item)
 	if (GraphImporter::LoadTransitions(json, item, this) == false)
 		success = false;
 
+	mIsLoading = false;
+	OnGraphModified(this, NULL);
+
 	// TODO nested statemachine loading
 
 	// iterate over the classifiers and preload them (only for the root state machine)
@@ -636,6 +639,18 @@ bool StateMachine::RemoveNode(Node* node)
 }
 
 
+// states or transitions were added or removed: update the state lists and the active transitions (they are not collected during the update, and may point to a deleted transition now)
+void StateMachine::OnGraphModified(Graph* graph, GraphObject* object)
+{
+	if (graph != this)
+		return;
+
+	CollectStates();
+	CollectTransitions();
+	mActiveSetsDirty = false;
+}
+
+
 // rewind the nodes in the state machine
 void StateMachine::Reset()
 {
@@ -653,17 +668,23 @@ void StateMachine::Reset()
 		EntryState* entryState = mEntryStates[i];
 		entryState->ForceActivate();
 	}
+
+	// forget the states and transitions that were active before the reset
+	CollectActiveStates();
+	CollectTransitions();
+	mActiveSetsDirty = false;
 }
 
 
 // gather all important different classes of states
 void StateMachine::CollectStates()
 {
+	CollectActiveStates();
+
 	// get the number of nodes inside the classifier
 	const uint32 numStates = mNodes.Size();
 
 	// calculate the number of output nodes
-	uint32 numActiveStates = 0;
 	uint32 numEntryStates = 0;
 	uint32 numExitStates = 0;
 	uint32 numActionStates = 0;
@@ -672,9 +693,6 @@ void StateMachine::CollectStates()
 	{
 		State* state = GetState(i);
 
-		if (state->IsActive() == true || state->IsTransitioning())
-			numActiveStates++;
-
 		if (state->GetType() == EntryState::TYPE_ID)
 			numEntryStates++;
 
@@ -686,12 +704,10 @@ void StateMachine::CollectStates()
 	}
 
 	// make sure our arrays have the correct size
-	if (mActiveStates.Size() != numActiveStates)	mActiveStates.Resize(numActiveStates);
 	if (mEntryStates.Size() != numEntryStates)		mEntryStates.Resize(numEntryStates);
 	if (mExitStates.Size() != numExitStates)		mExitStates.Resize(numExitStates);
 	if (mActionStates.Size() != numActionStates)	mActionStates.Resize(numActionStates);
 
-	uint32 activeStateIndex = 0;
 	uint32 entryStateIndex = 0;
 	uint32 exitStateIndex = 0;
 	uint32 actionStateIndex = 0;
@@ -700,12 +716,6 @@ void StateMachine::CollectStates()
 	{
 		State* state = GetState(i);
 
-		if (state->IsActive() == true || state->IsTransitioning())
-		{
-			mActiveStates[activeStateIndex] = state;
-			activeStateIndex++;
-		}
-
 		if (state->GetType() == EntryState::TYPE_ID)
 		{
 			mEntryStates[entryStateIndex] = static_cast<EntryState*>(state);
@@ -727,6 +737,22 @@ void StateMachine::CollectStates()
 }
 
 
+// gather all states that are active or transitioning
+void StateMachine::CollectActiveStates()
+{
+	mActiveStates.Clear(false);
+
+	const uint32 numStates = mNodes.Size();
+	for (uint32 i = 0; i<numStates; ++i)
+	{
+		State* state = GetState(i);
+
+		if (state->IsActive() == true || state->IsTransitioning())
+			mActiveStates.Add(state);
+	}
+}
+
+
 // gather all important different classes of states
 void StateMachine::CollectTransitions()
 {
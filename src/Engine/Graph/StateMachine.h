@@ -113,11 +113,13 @@ class ENGINE_API StateMachine : public Graph
 		///////////////////////////////////////////////////////////////////////////////////////////////////////
 		
 		bool RemoveNode(Node* node) override final;
+		void OnGraphModified(Graph* graph, GraphObject* object) override;
 		
 		void CollectObjects() override final;
 		
 		// gather all important different classes of states
 		void CollectStates();
+		void CollectActiveStates();
 
 		State* GetState(uint32 index);
 
@@ -178,6 +180,8 @@ class ENGINE_API StateMachine : public Graph
 
 		Core::Array<State*>				mActiveStates;		
 		Core::Array<StateTransition*>	mActiveTransitions;
+		bool							mActiveSetsDirty;		// a transition was started since the active transitions were collected
+		Core::Array<StateTransition*>	mReadyTransitions;		// temporary array used by CheckConditions()
 
 		Core::Array<EntryState*>		mEntryStates;		
 		Core::Array<ExitState*>			mExitStates;		
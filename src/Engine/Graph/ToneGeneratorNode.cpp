@@ -31,7 +31,7 @@ using namespace Core;
 
 ToneGeneratorNode::ToneGeneratorNode(Graph* graph) : SPNode(graph),
    mInstrument(INSTRUMENT_SINEWAVE),
-   mSineWave(),
+   mSineWave(1, AUDIOSAMPLERATE),
    mClarinet(),
    mFlute(1.0),
    mGuitar(),
@@ -70,7 +70,7 @@ void ToneGeneratorNode::Init()
 
 void ToneGeneratorNode::ResetTone()
 {
-   mSineWave.reset();      // reset tone
+   mSineWave.Reset();      // reset tone
    mClarinet.clear();      // reset clarinet
    mFlute.clear();         // reset flute
    mGuitar.clear();        // reset guitar
@@ -182,7 +182,7 @@ void ToneGeneratorNode::Update(const Time& elapsed, const Time& delta)
       case INSTRUMENT_FLUTE:    mFlute.noteOn(freq, ::std::min(amplitude, 1.0));    break;
       case INSTRUMENT_GUITAR:   mGuitar.noteOn(freq, amplitude);   break;
       case INSTRUMENT_SITAR:    mSitar.noteOn(freq, amplitude);    break;
-      default:                  mSineWave.setFrequency(freq);      break;
+      default:                  mSineWave.SetFrequency(0, freq);   break;
       }
       mLastToneDelta = 0.0;
    }
@@ -215,13 +215,22 @@ void ToneGeneratorNode::Update(const Time& elapsed, const Time& delta)
    while (nfrms) {
       if (p >= e) p = mSamples;
       switch (mInstrument) {
-      case INSTRUMENT_CLARINET: *p++ = (float)mClarinet.tick(); break;
-      case INSTRUMENT_FLUTE:    *p++ = (float)mFlute.tick();    break;
-      case INSTRUMENT_GUITAR:   *p++ = (float)mGuitar.tick();   break;
-      case INSTRUMENT_SITAR:    *p++ = (float)mSitar.tick();    break;
-      default:                  *p++ = (float)mSineWave.tick(); break;
+      case INSTRUMENT_CLARINET: *p++ = (float)mClarinet.tick(); nfrms--; break;
+      case INSTRUMENT_FLUTE:    *p++ = (float)mFlute.tick();    nfrms--; break;
+      case INSTRUMENT_GUITAR:   *p++ = (float)mGuitar.tick();   nfrms--; break;
+      case INSTRUMENT_SITAR:    *p++ = (float)mSitar.tick();    nfrms--; break;
+      default:
+      {
+         // sine in blocks up to the end of the ring buffer
+         const uint32_t n = ::std::min(nfrms, (uint32_t)(e - p));
+         mSineSamples.Resize(n);
+         mSineWave.GenerateChannel(0, n, mSineSamples.GetPtr());
+         for (uint32_t i = 0; i < n; i++)
+            *p++ = (float)mSineSamples[i];
+         nfrms -= n;
+         break;
+      }
       }
-      nfrms--;
    }
 
    // save back index
@@ -28,9 +28,9 @@
 #include "../Config.h"
 #include "../Core/StandardHeaders.h"
 #include "SPNode.h"
+#include "../DSP/SignalGenerator.h"
 
 // STK
-#include <stk/SineWave.h>
 #include <stk/Instrmnt.h>
 #include <stk/Clarinet.h>
 #include <stk/Flute.h>
@@ -98,13 +98,14 @@ public:
 
 private:
    uint32_t        mInstrument;
-   stk::SineWave   mSineWave;
+   SignalGenerator mSineWave;
    stk::Clarinet   mClarinet;
    stk::Flute      mFlute;
    stk::Guitar     mGuitar;
    stk::Sitar      mSitar;
    double          mLastToneDelta;
    double          mSamplesAhead;
+   Core::Array<double> mSineSamples;
    union {
       const float* mSamplesEnd;
       const char*  mBufferEnd;
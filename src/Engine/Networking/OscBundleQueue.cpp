@@ -0,0 +1,245 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Engine/Precompiled.h>
+
+// include required headers
+#include "OscBundleQueue.h"
+#include "../Core/LogManager.h"
+#include <oscpack/OscOutboundPacketStream.h>
+#include <algorithm>
+#include <chrono>
+
+
+using namespace Core;
+
+// size of the OSC bundle header ("#bundle" and timetag) and the size prefix of each bundle element
+static const uint32 BUNDLE_HEADER_SIZE	= 16;
+static const uint32 ELEMENT_SIZE_PREFIX	= 4;
+
+// drop datagrams in case nobody sends them
+static const uint32 MAX_PENDING_BYTES	= 1024 * 1024;
+
+
+// constructor
+OscBundleQueue::OscBundleQueue()
+{
+	mInterrupted			= false;
+	mMaxDatagramSize		= 1500 - 20 - 8;
+	mNumMessagesQueued		= 0;
+	mNumDatagramsQueued		= 0;
+	mNumDatagramsDropped	= 0;
+
+	mEntries.Reserve(1024);
+}
+
+
+// destructor
+OscBundleQueue::~OscBundleQueue()
+{
+}
+
+
+// add a message
+void OscBundleQueue::AddMessage(const char* address, float value, double sampleTime)
+{
+	Entry entry;
+	entry.mAddress	= address;
+	entry.mValue	= value;
+	entry.mTime		= sampleTime;
+	mEntries.Add(entry);
+}
+
+
+// size of a message with one float argument: padded address, padded type tag string (",f") and the value
+uint32 OscBundleQueue::CalcMessageSize(const char* address)
+{
+	const uint32 addressSize = ((uint32)strlen(address) + 1 + 3) & ~3u;
+	return addressSize + 4 + 4;
+}
+
+
+// convert seconds since 1970 into an OSC (NTP) timetag: seconds since 1900 in the upper 32 bits, fraction in the lower 32 bits
+uint64 OscBundleQueue::CalcTimeTag(double secondsSinceEpoch)
+{
+	const double ntpEpochOffset = 2208988800.0;
+	const double ntpSeconds = secondsSinceEpoch + ntpEpochOffset;
+	const double seconds = floor(ntpSeconds);
+	const uint64 fraction = (uint64)((ntpSeconds - seconds) * 4294967296.0);
+
+	return ((uint64)seconds << 32) | (fraction & 0xFFFFFFFF);
+}
+
+
+// pack all messages into datagrams
+void OscBundleQueue::Flush(double currentTime)
+{
+	const uint32 numEntries = mEntries.Size();
+	if (numEntries == 0)
+		return;
+
+	// group the messages by sample time (keeps the order of the outputs inside a group)
+	std::stable_sort(mEntries.GetPtr(), mEntries.GetPtr() + numEntries, [](const Entry& a, const Entry& b) { return a.mTime < b.mTime; });
+
+	// sample times are engine times: place them relative to the wall clock
+	const double now = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	mBuildData.clear();
+	mBuildSizes.clear();
+	mChunks.Clear(false);
+
+	uint32 datagramSize = BUNDLE_HEADER_SIZE;	// size of the datagram if all chunks are nested into an outer bundle
+	for (uint32 i=0; i<numEntries; ++i)
+	{
+		const Entry& entry = mEntries[i];
+		const uint32 messageSize = CalcMessageSize(entry.mAddress) + ELEMENT_SIZE_PREFIX;
+
+		// the message does not even fit into a datagram on its own
+		if (BUNDLE_HEADER_SIZE + messageSize > mMaxDatagramSize)
+		{
+			LogError("OscBundleQueue: OSC message '%s' exceeds the maximum datagram size.", entry.mAddress);
+			continue;
+		}
+
+		// start a new chunk on a new sample time
+		const bool newTime = (mChunks.IsEmpty() == true || mEntries[i-1].mTime != entry.mTime);
+		uint32 addedSize = messageSize + (newTime == true ? ELEMENT_SIZE_PREFIX + BUNDLE_HEADER_SIZE : 0);
+
+		// datagram is full: send the collected chunks
+		if (mChunks.IsEmpty() == false && datagramSize + addedSize > mMaxDatagramSize)
+		{
+			WriteDatagram(mChunks.GetPtr(), mChunks.Size());
+			mChunks.Clear(false);
+			datagramSize = BUNDLE_HEADER_SIZE;
+			addedSize = messageSize + ELEMENT_SIZE_PREFIX + BUNDLE_HEADER_SIZE;
+		}
+
+		if (mChunks.IsEmpty() == true || addedSize > messageSize)
+		{
+			Chunk chunk;
+			chunk.mFirstEntry	= i;
+			chunk.mNumEntries	= 0;
+			chunk.mTimeTag		= CalcTimeTag( now - Max(0.0, currentTime - entry.mTime) );
+			mChunks.Add(chunk);
+		}
+
+		mChunks.GetLast().mNumEntries++;
+		datagramSize += addedSize;
+	}
+
+	if (mChunks.IsEmpty() == false)
+		WriteDatagram(mChunks.GetPtr(), mChunks.Size());
+
+	mNumMessagesQueued += numEntries;
+	mEntries.Clear(false);
+
+	if (mBuildSizes.empty() == true)
+		return;
+
+	// hand the datagrams over to the sender
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+
+		if (mPendingData.size() + mBuildData.size() > MAX_PENDING_BYTES)
+		{
+			mNumDatagramsDropped += (uint32)mPendingSizes.size();
+			mPendingData.clear();
+			mPendingSizes.clear();
+		}
+
+		mPendingData.insert(mPendingData.end(), mBuildData.begin(), mBuildData.end());
+		mPendingSizes.insert(mPendingSizes.end(), mBuildSizes.begin(), mBuildSizes.end());
+	}
+
+	mNumDatagramsQueued += (uint32)mBuildSizes.size();
+	mCondition.notify_one();
+}
+
+
+// write one datagram (a single bundle, or an outer bundle with one nested bundle per sample time)
+void OscBundleQueue::WriteDatagram(const Chunk* chunks, uint32 numChunks)
+{
+	const size_t offset = mBuildData.size();
+	mBuildData.resize(offset + mMaxDatagramSize);
+
+	osc::OutboundPacketStream stream(mBuildData.data() + offset, mMaxDatagramSize);
+
+	const bool isNested = (numChunks > 1);
+	if (isNested == true)
+		stream << osc::BeginBundle(chunks[0].mTimeTag);
+
+	for (uint32 c=0; c<numChunks; ++c)
+	{
+		const Chunk& chunk = chunks[c];
+		stream << osc::BeginBundle(chunk.mTimeTag);
+
+		const uint32 endEntry = chunk.mFirstEntry + chunk.mNumEntries;
+		for (uint32 i=chunk.mFirstEntry; i<endEntry; ++i)
+		{
+			const Entry& entry = mEntries[i];
+			stream << osc::BeginMessage(entry.mAddress) << entry.mValue << osc::EndMessage;
+		}
+
+		stream << osc::EndBundle;
+	}
+
+	if (isNested == true)
+		stream << osc::EndBundle;
+
+	const uint32 size = (uint32)stream.Size();
+	mBuildData.resize(offset + size);
+	mBuildSizes.push_back(size);
+}
+
+
+// wait until datagrams are available and take them
+bool OscBundleQueue::WaitForDatagrams(std::vector<char>& outData, std::vector<uint32>& outSizes, uint32 timeoutInMs)
+{
+	outData.clear();
+	outSizes.clear();
+
+	std::unique_lock<std::mutex> lock(mLock);
+	mCondition.wait_for(lock, std::chrono::milliseconds(timeoutInMs), [this] { return mPendingSizes.empty() == false || mInterrupted == true; });
+
+	mInterrupted = false;
+	if (mPendingSizes.empty() == true)
+		return false;
+
+	// swap the buffers (keeps the allocations of both sides)
+	outData.swap(mPendingData);
+	outSizes.swap(mPendingSizes);
+	return true;
+}
+
+
+// wake up the waiting sender
+void OscBundleQueue::Interrupt()
+{
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		mInterrupted = true;
+	}
+	mCondition.notify_all();
+}
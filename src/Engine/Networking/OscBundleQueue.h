@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_OSCBUNDLEQUEUE_H
+#define __NEUROMORE_OSCBUNDLEQUEUE_H
+
+// include required headers
+#include "../Config.h"
+#include "../Core/StandardHeaders.h"
+#include "../Core/Array.h"
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+// Collects the OSC messages of all outputs during an engine update and packs them into timestamped OSC bundles, one bundle per sample time.
+// The bundles are combined into datagrams of at most GetMaxDatagramSize() bytes (nested into an outer bundle if a datagram holds more than one sample time).
+// The datagrams are handed over to a sender on another thread (see WaitForDatagrams()), so the engine never blocks on the network.
+class ENGINE_API OscBundleQueue
+{
+	public:
+		// constructor & destructor
+		OscBundleQueue();
+		virtual ~OscBundleQueue();
+
+		// add a message (engine thread); the address string must stay valid until Flush() is called
+		void AddMessage(const char* address, float value, double sampleTime);
+
+		// pack all messages added since the last flush into datagrams (engine thread); sample times are converted to timetags relative to the given current time
+		void Flush(double currentTime);
+
+		// wait until datagrams are available and take them (sender thread); the datagrams are stored back to back in outData, returns false on timeout or interrupt
+		bool WaitForDatagrams(std::vector<char>& outData, std::vector<uint32>& outSizes, uint32 timeoutInMs);
+
+		// wake up the waiting sender (e.g. to stop the sender thread)
+		void Interrupt();
+
+		// the maximum size of a datagram (default: Ethernet MTU minus IP and UDP headers)
+		void SetMaxDatagramSize(uint32 numBytes)					{ mMaxDatagramSize = numBytes; }
+		uint32 GetMaxDatagramSize() const							{ return mMaxDatagramSize; }
+
+		// statistics
+		uint32 GetNumMessagesQueued() const							{ return mNumMessagesQueued; }
+		uint32 GetNumDatagramsQueued() const						{ return mNumDatagramsQueued; }
+		uint32 GetNumDatagramsDropped() const						{ return mNumDatagramsDropped; }
+
+		// convert seconds since 1970 into an OSC (NTP) timetag
+		static uint64 CalcTimeTag(double secondsSinceEpoch);
+
+	private:
+		struct Entry
+		{
+			const char*		mAddress;
+			float			mValue;
+			double			mTime;
+		};
+
+		// part of the messages of one sample time inside a datagram
+		struct Chunk
+		{
+			uint32			mFirstEntry;
+			uint32			mNumEntries;
+			uint64			mTimeTag;
+		};
+
+		static uint32 CalcMessageSize(const char* address);
+		void WriteDatagram(const Chunk* chunks, uint32 numChunks);
+
+		// collected messages (engine thread only)
+		Core::Array<Entry>				mEntries;
+		Core::Array<Chunk>				mChunks;
+		std::vector<char>				mBuildData;
+		std::vector<uint32>				mBuildSizes;
+
+		// datagrams waiting for the sender
+		std::mutex						mLock;
+		std::condition_variable			mCondition;
+		std::vector<char>				mPendingData;
+		std::vector<uint32>				mPendingSizes;
+		bool							mInterrupted;
+
+		uint32							mMaxDatagramSize;
+
+		// statistics
+		std::atomic<uint32>				mNumMessagesQueued;
+		std::atomic<uint32>				mNumDatagramsQueued;
+		std::atomic<uint32>				mNumDatagramsDropped;
+};
+
+
+#endif
@@ -34,6 +34,7 @@
 #include "OscMessageParser.h"
 #include "OscMessageQueue.h"
 #include "OscPacketPool.h"
+#include "OscBundleQueue.h"
 
 
 // the osc message router
@@ -80,6 +81,9 @@ class ENGINE_API OscMessageRouter
 		uint32 GetNumPooledPacketsFree() const					{ return mPacketPool.GetNumFreePackets(); }
 		uint32 GetNumPooledPacketsUsed() const					{ return mPacketPool.GetNumUsedPackets(); }
 
+		// outgoing messages packed into timestamped bundles (flushed after each engine update, sent by a network thread)
+		OscBundleQueue* GetOutputBundleQueue()					{ return &mBundleQueue; }
+
 		// performance statistics
 		const Core::FpsCounter& GetFpsCounter() const			{ return mFpsCounter; }
 		
@@ -107,6 +111,7 @@ class ENGINE_API OscMessageRouter
 		// packet pool for outgoing packets
 		OscPacketPool						mPacketPool;
 		Core::Array<OscPacket*>				mOutputPacketQueue;
+		OscBundleQueue						mBundleQueue;
 		
 		// FPS counter
 		Core::FpsCounter					mFpsCounter;
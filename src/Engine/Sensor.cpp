@@ -55,6 +55,7 @@ Sensor::Sensor(const char* name, double sampleRate) : Sensor(name, sampleRate, s
 Sensor::Sensor(const char* name, double sampleRateOut, double sampleRateIn)
 {
 	mID				 = CORE_COUNTER.Next();
+	mIsPassthrough	 = false;
 	mIsEnabled		 = true;
 	mHardwareChannel = -1;
 	mLatency		 = 0;
@@ -81,12 +82,14 @@ Sensor::Sensor(const char* name, double sampleRateOut, double sampleRateIn)
 	GetInput()->SetName(name);
 	GetInput()->SetIndependent(true);  // input is by default independent (data stream from the hardware running on different clock)
 	GetInput()->SetSampleRate(sampleRateIn);
+	GetInput()->SetUseTimeIndex(sampleRateIn == 0.0);		// irregular samples: keep their arrival times
 
 	// create and configure resampler
 	mResampler.SetInput(&mInputChannel);
 	mResampler.SetResampleMode(ResampleProcessor::REALTIME);
 	mResampler.SetOutputSampleRate(mSampleRate);
 	mResampler.ReInit();
+	UpdatePassthrough();
 
 	// forward input channel specsconfigure specs of output channel the same as the input channel
 	GetOutput()->SetMinValue(GetInput()->GetMinValue());
@@ -120,16 +123,26 @@ void Sensor::Update(const Time& elapsed, const Time& delta)
 	// always reset counter before adding the new samples
 	GetInput()->BeginAddSamples();
 
-	// add samples to raw sample channel
-	for (uint32 i = 0; i < numQueuedSamples; ++i)
-		GetInput()->AddSample(mQueuedSamples[i]);
+	// add samples to raw sample channel (stamped with the current time if the input has no fixed sample rate)
+	if (GetInput()->HasTimeIndex() == true)
+	{
+		for (uint32 i = 0; i < numQueuedSamples; ++i)
+			GetInput()->AddSample(mQueuedSamples[i], elapsed);
+	}
+	else
+	{
+		for (uint32 i = 0; i < numQueuedSamples; ++i)
+			GetInput()->AddSample(mQueuedSamples[i]);
+	}
 	
 	// clear the queued samples
 	mQueuedSamples.Clear();
 
 	mQueuedSamplesLock.Unlock();
 
-	mResampler.Update(elapsed, delta);
+	// passthrough: the samples were added to the output channel directly
+	if (mIsPassthrough == false)
+		mResampler.Update(elapsed, delta);
 
 	// increase elapsed time of the channels and update latency
 	GetOutput()->SetElapsedTime(elapsed);
@@ -164,7 +177,7 @@ void Sensor::Reset()
 	GetOutput()->Reset();
 	ClearQueuedSamples();
 	
-	GetInput()->Reset();
+	mInputChannel.Reset();
 
 	// clear burst sizes
 	mBursts.SetAll(0);
@@ -182,7 +195,7 @@ void Sensor::SetStartTime(const Time& seconds)
 {
 	// set channel start time
 	GetOutput()->SetStartTime(seconds);
-	GetInput()->SetStartTime(seconds);
+	mInputChannel.SetStartTime(seconds);
 }
 
 
@@ -194,11 +207,54 @@ void Sensor::SetSampleRate(double sampleRate)
 	// set samplerate on input and output
 	// the resampler evaluates this
 	GetOutput()->SetSampleRate(mSampleRate);
-	GetInput()->SetSampleRate(mSampleRate);
+	mInputChannel.SetSampleRate(mSampleRate);
+	mInputChannel.SetUseTimeIndex(mSampleRate == 0.0);
 
 	// set sample rate of resampler
 	mResampler.SetOutputSampleRate(mSampleRate);
 	mResampler.ReInit();
+	UpdatePassthrough();
+}
+
+
+// enable/disable drift correction (passthrough is only possible without it)
+void Sensor::SetDriftCorrectionEnabled(bool enable)
+{
+	mUseDriftCorrection = enable;
+	UpdatePassthrough();
+}
+
+
+// enable/disable passthrough mode after the configuration changed
+void Sensor::UpdatePassthrough()
+{
+	// the resampler would only forward the samples 1:1
+	const bool passthrough = (mUseDriftCorrection == false && mResampler.GetResampleAlgo() == ResampleProcessor::FORWARD);
+
+	Channel<double>* output = GetOutput();
+	if (passthrough == true)
+	{
+		if (mIsPassthrough == false)
+		{
+			// the output takes over the buffer size of the input (devices configure it via GetInput())
+			if (output->IsEmpty() == true && mInputChannel.GetBufferSize() > output->GetBufferSize())
+				output->SetBufferSize(mInputChannel.GetBufferSize());
+
+			// release the input buffer memory
+			mInputChannel.SetBufferSize(1);
+			mInputChannel.Clear(true);
+		}
+
+		// irregular samples: the output stores the timestamps instead of the input
+		output->SetUseTimeIndex(mInputChannel.HasTimeIndex());
+	}
+	else if (mIsPassthrough == true)
+	{
+		mInputChannel.SetBufferSize(output->GetBufferSize());
+		output->SetUseTimeIndex(false);
+	}
+
+	mIsPassthrough = passthrough;
 }
 
 
@@ -210,6 +266,15 @@ void Sensor::AddQueuedSample(double value)
 }
 
 
+void Sensor::AddQueuedSamples(const double* values, uint32 numValues)
+{
+	mQueuedSamplesLock.Lock();
+	for (uint32 i=0; i<numValues; ++i)
+		mQueuedSamples.Add(values[i]);
+	mQueuedSamplesLock.Unlock();
+}
+
+
 void Sensor::ClearQueuedSamples()
 { 
 	mQueuedSamplesLock.Lock();
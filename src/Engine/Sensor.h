@@ -64,6 +64,7 @@ class ENGINE_API Sensor
 
 		// input sample queue
 		void AddQueuedSample(double value);
+		void AddQueuedSamples(const double* values, uint32 numValues);
 		uint32 GetNumQueuedSamples() const										{ return mQueuedSamples.Size(); }
 
 		// the output channel
@@ -72,15 +73,18 @@ class ENGINE_API Sensor
 		// legacy
 		Channel<double>* GetChannel()											{ return GetOutput(); }
 
-		// the input channel
-		Channel<double>* GetInput()												{ return &mInputChannel; }
+		// the input channel (in passthrough mode this is the output channel itself)
+		Channel<double>* GetInput()												{ return (mIsPassthrough == true ? GetOutput() : &mInputChannel); }
+
+		// passthrough mode: if neither resampling nor drift correction is required, the samples are written straight into the output channel and the input channel stays empty
+		bool IsPassthrough() const												{ return mIsPassthrough; }
 
 		//
 		// Config
 		//
 		
 		// naming helpers
-		void SetName(const char* name)											{ GetOutput()->SetName(name); GetInput()->SetName(name); }
+		void SetName(const char* name)											{ GetOutput()->SetName(name); mInputChannel.SetName(name); }
 		const char* GetName() const												{ return GetOutput()->GetName(); }
 		const Core::String& GetNameString() const								{ return GetOutput()->GetNameString(); }
 
@@ -88,7 +92,7 @@ class ENGINE_API Sensor
 		uint32 GetID() const													{ return mID; }
 
 		// drift correction
-		void SetDriftCorrectionEnabled(bool enable = true)						{ mUseDriftCorrection = enable; }
+		void SetDriftCorrectionEnabled(bool enable = true);
 		bool GetDriftCorrectionEnabled() const									{ return mUseDriftCorrection; }
 		int32 CalculateDrift() const;
 
@@ -174,6 +178,10 @@ class ENGINE_API Sensor
 		void CorrectForDrift();						// performs the drift correction 
 		bool		mUseDriftCorrection;
 
+		// passthrough
+		void UpdatePassthrough();					// enable/disable passthrough mode after the configuration changed
+		bool		mIsPassthrough;
+
 		// sensor input stats
 		double		mRealSampleRate;				// the actual sample rate of the input stream that goes into the sensor
 		uint32		mNumDriftSamplesAdded;			// samples added to correct drift
@@ -27,10 +27,13 @@
 #include "Core/StandardHeaders.h"
 #include "Core/String.h"
 #include "Core/Timer.h"
+#include <atomic>
+#include <thread>
 #include "Core/Json.h"
 #include "Core/FpsCounter.h"
 #include "Core/LogManager.h"
 #include "EngineManager.h"
+#include "EngineThreadHandler.h"
 #include "CloudParameters.h"
 #include "SessionExporter.h"
 #include "Graph/GraphImporter.h"
@@ -67,17 +70,18 @@ Callback* gCallback = NULL;
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // forward declaration
-class EngineThreadHandler;
+class NMEngineThreadHandler;
 
 struct FeedbackData
 {
-	Core::String mName;
+	char mName[128];			// fixed size, so readers can copy the entry without touching the heap (longer names are truncated)
 	double mValue;
 	double mMinValue;
 	double mMaxValue;
 
 	void Reset()
 	{
+		mName[0]	= '\0';
 		mValue		= 0.0;
 		mMinValue	= 0.0;
 		mMaxValue	= 0.0;
@@ -85,55 +89,152 @@ struct FeedbackData
 };
 
 
+// feedback values of the last engine update, protected by a sequence lock: the engine thread publishes all values of an update at once
+// and readers (e.g. the render thread of a game) copy them without ever blocking it. A reader retries if the writer was active during the copy.
 class FeedbacksData
 {
 	public:
-		void Resize(uint32 newNumFeedbacks)
+		FeedbacksData() : mSequence(0), mData(NULL), mNumFeedbacks(0), mCapacity(0)		{}
+		~FeedbacksData()
 		{
-			mLock.Lock();
+			delete[] mData.load();
+			for (uint32 i=0; i<mRetiredData.Size(); ++i)
+				delete[] mRetiredData[i];
+		}
+
+		// writer: publish the values of one update (BeginUpdate, SetFeedbackData for every feedback, EndUpdate)
+		void BeginUpdate(uint32 newNumFeedbacks)
+		{
+			mWriteLock.Lock();
 
-			const uint32 numFeedbacks = mData.Size();
-			if (numFeedbacks == newNumFeedbacks)
+			// odd sequence number: update in progress
+			mSequence.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			// grow storage; readers might still be copying from the old array, so it is kept alive until destruction
+			if (newNumFeedbacks > mCapacity)
 			{
-				mLock.Unlock();
-				return;
+				FeedbackData* oldData = mData.load(std::memory_order_relaxed);
+				FeedbackData* newData = new FeedbackData[newNumFeedbacks];
+				const uint32 numFeedbacks = mNumFeedbacks.load(std::memory_order_relaxed);
+				for (uint32 i=0; i<newNumFeedbacks; ++i)
+				{
+					if (i < numFeedbacks)
+						newData[i] = oldData[i];
+					else
+						newData[i].Reset();
+				}
+
+				mData.store(newData, std::memory_order_relaxed);
+				if (oldData != NULL)
+					mRetiredData.Add(oldData);
+				mCapacity = newNumFeedbacks;
 			}
 
-			mData.Resize(newNumFeedbacks);
-			for (uint32 i=0; i<newNumFeedbacks; ++i)
+			// reset the entries if the number of feedbacks changed
+			if (newNumFeedbacks != mNumFeedbacks.load(std::memory_order_relaxed))
 			{
-				mData[i].Reset();
-			}
+				FeedbackData* data = mData.load(std::memory_order_relaxed);
+				for (uint32 i=0; i<newNumFeedbacks; ++i)
+					data[i].Reset();
 
-			mLock.Unlock();
+				mNumFeedbacks.store(newNumFeedbacks, std::memory_order_relaxed);
+			}
 		}
 
 		void SetFeedbackData(uint32 index, const char* name, double value, double minValue, double maxValue)
 		{
-			mLock.Lock();
-			const uint32 numFeedbacks = mData.Size();
-			if(index < numFeedbacks)
-			{
-				mData[index].mValue		= value;
-				mData[index].mMinValue	= minValue;
-				mData[index].mMaxValue	= maxValue;
+			if (index >= mNumFeedbacks.load(std::memory_order_relaxed))
+				return;
+
+			FeedbackData& data = mData.load(std::memory_order_relaxed)[index];
+			data.mValue		= value;
+			data.mMinValue	= minValue;
+			data.mMaxValue	= maxValue;
 
-				// only adjust name in case it differs
-				if (mData[index].mName.IsEqual(name) == false)
-					mData[index].mName = name;
+			// only adjust name in case it differs
+			if (strncmp(data.mName, name, sizeof(data.mName)-1) != 0)
+			{
+				strncpy(data.mName, name, sizeof(data.mName)-1);
+				data.mName[sizeof(data.mName)-1] = '\0';
 			}
-			mLock.Unlock();
 		}
 
-		uint32 GetNumFeedbacks()									{ uint32 result = 0; mLock.Lock(); result = mData.Size(); mLock.Unlock(); return result; }
-		double GetFeedbackValue(uint32 index)						{ double result = 0.0; mLock.Lock(); const uint32 numFeedbacks = mData.Size(); if(index < numFeedbacks) result = mData[index].mValue; mLock.Unlock(); return result; }
-		double GetFeedbackMinValue(uint32 index)					{ double result = 0.0; mLock.Lock(); const uint32 numFeedbacks = mData.Size(); if(index < numFeedbacks) result = mData[index].mMinValue; mLock.Unlock(); return result; }
-		double GetFeedbackMaxValue(uint32 index)					{ double result = 0.0; mLock.Lock(); const uint32 numFeedbacks = mData.Size(); if(index < numFeedbacks) result = mData[index].mMaxValue; mLock.Unlock(); return result; }
-		const char* GetFeedbackName(uint32 index)					{ const char* result = NULL; mLock.Lock(); const uint32 numFeedbacks = mData.Size(); if(index < numFeedbacks) result = mData[index].mName.AsChar(); mLock.Unlock(); return result; }
+		void EndUpdate()
+		{
+			// even sequence number: values are consistent again
+			mSequence.fetch_add(1, std::memory_order_release);
+
+			mWriteLock.Unlock();
+		}
+
+		// readers: lock-free, each call returns the values of a single engine update
+		uint32 GetNumFeedbacks() const								{ return mNumFeedbacks.load(std::memory_order_acquire); }
+
+		// copy one feedback; returns false if the index is out of range
+		bool GetFeedback(uint32 index, FeedbackData* outData) const
+		{
+			bool result;
+			uint32 sequence;
+			do
+			{
+				sequence = BeginRead();
+				result = (index < mNumFeedbacks.load(std::memory_order_relaxed));
+				if (result == true)
+					*outData = mData.load(std::memory_order_relaxed)[index];
+			} while (EndRead(sequence) == false);
+
+			return result;
+		}
+
+		// copy the values of all feedbacks; returns the number of feedbacks (may be larger than maxNumValues, only maxNumValues are copied)
+		uint32 GetFeedbackValues(double* outValues, uint32 maxNumValues) const
+		{
+			uint32 numFeedbacks;
+			uint32 sequence;
+			do
+			{
+				sequence = BeginRead();
+				numFeedbacks = mNumFeedbacks.load(std::memory_order_relaxed);
+				const FeedbackData* data = mData.load(std::memory_order_relaxed);
+
+				const uint32 numValues = Min(numFeedbacks, maxNumValues);
+				for (uint32 i=0; i<numValues; ++i)
+					outValues[i] = data[i].mValue;
+			} while (EndRead(sequence) == false);
+
+			return numFeedbacks;
+		}
+
+		double GetFeedbackValue(uint32 index) const					{ FeedbackData data; return GetFeedback(index, &data) ? data.mValue : 0.0; }
 
 	private:
-		Mutex						mLock;
-		Core::Array<FeedbackData>	mData;
+		// wait until no update is in progress, then remember the sequence number
+		uint32 BeginRead() const
+		{
+			uint32 sequence = mSequence.load(std::memory_order_acquire);
+			while ((sequence & 1) != 0)
+			{
+				std::this_thread::yield();
+				sequence = mSequence.load(std::memory_order_acquire);
+			}
+
+			return sequence;
+		}
+
+		// the copy is valid if the writer didn't start an update in the meantime
+		bool EndRead(uint32 sequence) const
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return mSequence.load(std::memory_order_relaxed) == sequence;
+		}
+
+		std::atomic<uint32>			mSequence;			// incremented before and after each update (odd while writing)
+		std::atomic<FeedbackData*>	mData;
+		std::atomic<uint32>			mNumFeedbacks;
+		uint32						mCapacity;
+		Array<FeedbackData*>		mRetiredData;		// arrays replaced while growing
+		Mutex						mWriteLock;			// only serializes writers, readers never take it
 };
 
 class NMEngineData
@@ -150,7 +251,7 @@ class NMEngineData
 
 		// engine update thread
 		Core::Thread*					mThread;
-		EngineThreadHandler*			mThreadHandler;
+		NMEngineThreadHandler*			mThreadHandler;
 
 		// thread safe feedback data
 		FeedbacksData					mFeedbackData;
@@ -239,9 +340,9 @@ void UpdateFeedbackData()
 	Classifier* classifier = engine->GetActiveClassifier();
 	if (classifier != NULL)
 	{
-		// resize the feedback data
+		// publish the feedback data of this update at once
 		const uint32 numFeedbacks = classifier->GetNumCustomFeedbackNodes();
-		gNMEngineData->mFeedbackData.Resize( numFeedbacks );
+		gNMEngineData->mFeedbackData.BeginUpdate( numFeedbacks );
 
 		// update feedback data
 		for (uint32 i=0; i<numFeedbacks; ++i)
@@ -253,6 +354,14 @@ void UpdateFeedbackData()
 			const double maxValue = node->GetRangeMax();
 			gNMEngineData->mFeedbackData.SetFeedbackData(i, node->GetName(), node->GetCurrentValue(), minValue, maxValue );
 		}
+
+		gNMEngineData->mFeedbackData.EndUpdate();
+	}
+	else if (gNMEngineData->mFeedbackData.GetNumFeedbacks() > 0)
+	{
+		// the classifier is gone: there are no feedbacks anymore
+		gNMEngineData->mFeedbackData.BeginUpdate(0);
+		gNMEngineData->mFeedbackData.EndUpdate();
 	}
 }
 
@@ -285,84 +394,42 @@ BOOL Update()
 // neuromore Engine Thread Handler
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-class EngineThreadHandler : public Core::ThreadHandler
+class NMEngineThreadHandler : public EngineThreadHandler
 {
 	public:
 		// constructor & destructor
-		EngineThreadHandler() : ThreadHandler()			{ mBreak = false;}
-		virtual ~EngineThreadHandler()					{}
+		NMEngineThreadHandler() : EngineThreadHandler(60.0)		{}
+		virtual ~NMEngineThreadHandler()						{}
 
-		// start thread execution
-		void Execute() override
+	protected:
+		bool Init() override
 		{
-			mIsFinished = false;
-			mBreak = false;
-
-			// get access to the engine
-			EngineManager* engine = GetEngine();
-			if (engine == NULL)
-			{
-				LogError("Cannot start engine thread. Engine manager not valid.");
-				mBreak = true;
-				mIsFinished = true;
-			}
+			if (EngineThreadHandler::Init() == false)
+				return false;
 
 			// get the active classifier
-			Classifier* classifier = engine->GetActiveClassifier();
+			Classifier* classifier = GetEngine()->GetActiveClassifier();
 			if (classifier == NULL)
 			{
 				LogError("Cannot start engine thread. No active classifier.");
-				mBreak = true;
-				mIsFinished = true;
+				return false;
 			}
 
-			// reset the timer
-			mRealTimer.GetTimeDelta();
-
-			mDesiredFps = 60;
-			const double desiredFpsDeltaTime = 1.0 / mDesiredFps;
-
-			// real-time loop
-			while (mBreak == false)
-			{
-				// get the time delta since the last iteration
-				const Time timeDelta = mRealTimer.GetTimeDelta();
-
-				// update engine
-				mFpsCounter.BeginTiming();
-				mUpdateTimer.GetTimeDelta();
-
-				// update engine
-				Update( timeDelta );
-
-				const double updateTime = mUpdateTimer.GetTimeDelta().InSeconds();
-				mFpsCounter.StopTiming();
-
-				// update the fps statistics of the engine data (thread safe operation)
-				PerformanceStatistics perfStats( mFpsCounter.GetFps(), mFpsCounter.GetTheoreticalFps(), mFpsCounter.GetAveragedTimeDelta(), mFpsCounter.GetBestCaseTiming(), mFpsCounter.GetWorstCaseTiming() );
-				gNMEngineData->SetPerformanceStatistics( perfStats );
-
-				// update rate control
-				const double sleepTime = desiredFpsDeltaTime - updateTime;
-				if (mBreak == false && sleepTime > 0.0)
-					Thread::Sleep( sleepTime * 1000.0 );
-			}
-
-			mIsFinished = true;
+			return true;
 		}
 
-		// stop and terminate thread
-		void Terminate() override
+		// update engine and feedback data
+		void Update(const Time& timeDelta) override
 		{
-			mBreak = true;
+			neuromoreEngine::Update( timeDelta );
 		}
 
-	private:
-		FpsCounter				mFpsCounter;
-		Timer					mRealTimer;			// times the differences between full real-time loop iterations (real time!)
-		Timer					mUpdateTimer;		// times how long the engine->Update() call takes
-		uint32					mDesiredFps;
-		bool					mBreak;
+		// update the fps statistics of the engine data (thread safe operation)
+		void OnUpdateFinished(const FpsCounter& fpsCounter) override
+		{
+			PerformanceStatistics perfStats( fpsCounter.GetFps(), fpsCounter.GetTheoreticalFps(), fpsCounter.GetAveragedTimeDelta(), fpsCounter.GetBestCaseTiming(), fpsCounter.GetWorstCaseTiming() );
+			gNMEngineData->SetPerformanceStatistics( perfStats );
+		}
 };
 
 
@@ -468,7 +535,8 @@ BOOL SetBufferLength(double seconds)
 	if (!classifier)
 		return FALSE;
 
-	// resize classifier buffers
+	// resize classifier buffers (a fixed length replaces the automatic buffer size)
+	classifier->SetAutoBufferSizeEnabled(false);
 	classifier->SetBufferDuration(seconds);
 
 	return TRUE;
@@ -592,7 +660,7 @@ BOOL StartThreaded()
 		return FALSE;
 
 	// init thread
-	gNMEngineData->mThreadHandler = new EngineThreadHandler();
+	gNMEngineData->mThreadHandler = new NMEngineThreadHandler();
 	gNMEngineData->mThread = new Thread(gNMEngineData->mThreadHandler, "neuromore Engine Thread");
 
 	// start thread if not already running
@@ -994,7 +1062,7 @@ BOOL LoadClassifier(const char* jsonContent, const char* uuid, int revision)
 
 	// try to load new classifier
 	Classifier* classifier = new Classifier();
-	if (GraphImporter::LoadFromString(jsonContent, classifier) == false)
+	if (GetEngine()->GetGraphTemplateCache()->Load(jsonContent, uuid, revision, classifier) == false)
 	{
 		delete classifier;
 		classifier = NULL;
@@ -1014,6 +1082,20 @@ BOOL LoadClassifier(const char* jsonContent, const char* uuid, int revision)
 }
 
 
+// parse the given classifier or state machine ahead of time
+BOOL PreloadGraph(const char* jsonContent, const char* uuid, int revision)
+{
+	// make sure the engine got initialized
+	if (GetEngine() == NULL)
+		return FALSE;
+
+	if (GetEngine()->GetGraphTemplateCache()->Add(jsonContent, uuid, revision) == false)
+		return FALSE;
+
+	return TRUE;
+}
+
+
 BOOL HasClassifier()
 {
 	// make sure the engine got initialized
@@ -1089,17 +1171,15 @@ int GetNumFeedbacks()
 // get the node name of a custom feedback node
 const char* GetFeedbackName(int index)
 {
-	if (gNMEngineData == NULL)
+	if (gNMEngineData == NULL || index < 0)
 		return "";
 
-	if (index >= (int)gNMEngineData->mFeedbackData.GetNumFeedbacks())
+	// the name is copied, so the returned pointer stays valid until the next call from the same thread
+	static thread_local FeedbackData data;
+	if (gNMEngineData->mFeedbackData.GetFeedback(index, &data) == false)
 		return "";
 
-	const char* result = gNMEngineData->mFeedbackData.GetFeedbackName(index);
-	if (result == NULL)
-		return "";
-
-	return result;
+	return data.mName;
 }
 
 
@@ -1110,31 +1190,39 @@ void GetFeedbackRange(int index, double* outMinValue, double* outMaxValue)
 	*outMinValue = 0.0;
 	*outMaxValue = 0.0;
 
-	if (gNMEngineData == NULL)
+	if (gNMEngineData == NULL || index < 0)
 		return;
 
-	if (index >= (int)gNMEngineData->mFeedbackData.GetNumFeedbacks())
+	// output values
+	FeedbackData data;
+	if (gNMEngineData->mFeedbackData.GetFeedback(index, &data) == false)
 		return;
 
-	// output values
-	*outMinValue = gNMEngineData->mFeedbackData.GetFeedbackMinValue(index);
-	*outMaxValue = gNMEngineData->mFeedbackData.GetFeedbackMaxValue(index);
+	*outMinValue = data.mMinValue;
+	*outMaxValue = data.mMaxValue;
 }
 
 
 // get the current feedback values
 double GetCurrentFeedbackValue(int index)
 {
-	if (gNMEngineData == NULL)
-		return 0.0;
-
-	if (index >= (int)gNMEngineData->mFeedbackData.GetNumFeedbacks())
+	if (gNMEngineData == NULL || index < 0)
 		return 0.0;
 
 	return gNMEngineData->mFeedbackData.GetFeedbackValue(index);
 }
 
 
+// copy the values of all feedbacks from the same engine update
+int GetCurrentFeedbackValues(double* outValues, int maxNumValues)
+{
+	if (gNMEngineData == NULL || outValues == NULL || maxNumValues < 0)
+		return 0;
+
+	return gNMEngineData->mFeedbackData.GetFeedbackValues(outValues, maxNumValues);
+}
+
+
 // find the feedback index by name
 int FindFeedbackIndexByName(const char* name)
 {
@@ -1145,12 +1233,12 @@ int FindFeedbackIndexByName(const char* name)
 	}
 
 	// get the number of feedback nodes and iterate through them
+	FeedbackData data;
 	const uint32 numFeedbackNodes = gNMEngineData->mFeedbackData.GetNumFeedbacks();
 	for (uint32 i=0; i<numFeedbackNodes; ++i)
 	{
 		// compare node names and return index in case they are equal
-		const char* currentName = gNMEngineData->mFeedbackData.GetFeedbackName(i);
-		if (strcmp(currentName, name) == 0)
+		if (gNMEngineData->mFeedbackData.GetFeedback(i, &data) == true && strcmp(data.mName, name) == 0)
 			return i;
 	}
 
@@ -1520,7 +1608,7 @@ BOOL LoadStateMachine(const char* jsonContent, const char* uuid, int revision)
 
 	// load statemachine
 	StateMachine* stateMachine = new StateMachine();
-	if (GraphImporter::LoadFromString(jsonContent, stateMachine) == false)
+	if (GetEngine()->GetGraphTemplateCache()->Load(jsonContent, uuid, revision, stateMachine) == false)
 	{
 		delete stateMachine;
 		stateMachine = NULL;
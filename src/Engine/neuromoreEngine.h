@@ -59,7 +59,9 @@ namespace neuromoreEngine
    /**
    * Set the engine buffer length, in seconds.
    * Use this to adjust the buffer size of the engine. If you update the engine not often enough, or if you push too many samples in the devices at once,
-   * the buffers will overflow and OnError() will be called and the engine will stop. Default value is 5 seconds.
+   * the buffers will overflow and OnError() will be called and the engine will stop.
+   * By default the engine sizes every buffer automatically from the requirements of the nodes reading it and grows it if a reader falls behind;
+   * calling this function replaces the automatic sizing with a fixed length for all buffers.
    */
    NEUROMORE_EXPORT BOOL SetBufferLength(double seconds);
 
@@ -308,6 +310,16 @@ namespace neuromoreEngine
    */
    NEUROMORE_EXPORT BOOL LoadClassifier(const char* jsonContent, const char* uuid, int revision);
 
+   /**
+   * Parse a classifier or state machine and keep it cached, so a later LoadClassifier() or LoadStateMachine() with the same UUID and revision doesn't have to parse it again.
+   * Can be called from any thread, also while the engine is running.
+   * @param[in] jsonContent A string containing valid JSON content of a classifier or state machine.
+   * @param[in] uuid The UUID of the file from the backend or a manually chosen UUID.
+   * @param[in] revision The file revision as delivered from the back-end.
+   * @return True in case the graph got parsed correctly, false in case an error happened.
+   */
+   NEUROMORE_EXPORT BOOL PreloadGraph(const char* jsonContent, const char* uuid, int revision);
+
    /*
    * Check if a classifier is present.
    * @return True in case a classifier was loaded, false if an error happened during loading OR if the engine is not initialized OR in case no classifier is declared as active
@@ -343,6 +355,14 @@ namespace neuromoreEngine
    */
    NEUROMORE_EXPORT double GetCurrentFeedbackValue(int index);
 
+   /**
+   * Get the current values of all feedback nodes at once. All values are taken from the same engine update and the call never blocks the engine thread.
+   * @param[out] outValues    Array that will be filled with the feedback values, in the order of the feedback indices.
+   * @param[in]  maxNumValues The size of the outValues array. Only that many values are copied.
+   * @return The number of feedbacks (can be larger than maxNumValues). 0 will be returned in case no classifier is active.
+   */
+   NEUROMORE_EXPORT int GetCurrentFeedbackValues(double* outValues, int maxNumValues);
+
    /**
    * Get the value range of a feedback
    * @param[in]  index		  The index of the custom feedback node from which we want to know the value range. The index has to be in range of [0, GetNumFeedbacks()].
@@ -94,6 +94,7 @@ public class Wrapper
     public static native int GetNumFeedbacks();
     public static native String GetFeedbackName(int index);
     public static native double GetCurrentFeedbackValue(int index);
+    public static native int GetCurrentFeedbackValues(double[] values);
     //public static native void GetFeedbackRange();
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
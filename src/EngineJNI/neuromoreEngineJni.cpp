@@ -610,6 +610,14 @@ extern "C"
       return neuromoreEngine::GetCurrentFeedbackValue(index);
    }
 
+   JNIEXPORT jint JNICALL Java_com_neuromore_engine_Wrapper_GetCurrentFeedbackValues(JNIEnv* env, jobject thiz, jdoubleArray values)
+   {
+      jdouble* elements = env->GetDoubleArrayElements(values, NULL);
+      const jint result = neuromoreEngine::GetCurrentFeedbackValues(elements, env->GetArrayLength(values));
+      env->ReleaseDoubleArrayElements(values, elements, 0);
+      return result;
+   }
+
    /*JNIEXPORT void JNICALL Java_com_neuromore_engine_Wrapper_GetFeedbackRange(JNIEnv* env, jobject thiz, jint index, jdoubleArray values)
    {
       env->doublearray
@@ -28,6 +28,7 @@ AttributeSetGridWidget::AttributeSetGridWidget(QWidget* parent) : QWidget(parent
 	connect(mPropertyManager, SIGNAL(PropertyAdded(const char*, Property*)), this, SLOT(OnPropertyAdded(const char*, Property*)));
 
 	// register event handler
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	// init
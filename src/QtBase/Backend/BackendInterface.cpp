@@ -16,6 +16,7 @@
 #include "LogsCreateRequest.h"
 #include "LogsCreateResponse.h"
 #include <QDateTime>
+#include <QThread>
 
 
 using namespace Core;
@@ -61,6 +62,12 @@ BackendInterface::~BackendInterface()
 // back-end log callback
 void BackendLogCallback::ForceLog(const char* text, Core::ELogLevel logLevel)
 {
+	if (QThread::currentThread() != thread())
+	{
+		QMetaObject::invokeMethod( this, "OnForceLog", Qt::QueuedConnection, Q_ARG(QString, QString(text)), Q_ARG(int, (int)logLevel) );
+		return;
+	}
+
 	// 1. construct /logs/create request
 	LogsCreateRequest request( GetUser()->GetToken(), text, logLevel );
 
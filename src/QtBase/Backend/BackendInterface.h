@@ -32,6 +32,10 @@ class QTBASE_API BackendLogCallback : public QObject, public Core::LogCallback
 
 		void ForceLog(const char* text, Core::ELogLevel logLevel);
 
+	private slots:
+		// requests can only be sent from the main thread, log messages of other threads get queued
+		void OnForceLog(QString text, int logLevel)									{ ForceLog( text.toUtf8().data(), (Core::ELogLevel)logLevel ); }
+
 	private:
 		NetworkAccessManager*	mNetworkAccessManager;
 };
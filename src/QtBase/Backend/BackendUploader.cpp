@@ -77,6 +77,9 @@ BackendUploader::BackendUploader(NetworkAccessManager* networkAccessManager, QOb
 	mCallback				= NULL;
 	mIsBusy					= false;
 	mIsEnabled				= true;
+	mMaxNumParallelUploads	= 4;
+	mIsCompressionEnabled	= false;
+	mIsCompressionAccepted	= true;
 }
 
 
@@ -110,33 +113,57 @@ void BackendUploader::StartUpload(const char* token)
 		return;
 
 	mIsBusy = true;
+	mSubProgress = 0.0f;
 	if (mCallback != NULL)
 		mCallback->OnStartUpload();
 
 	// start the upload process
-	UploadNextFile();
+	UploadNextFiles();
 }
 
 
 // callback for upload status updates
 void BackendUploader::OnUploadProgress(qint64 bytesSent, qint64 bytesTotal)
 {
-	mSubProgress = bytesSent / (float)bytesTotal;
+	QNetworkReply* networkReply = qobject_cast<QNetworkReply*>( sender() );
+	QueueEntry* entry = mQueue->FindEntryByReply( networkReply );
+	if (entry == NULL)
+		return;
+
+	entry->SetProgress( bytesSent, bytesTotal );
+
+	// combined progress of all running uploads
+	qint64 sumBytesSent = 0;
+	qint64 sumBytesTotal = 0;
+	const uint32 numEntries = mQueue->GetNumEntries();
+	for (uint32 i=0; i<numEntries; ++i)
+	{
+		QueueEntry* uploadingEntry = mQueue->GetEntry(i);
+		if (uploadingEntry->IsUploading() == false)
+			continue;
+
+		sumBytesSent  += uploadingEntry->GetBytesSent();
+		sumBytesTotal += uploadingEntry->GetBytesTotal();
+	}
+
+	if (sumBytesTotal > 0)
+		mSubProgress = sumBytesSent / (float)sumBytesTotal;
+
 	UpdateProgressCallback();
 }
 
 
 // helper function to calculate and set the progress value
-void BackendUploader::UpdateProgressValue(uint32 currentFileIndex, bool isProcessing)
+void BackendUploader::UpdateProgressValue(uint32 numFinishedFiles, bool isProcessing)
 {
 	const float uploadRange	= 1.0f - UPLOADER_PERCENTAGE_PROCESSING;
 	float finalPercentage	= 0.0f;
 
 	// uploading
-	const float uploadPercentage= (float)currentFileIndex / (float)mQueue->GetNumEntriesInitTime();
+	const float uploadPercentage= (float)numFinishedFiles / (float)mQueue->GetNumEntriesInitTime();
 	finalPercentage				= uploadPercentage * uploadRange;
 
-	mTempString.Format( "Processing biodata (%i/%i)", currentFileIndex, mQueue->GetNumEntriesInitTime() );
+	mTempString.Format( "Processing biodata (%i/%i)", numFinishedFiles, mQueue->GetNumEntriesInitTime() );
 
 	mProgressText	= mTempString.AsChar();
 	mProgress		= finalPercentage;
@@ -148,16 +175,30 @@ void BackendUploader::UpdateProgressValue(uint32 currentFileIndex, bool isProces
 // Uploading
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// upload the next file from the upload queue
-void BackendUploader::UploadNextFile()
+// start uploading the next files from the upload queue (up to the maximum number of parallel uploads)
+void BackendUploader::UploadNextFiles()
 {
-	// in case we are already uploading a file, skip directly
-	if (mQueue->IsUploading() == true)
-		return;
+	uint32 numUploading = mQueue->CalcNumUploadingEntries();
+	while (numUploading < mMaxNumParallelUploads)
+	{
+		// find the entry to be uploaded as next
+		QueueEntry* nextEntry = mQueue->FindNextUploadEntry();
+		if (nextEntry == NULL)
+			break;
 
-	// find the entry to be uploaded as next, return in case there is none
-	QueueEntry* nextEntry = mQueue->FindNextUploadEntry();
-	if (nextEntry == NULL)
+		// start uploading the next entry
+		if (UploadEntry(nextEntry) == false)
+		{
+			LogError( "Uploading '%s' failed. Removing it from queue.", nextEntry->GetAbsoluteFilePath() );
+			RemoveCorrespondingFiles( nextEntry );
+			continue;
+		}
+
+		numUploading++;
+	}
+
+	// all uploads are done (or gave up)
+	if (numUploading == 0)
 	{
 		emit UploadFinished();
 		
@@ -165,16 +206,6 @@ void BackendUploader::UploadNextFile()
 			mCallback->OnFinishedUpload();
 
 		mIsBusy = false;
-
-		return;
-	}
-
-	// start uploading the next entry
-	if (UploadEntry(nextEntry) == false)
-	{
-		LogError( "Uploading '%s' failed. Removing it from queue.", nextEntry->GetAbsoluteFilePath() );
-		RemoveCorrespondingFiles( nextEntry );
-		UploadNextFile();
 	}
 }
 
@@ -182,9 +213,8 @@ void BackendUploader::UploadNextFile()
 // start uploading a file
 bool BackendUploader::UploadEntry(QueueEntry* entry)
 {
-	// do not return false in case we're already uploading, only leave this assert here due to:
 	// in case we return false we remove the data chunk channel files from disk and go on with the next entry
-	CORE_ASSERT( mQueue->IsUploading() == false );
+	CORE_ASSERT( entry->IsUploading() == false );
 
 	// prepare entry for the upload process
 	if (entry->OnStartUpload() == false)
@@ -192,8 +222,7 @@ bool BackendUploader::UploadEntry(QueueEntry* entry)
 
 	// let the progress window know we're about to upload the next file
 	mSubProgressText	= entry->GetFilenameString();
-	mSubProgress		= 0.0f;
-	UpdateProgressValue( entry->GetIndex(), false );
+	UpdateProgressValue( mQueue->GetNumEntriesInitTime() - mQueue->GetNumEntries(), false );
 
 
 	String jsonFilename = entry->GetAbsoluteFilePathString();
@@ -247,8 +276,27 @@ bool BackendUploader::UploadEntry(QueueEntry* entry)
 	dispositionHeader.Format("form-data; name=\"content\"; filename=\"%s\"", entry->GetFilenameString().AsChar());
 	contentPart.setHeader(QNetworkRequest::ContentDispositionHeader, QVariant(dispositionHeader.AsChar()));
 	
+	// compress the file content in case the endpoint accepts it, keep the raw file if that doesn't save anything
+	entry->SetIsCompressed( false );
+	if (mIsCompressionEnabled == true && mIsCompressionAccepted == true)
+	{
+		const QByteArray data = entry->GetFile()->readAll();
+		QByteArray compressedData = qCompress( data, UPLOADER_COMPRESSION_LEVEL );
+		compressedData.remove( 0, 4 ); // qCompress prepends the uncompressed size, the rest is a zlib stream (HTTP "deflate")
+
+		if (compressedData.size() < data.size())
+		{
+			contentPart.setRawHeader( "Content-Encoding", "deflate" );
+			contentPart.setBody( compressedData );
+			entry->SetIsCompressed( true );
+		}
+		else
+			entry->GetFile()->seek( 0 );
+	}
+
 	// set the file as content body and parent it to the multi part object
-	contentPart.setBodyDevice( entry->GetFile() );
+	if (entry->IsCompressed() == false)
+		contentPart.setBodyDevice( entry->GetFile() );
 	entry->GetFile()->setParent(httpMultiPart); // we cannot delete the file now, so delete it with the multiPart
 	
 	// add the content part to the http multi part
@@ -258,10 +306,11 @@ bool BackendUploader::UploadEntry(QueueEntry* entry)
 	// post the http multi part
 	QNetworkReply* reply = mNetworkAccessManager->post_Deprecated( request, httpMultiPart, NULL );
 	httpMultiPart->setParent(reply); // delete the multiPart with the reply
+	entry->SetReply(reply);
 	connect(reply, SIGNAL(uploadProgress(qint64, qint64)), this, SLOT(OnUploadProgress(qint64, qint64)));
 	connect(reply, SIGNAL(finished()), this, SLOT(OnUploadFinished()));
 
-	LogInfo( " - Starting upload: File='%s', AttemptNr=%i", entry->GetFilenameString().AsChar(), entry->GetUploadAttemptNr() );
+	LogInfo( " - Starting upload: File='%s', AttemptNr=%i, Compressed=%i", entry->GetFilenameString().AsChar(), entry->GetUploadAttemptNr(), entry->IsCompressed() );
 
 	return true;
 }
@@ -273,6 +322,25 @@ void BackendUploader::OnUploadFinished()
 	QNetworkReply* networkReply = qobject_cast<QNetworkReply*>( sender() );
 	if (GetBackendInterface()->GetNetworkAccessManager()->IsLogEnabled() == true && CORE_LOGMANAGER.GetLogLevels() & LOGLEVEL_DETAILEDINFO)
 		LogDetailedInfo("REST REPLY: url=\"%s\"", FromQtString(BackendHelpers::ConvertToSecureUrl(networkReply->request().url()).toString()).AsChar());
+	// the endpoint doesn't accept compressed uploads: retry the file uncompressed and send all further files uncompressed as well
+	const int statusCode = networkReply->attribute( QNetworkRequest::HttpStatusCodeAttribute ).toInt();
+	if (statusCode == 415)
+	{
+		QueueEntry* rejectedEntry = mQueue->FindEntryByReply( networkReply );
+		if (rejectedEntry != NULL && rejectedEntry->IsCompressed() == true)
+		{
+			LogWarning( "Compressed upload of '%s' rejected by the server, uploading uncompressed.", rejectedEntry->GetFilename() );
+			mIsCompressionAccepted = false;
+
+			mNetworkAccessManager->NetworkReplyAftermath( networkReply );
+			rejectedEntry->OnUploadFinished( true );
+			rejectedEntry->RevokeUploadAttempt();
+
+			UploadNextFiles();
+			return;
+		}
+	}
+
 	QByteArray replyData = networkReply->readAll();
 	String replyDataString = FromQtString( QString(replyData) );
 	bool hasError = BackendHelpers::HasError( networkReply, replyDataString.AsChar(), BACKEND_RETURNCODE_UPLOADRECEIVED );
@@ -281,7 +349,12 @@ void BackendUploader::OnUploadFinished()
 		json.Parse( replyDataString.AsChar() );
 
 	// find the entry that got uploaded
-	QueueEntry* uploadEntry = mQueue->FindUploadingEntry();
+	QueueEntry* uploadEntry = mQueue->FindEntryByReply( networkReply );
+	if (uploadEntry == NULL)
+	{
+		mNetworkAccessManager->NetworkReplyAftermath( networkReply );
+		return;
+	}
 
 	if (hasError == false)
 	{
@@ -328,7 +401,7 @@ void BackendUploader::OnUploadFinished()
 
 	// go on with the next file, in case there is no next file it will automatically handle the next steps
 	if (cancelUpload == false)
-		UploadNextFile();
+		UploadNextFiles();
 }
 
 
@@ -401,7 +474,11 @@ BackendUploader::QueueEntry::QueueEntry(BackendUploader* uploader, const char* f
 	mIsUploading		= false;
 	mFinishedUpload		= false;
 	mUploadAttemptNr	= 0;
+	mIsCompressed		= false;
 	mFile				= NULL;
+	mReply				= NULL;
+	mBytesSent			= 0;
+	mBytesTotal			= 0;
 }
 
 
@@ -450,6 +527,7 @@ bool BackendUploader::QueueEntry::OnUploadFinished(bool error)
 	mFile->close();
 	mFile->deleteLater();
 	mFile = NULL;
+	mReply = NULL;
 
 	// disable the uploading flag and enable the upload finished flag
 	mIsUploading	= false;
@@ -599,6 +677,39 @@ BackendUploader::QueueEntry* BackendUploader::Queue::FindUploadingEntry() const
 }
 
 
+// find the entry that is uploaded by the given request
+BackendUploader::QueueEntry* BackendUploader::Queue::FindEntryByReply(QNetworkReply* reply) const
+{
+	if (reply == NULL)
+		return NULL;
+
+	const uint32 numEntries = mEntries.Size();
+	for (uint32 i=0; i<numEntries; ++i)
+	{
+		if (mEntries[i]->GetReply() == reply)
+			return mEntries[i];
+	}
+
+	return NULL;
+}
+
+
+// number of entries that are currently being uploaded
+uint32 BackendUploader::Queue::CalcNumUploadingEntries() const
+{
+	uint32 result = 0;
+
+	const uint32 numEntries = mEntries.Size();
+	for (uint32 i=0; i<numEntries; ++i)
+	{
+		if (mEntries[i]->IsUploading() == true)
+			result++;
+	}
+
+	return result;
+}
+
+
 // get the file that is next in the queue
 BackendUploader::QueueEntry* BackendUploader::Queue::FindNextUploadEntry()
 {
@@ -17,6 +17,7 @@
 
 
 #define UPLOADER_PERCENTAGE_PROCESSING		0.10f
+#define UPLOADER_COMPRESSION_LEVEL			6
 
 // PHASE 1: PROCESSING			= Uploading
 // PHASE 2: POST PROCESSING		= Check if upload worked and file is on S3 server
@@ -37,6 +38,16 @@ class QTBASE_API BackendUploader : public QObject
 
 		bool IsBusy() const							{ return mIsBusy; }
 
+		// number of files that get uploaded at the same time
+		void SetMaxNumParallelUploads(uint32 num)	{ mMaxNumParallelUploads = Core::Max<uint32>(num, 1); }
+		uint32 GetMaxNumParallelUploads() const		{ return mMaxNumParallelUploads; }
+
+		// compress the files before uploading them (zlib, sent with "Content-Encoding: deflate"); in case the endpoint rejects them with
+		// HTTP 415 (unsupported media type), the uploader retries the file uncompressed and doesn't compress any further uploads
+		// TODO: resume interrupted uploads from the last acknowledged offset, this needs a chunked upload endpoint on the backend side
+		void SetCompressionEnabled(bool isEnabled)	{ mIsCompressionEnabled = isEnabled; }
+		bool IsCompressionEnabled() const			{ return mIsCompressionEnabled; }
+
 		class Callback
 		{
 			public:
@@ -80,6 +91,20 @@ class QTBASE_API BackendUploader : public QObject
 				inline const Core::String& GetAbsoluteFilePathString() const	{ return mFullFilePath; }
 				inline QFile* GetFile() const									{ return mFile; }
 
+				// the running upload sends the compressed file
+				inline void SetIsCompressed(bool isCompressed)					{ mIsCompressed = isCompressed; }
+				inline bool IsCompressed() const								{ return mIsCompressed; }
+
+				// the upload got rejected for a reason that wasn't the file's fault, don't count it as an attempt
+				inline void RevokeUploadAttempt()								{ if (mUploadAttemptNr > 0) mUploadAttemptNr--; }
+
+				// the running upload request and its progress
+				inline void SetReply(QNetworkReply* reply)						{ mReply = reply; mBytesSent = 0; mBytesTotal = 0; }
+				inline QNetworkReply* GetReply() const							{ return mReply; }
+				inline void SetProgress(qint64 bytesSent, qint64 bytesTotal)	{ mBytesSent = bytesSent; mBytesTotal = bytesTotal; }
+				inline qint64 GetBytesSent() const								{ return mBytesSent; }
+				inline qint64 GetBytesTotal() const								{ return mBytesTotal; }
+
 			private:
 				BackendUploader*	mUploader;
 				Core::String		mFullFilePath;
@@ -90,9 +115,13 @@ class QTBASE_API BackendUploader : public QObject
 				bool				mIsUploading;
 				bool				mFinishedUpload;
 				uint32				mUploadAttemptNr;
+				bool				mIsCompressed;
 
 				// data
 				QFile*				mFile;
+				QNetworkReply*		mReply;
+				qint64				mBytesSent;
+				qint64				mBytesTotal;
 		};
 
 		class Queue
@@ -115,7 +144,9 @@ class QTBASE_API BackendUploader : public QObject
 				void AddFiles(const char* folderPath, const char* extensionFilter); // example: extensionFilter="*.json"
 
 				QueueEntry* FindUploadingEntry() const;
+				QueueEntry* FindEntryByReply(QNetworkReply* reply) const;
 				QueueEntry* FindNextUploadEntry();
+				uint32 CalcNumUploadingEntries() const;
 
 				inline bool IsUploading() const											{ return (FindUploadingEntry() != NULL); }
 
@@ -127,12 +158,12 @@ class QTBASE_API BackendUploader : public QObject
 		};
 
 		// progress window
-		void UpdateProgressValue(uint32 currentFileIndex, bool isProcessing);
+		void UpdateProgressValue(uint32 numFinishedFiles, bool isProcessing);
 		void UpdateProgressCallback()											{ if (mCallback != NULL) mCallback->OnUploadProgress(mProgressText.AsChar(), mSubProgressText.AsChar(), mProgress, mSubProgress); }
 
 		// upload helpers
 		bool UploadEntry(QueueEntry* entry);
-		void UploadNextFile();
+		void UploadNextFiles();
 
 		// timer event
 		void timerEvent(QTimerEvent* event);
@@ -144,6 +175,9 @@ class QTBASE_API BackendUploader : public QObject
 		Core::String				mTempString;
 		bool						mIsBusy;
 		bool						mIsEnabled;
+		uint32						mMaxNumParallelUploads;
+		bool						mIsCompressionEnabled;
+		bool						mIsCompressionAccepted;			// false after the endpoint rejected a compressed upload
 
 		// queue
 		Queue*						mQueue;
@@ -15,6 +15,8 @@
 #include <QScreen>
 #include <QPushButton>
 #include <QMessageBox>
+#include <QAbstractEventDispatcher>
+#include <QThread>
 #include "PluginSystem/PluginManager.h"
 /*#include "AES.h"
 #include <QFile>
@@ -55,6 +57,11 @@ MainWindowBase::MainWindowBase(QWidget* parent, Qt::WindowFlags flags) : QMainWi
 	file.close();
 	*/
 	mEngineTimer			= NULL;
+	mEngineTimerEnabled		= false;
+	mEngineThread			= NULL;
+	mEngineThreadHandler	= NULL;
+	mEngineThreadEnabled	= false;
+	mHasEngineLock			= false;
 	mRealtimeUITimer		= NULL;
 	mInterfaceTimer			= NULL;
 	mShowFPS				= false;
@@ -69,6 +76,7 @@ MainWindowBase::MainWindowBase(QWidget* parent, Qt::WindowFlags flags) : QMainWi
 // destructor
 MainWindowBase::~MainWindowBase()
 {
+	SetEngineThreadEnabled(false);
 	mEngineTimer->stop();
 	mRealtimeUITimer->stop();
 	mInterfaceTimer->stop();
@@ -118,6 +126,18 @@ void MainWindowBase::Init()
 
 void MainWindowBase::SetEngineTimerEnabled(bool isEnabled)
 {
+	mEngineTimerEnabled = isEnabled;
+
+	// threaded mode: the engine thread replaces the timer
+	if (mEngineThreadEnabled == true)
+	{
+		if (isEnabled == true)
+			StartEngineThread();
+		else
+			StopEngineThread();
+		return;
+	}
+
 	if (isEnabled == true)
 	{
 		mEngineTimer->setTimerType( Qt::PreciseTimer );
@@ -166,6 +186,149 @@ void MainWindowBase::SetEngineUpdateRate(double updateFPS)
 
 	if (mEngineTimer != NULL)
 		mEngineTimer->setInterval(1000.0 / updateFPS);
+
+	if (mEngineThreadHandler != NULL)
+		mEngineThreadHandler->SetDesiredFps(updateFPS);
+}
+
+
+// switch between updating the engine from the engine timer and from the engine thread
+void MainWindowBase::SetEngineThreadEnabled(bool isEnabled)
+{
+	if (mEngineThreadEnabled == isEnabled)
+		return;
+
+	const bool isRunning = mEngineTimerEnabled;
+	if (isRunning == true)
+		SetEngineTimerEnabled(false);
+
+	QAbstractEventDispatcher* dispatcher = QAbstractEventDispatcher::instance();
+	if (isEnabled == true)
+	{
+		// we are processing an event right now, so take the lock right away
+		AcquireEngineLock();
+		connect( dispatcher, SIGNAL(awake()), this, SLOT(OnEventLoopAwake()), Qt::DirectConnection );
+		connect( dispatcher, SIGNAL(aboutToBlock()), this, SLOT(OnEventLoopAboutToBlock()), Qt::DirectConnection );
+	}
+	else
+	{
+		if (dispatcher != NULL)
+			disconnect( dispatcher, NULL, this, NULL );
+		ReleaseEngineLock();
+	}
+
+	mEngineThreadEnabled = isEnabled;
+
+	if (isRunning == true)
+		SetEngineTimerEnabled(true);
+}
+
+
+void MainWindowBase::StartEngineThread()
+{
+	if (mEngineThread != NULL)
+		return;
+
+	// the thread deletes the handler
+	mEngineThreadHandler = new EngineThreadHandler(mEngineUpdateRate);
+	mEngineThread = new Thread(mEngineThreadHandler, "neuromore Engine Thread");
+	mEngineThread->Start();
+}
+
+
+void MainWindowBase::StopEngineThread()
+{
+	if (mEngineThread == NULL)
+		return;
+
+	// no more updates on behalf of the engine thread (see OnEventLoopAboutToBlock())
+	mEngineTimer->stop();
+
+	// the engine thread can only finish its last update if we don't hold the lock
+	const bool hadLock = mHasEngineLock;
+	ReleaseEngineLock();
+
+	mEngineThread->Stop();
+	delete mEngineThread;
+	mEngineThread = NULL;
+	mEngineThreadHandler = NULL;
+
+	if (hadLock == true)
+		AcquireEngineLock();
+}
+
+
+void MainWindowBase::AcquireEngineLock()
+{
+	if (mHasEngineLock == true)
+		return;
+
+	GetEngine()->Lock();
+	mHasEngineLock = true;
+}
+
+
+void MainWindowBase::ReleaseEngineLock()
+{
+	if (mHasEngineLock == false)
+		return;
+
+	mHasEngineLock = false;
+	GetEngine()->Unlock();
+}
+
+
+// the main thread starts processing events: lock the engine and deliver the events the engine thread raised in the meantime
+void MainWindowBase::OnEventLoopAwake()
+{
+	AcquireEngineLock();
+	CORE_EVENTMANAGER.ProcessDeferredEvents();
+}
+
+
+// the main thread waits for new events: let the engine thread run freely
+void MainWindowBase::OnEventLoopAboutToBlock()
+{
+	// a nested event loop (modal dialog, menu, drag) runs inside the handler of another event, which must not run concurrently with the engine thread:
+	// keep the lock and update the engine from the engine timer on this thread, like without the engine thread, until we are back in the main event loop
+	if (QThread::currentThread()->loopLevel() > 1)
+	{
+		if (mEngineThread != NULL && mEngineTimer->isActive() == false)
+		{
+			mEngineTimer->setTimerType( Qt::PreciseTimer );
+			mEngineTimer->start(1000 / mEngineUpdateRate);
+		}
+		return;
+	}
+
+	mEngineTimer->stop();
+	ReleaseEngineLock();
+}
+
+
+void MainWindowBase::ReleaseEngineLockWhileComposing(QOpenGLWidget* widget)
+{
+	// direct connections: the signals are emitted right before and after composing, from within the paint event of the window
+	const Qt::ConnectionType type = (Qt::ConnectionType)(Qt::DirectConnection | Qt::UniqueConnection);
+	connect( widget, SIGNAL(aboutToCompose()), this, SLOT(OnAboutToCompose()), type );
+	connect( widget, SIGNAL(frameSwapped()), this, SLOT(OnFrameSwapped()), type );
+}
+
+
+// the window is about to compose its OpenGL widgets: composing and swapping don't touch the engine, let the engine thread run meanwhile
+void MainWindowBase::OnAboutToCompose()
+{
+	// nested event loops keep the lock (see OnEventLoopAboutToBlock())
+	if (mEngineThreadEnabled == true && QThread::currentThread()->loopLevel() <= 1)
+		ReleaseEngineLock();
+}
+
+
+// the buffers got swapped, the window continues handling its paint event
+void MainWindowBase::OnFrameSwapped()
+{
+	if (mEngineThreadEnabled == true)
+		AcquireEngineLock();
 }
 
 
@@ -217,6 +380,14 @@ void MainWindowBase::OnUpdateInterface()
 // engine update
 void MainWindowBase::OnEngineUpdate()
 {
+	// threaded mode: a nested event loop keeps the engine lock, update the engine in place of the engine thread
+	if (mEngineThreadEnabled == true)
+	{
+		if (mEngineThreadHandler != NULL && mHasEngineLock == true)
+			mEngineThreadHandler->UpdateLocked();
+		return;
+	}
+
 	if (GetQtBaseManager()->IsInterfacePaused() == true)
 	{
 #ifdef CORE_DEBUG
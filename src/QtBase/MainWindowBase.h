@@ -12,8 +12,11 @@
 #include <QObject>
 #include <QTimer>
 #include <QMainWindow>
+#include <QOpenGLWidget>
 #include <Core/Timer.h>
 #include <Core/FpsCounter.h>
+#include <Core/Thread.h>
+#include <EngineThreadHandler.h>
 
 
 class QTBASE_API MainWindowBase : public QMainWindow
@@ -49,16 +52,41 @@ class QTBASE_API MainWindowBase : public QMainWindow
 		double GetRealtimeUIUpdateRate() const									{ return mRealtimeUIUpdateRate; }
 		double GetInterfaceUpdateRate() const									{ return mInterfaceUpdateRate; }
 
+		// update the engine on its own thread instead of the engine timer
+		// the main thread holds the engine lock while it processes events and releases it while it waits for new ones (only in the main event loop,
+		// nested event loops keep the lock and update the engine from the engine timer); OpenGL widgets release it while the window is composed
+		void SetEngineThreadEnabled(bool isEnabled);
+		bool IsEngineThreadEnabled() const										{ return mEngineThreadEnabled; }
+
+		// temporarily release the engine lock (e.g. while rendering from channel snapshots); only call these from the main thread
+		void ReleaseEngineLock();
+		void AcquireEngineLock();
+
+		// release the engine lock while the window composes the given OpenGL widget and swaps its buffers (may wait for the vertical sync); call from initializeGL()
+		void ReleaseEngineLockWhileComposing(QOpenGLWidget* widget);
+
 	protected slots:
 		void OnEngineUpdate();
 		void OnRealtimeUIUpdate();
 		void OnUpdateInterface();
 		void UpdateRealtimePlugins(double timeDelta);
+		void OnEventLoopAwake();
+		void OnEventLoopAboutToBlock();
+		void OnAboutToCompose();
+		void OnFrameSwapped();
 
 	private:
 		QTimer*							mEngineTimer;
 		double							mEngineUpdateRate;
 		Core::Timer						mEngineUpdateTimer;
+		bool							mEngineTimerEnabled;
+
+		void StartEngineThread();
+		void StopEngineThread();
+		Core::Thread*					mEngineThread;
+		EngineThreadHandler*			mEngineThreadHandler;
+		bool							mEngineThreadEnabled;
+		bool							mHasEngineLock;
 
 		QTimer*							mRealtimeUITimer;
 		double							mRealtimeUIUpdateRate;
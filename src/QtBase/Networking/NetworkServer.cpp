@@ -115,6 +115,7 @@ void NetworkServer::Init()
 
 	// register with event manager
 	mEventHandler = new ClientEventHandler(this);
+	mEventHandler->SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(mEventHandler);
 
 	// create the sending socket
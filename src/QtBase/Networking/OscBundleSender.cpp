@@ -0,0 +1,161 @@
+/*
+ * Qt Base
+ * Copyright (c) 2012-2016 neuromore Inc.
+ * All Rights Reserved.
+ */
+
+// include precompiled header
+#include <QtBase/Precompiled.h>
+
+// include required headers
+#include "OscBundleSender.h"
+#include <QUdpSocket>
+
+#ifdef NEUROMORE_PLATFORM_LINUX
+	#include <sys/socket.h>
+	#include <netinet/in.h>
+	#include <arpa/inet.h>
+#endif
+
+
+using namespace Core;
+
+// constructor
+OscBundleSender::OscBundleSender(OscBundleQueue* queue, const QHostAddress& remoteHost, uint32 remotePort) : ThreadHandler()
+{
+	mQueue					= queue;
+	mRemoteHost				= remoteHost;
+	mRemotePort				= remotePort;
+	mBreak					= false;
+	mNumPacketsTransmitted	= 0;
+	mNumBytesTransmitted	= 0;
+}
+
+
+// destructor
+OscBundleSender::~OscBundleSender()
+{
+}
+
+
+// start thread execution
+void OscBundleSender::Execute()
+{
+	mIsFinished = false;
+
+	// the socket has to live on this thread; bind it so it has a native descriptor for vectored sends
+	QUdpSocket* socket = new QUdpSocket();
+	socket->bind(QHostAddress(mRemoteHost.protocol() == QAbstractSocket::IPv6Protocol ? QHostAddress::AnyIPv6 : QHostAddress::AnyIPv4), 0);
+
+	std::vector<char>	data;
+	std::vector<uint32>	sizes;
+	while (mBreak == false)
+	{
+		// wait for the next engine update to flush its bundles
+		if (mQueue->WaitForDatagrams(data, sizes, 100) == false)
+			continue;
+
+		Send(socket, data, sizes);
+	}
+
+	delete socket;
+	mIsFinished = true;
+}
+
+
+// stop and terminate thread
+void OscBundleSender::Terminate()
+{
+	mBreak = true;
+	mQueue->Interrupt();
+}
+
+
+// send all datagrams to the remote host
+void OscBundleSender::Send(QUdpSocket* socket, const std::vector<char>& data, const std::vector<uint32>& sizes)
+{
+	if (SendVectored(socket, data, sizes) == true)
+		return;
+
+	// one system call per datagram
+	const char* datagram = data.data();
+	const size_t numDatagrams = sizes.size();
+	for (size_t i=0; i<numDatagrams; ++i)
+	{
+		const qint64 bytesSent = socket->writeDatagram(datagram, sizes[i], mRemoteHost, mRemotePort);
+		if (bytesSent > 0)
+		{
+			mNumPacketsTransmitted++;
+			mNumBytesTransmitted += (uint32)bytesSent;
+		}
+
+		datagram += sizes[i];
+	}
+}
+
+
+// send all datagrams with as few system calls as possible; returns false if not supported
+bool OscBundleSender::SendVectored(QUdpSocket* socket, const std::vector<char>& data, const std::vector<uint32>& sizes)
+{
+#ifdef NEUROMORE_PLATFORM_LINUX
+	bool isIPv4 = false;
+	const quint32 ipv4 = mRemoteHost.toIPv4Address(&isIPv4);
+	const qintptr descriptor = socket->socketDescriptor();
+	if (isIPv4 == false || descriptor < 0 || mRemoteHost.protocol() != QAbstractSocket::IPv4Protocol)
+		return false;
+
+	sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family		= AF_INET;
+	address.sin_port		= htons((uint16)mRemotePort);
+	address.sin_addr.s_addr	= htonl(ipv4);
+
+	const uint32 maxBatchSize = 64;
+	mmsghdr messages[maxBatchSize];
+	iovec vectors[maxBatchSize];
+
+	const char* datagram = data.data();
+	const uint32 numDatagrams = (uint32)sizes.size();
+	uint32 numSent = 0;
+	while (numSent < numDatagrams)
+	{
+		const uint32 batchSize = Min(numDatagrams - numSent, maxBatchSize);
+
+		const char* batchDatagram = datagram;
+		for (uint32 i=0; i<batchSize; ++i)
+		{
+			vectors[i].iov_base = (void*)batchDatagram;
+			vectors[i].iov_len = sizes[numSent + i];
+
+			memset(&messages[i], 0, sizeof(mmsghdr));
+			messages[i].msg_hdr.msg_name	= &address;
+			messages[i].msg_hdr.msg_namelen	= sizeof(address);
+			messages[i].msg_hdr.msg_iov		= &vectors[i];
+			messages[i].msg_hdr.msg_iovlen	= 1;
+
+			batchDatagram += sizes[numSent + i];
+		}
+
+		const int result = sendmmsg((int)descriptor, messages, batchSize, 0);
+
+		// nothing was sent (e.g. socket buffer full): drop the batch like a lost UDP packet would be
+		const uint32 numBatchSent = (result > 0 ? (uint32)result : batchSize);
+		for (uint32 i=0; i<numBatchSent; ++i)
+		{
+			if (result > 0)
+			{
+				mNumPacketsTransmitted++;
+				mNumBytesTransmitted += messages[i].msg_len;
+			}
+
+			datagram += sizes[numSent + i];
+		}
+
+		numSent += numBatchSent;
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
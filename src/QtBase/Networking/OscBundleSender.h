@@ -0,0 +1,57 @@
+/*
+ * Qt Base
+ * Copyright (c) 2012-2016 neuromore Inc.
+ * All Rights Reserved.
+ */
+
+#ifndef __NEUROMORE_OSCBUNDLESENDER_H
+#define __NEUROMORE_OSCBUNDLESENDER_H
+
+// include required headers
+#include "../QtBaseConfig.h"
+#include <Config.h>
+#include <Core/ThreadHandler.h>
+#include <Networking/OscBundleQueue.h>
+#include <QHostAddress>
+#include <vector>
+#include <atomic>
+
+// forward declaration
+class QUdpSocket;
+
+
+// sends the OSC bundles of the engine (see OscBundleQueue) to the remote host on its own thread (run it using a Core::Thread)
+// all datagrams that are available at once are sent with a single system call where the platform supports it (sendmmsg on Linux)
+class QTBASE_API OscBundleSender : public Core::ThreadHandler
+{
+	public:
+		// constructor & destructor
+		OscBundleSender(OscBundleQueue* queue, const QHostAddress& remoteHost, uint32 remotePort);
+		virtual ~OscBundleSender();
+
+		// start thread execution
+		void Execute() override;
+
+		// stop and terminate thread
+		void Terminate() override;
+
+		// statistics
+		uint32 GetNumPacketsTransmitted() const					{ return mNumPacketsTransmitted; }
+		uint32 GetNumBytesTransmitted() const					{ return mNumBytesTransmitted; }
+
+	private:
+		void Send(QUdpSocket* socket, const std::vector<char>& data, const std::vector<uint32>& sizes);
+		bool SendVectored(QUdpSocket* socket, const std::vector<char>& data, const std::vector<uint32>& sizes);
+
+		OscBundleQueue*			mQueue;
+		QHostAddress			mRemoteHost;
+		uint32					mRemotePort;
+		std::atomic<bool>		mBreak;
+
+		// statistics
+		std::atomic<uint32>		mNumPacketsTransmitted;
+		std::atomic<uint32>		mNumBytesTransmitted;
+};
+
+
+#endif
@@ -24,6 +24,9 @@ OscServer::OscServer(uint32 listenPort, uint32 sendingPort)
 	LogDetailedInfo("Constructing OSC server ...");
 	mUdpSocket	= NULL;
 	mUdpOutSocket	= NULL;
+	mTimer = NULL;
+	mBundleThread = NULL;
+	mBundleSender = NULL;
 	mUdpPort = listenPort;
 	mRemoteHost = QHostAddress::LocalHost;
 	mLocalEndpoint = QHostAddress::Null;
@@ -64,8 +67,14 @@ void OscServer::Reset()
 	{
 		mTimer->stop();
 		mTimer->deleteLater();
+		mTimer = NULL;
 	}
 
+	// stop the bundle sender (deletes the sender)
+	delete mBundleThread;
+	mBundleThread = NULL;
+	mBundleSender = NULL;
+
 	// zero statistics
 	mNumPacketsReceived = 0;
 	mNumPacketsTransmitted = 0;
@@ -98,6 +107,11 @@ void OscServer::Init()
 	mTimer->setTimerType(Qt::PreciseTimer);
 	mTimer->start(1000 /FPS);
 	connect(mTimer, SIGNAL(timeout()), this, SLOT(OnRealtimeUpdate()));
+
+	// send the bundled outputs from a network thread, as soon as the engine has flushed them
+	mBundleSender = new OscBundleSender(GetOscMessageRouter()->GetOutputBundleQueue(), mRemoteHost, mRemoteUdpPort);
+	mBundleThread = new Thread(mBundleSender, "OSC Bundle Sender");
+	mBundleThread->Start();
 }
 
 
@@ -12,10 +12,12 @@
 #include <Config.h>
 #include <Core/String.h>
 #include <Core/Mutex.h>
+#include <Core/Thread.h>
 #include <Networking/OscMessageQueue.h>
 #include <Networking/OscPacket.h>
 #include <Networking/OscPacketPool.h>
 #include <Networking/OscPacketParser.h>
+#include "OscBundleSender.h"
 
 #include <QUdpSocket>
 #include <QTimer>
@@ -56,9 +58,9 @@ class QTBASE_API OscServer : public QObject
 		// osc statistics
 		uint32 GetNumPooledPacketsUsed() const			{ return mPacketPool.GetNumUsedPackets(); }
 		uint32 GetNumPooledPacketsFree() const			{ return mPacketPool.GetNumFreePackets(); }
-		uint32 GetNumPacketsTransmitted() const			{ return mNumPacketsTransmitted; }
+		uint32 GetNumPacketsTransmitted() const			{ return mNumPacketsTransmitted + (mBundleSender != NULL ? mBundleSender->GetNumPacketsTransmitted() : 0); }
 		uint32 GetNumPacketsReceived() const			{ return mNumPacketsReceived; }
-		uint32 GetNumBytesTransmitted() const			{ return mNumBytesTransmitted; }
+		uint32 GetNumBytesTransmitted() const			{ return mNumBytesTransmitted + (mBundleSender != NULL ? mBundleSender->GetNumBytesTransmitted() : 0); }
 		uint32 GetNumBytesReceived() const				{ return mNumBytesReceived; }
 		
 		
@@ -84,6 +86,10 @@ class QTBASE_API OscServer : public QObject
 
 		QTimer*					mTimer;
 
+		// sends the bundled outputs of the engine on its own thread
+		Core::Thread*			mBundleThread;
+		OscBundleSender*		mBundleSender;					// owned by the thread
+
 		// Statistics
 		uint32					mNumPacketsTransmitted;
 		uint32					mNumPacketsReceived;
@@ -40,6 +40,7 @@ WebsocketServer::WebsocketServer(uint16 port, bool debug, QObject* parent) :
    mJsonBuf(),
    mJsonWriter(mJsonBuf)
 {
+   SetIsMainThreadOnly();
    CORE_EVENTMANAGER.AddEventHandler(this);
 
    // configure timer
@@ -36,6 +36,7 @@ ProgressWindowManager::ProgressWindowManager()
 	connect( mProgressHandler, SIGNAL(SubProgressText(Core::String)), this, SLOT(OnSubProgressText(Core::String)) );
 	connect( mProgressHandler, SIGNAL(SubProgressValue(float)), this, SLOT(OnSubProgressValue(float)) );
 	
+	mProgressHandler->SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(mProgressHandler);
 }
 
@@ -85,6 +85,9 @@ AppManager::AppManager(int argc, char* argv[])
 	if (QDir().mkpath(QFileInfo(logFilename.AsChar()).absolutePath()))
 		CORE_LOGMANAGER.CreateLogFile( logFilename.AsChar() );
 
+	// format log messages on the calling thread only, file and widget output happens on the log thread
+	CORE_LOGMANAGER.SetAsyncEnabled(true);
+
 	// log header
 	LogInfo();
 	LogDetailedInfo("Log file '%s' created ...", logFilename.AsChar());
@@ -366,6 +369,9 @@ void AppInitializer::Shutdown()
 {
 	LogInfo("Shutting down application ...");
 
+	// write out the queued log messages while all log callbacks are still alive
+	CORE_LOGMANAGER.SetAsyncEnabled(false);
+
 	delete gAppManager;
 	gAppManager = NULL;
 }
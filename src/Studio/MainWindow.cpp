@@ -101,6 +101,7 @@ MainWindow::MainWindow(QWidget* parent, Qt::WindowFlags flags) : MainWindowBase(
 	mSettingsAction				= NULL;
 
 	LogDetailedInfo("Adding main window event handler ...");
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	// setup some properties
@@ -1290,6 +1291,7 @@ void MainWindow::OnSettings()
 
 		// performance
 		mEngineUpdateRateProperty = generalPropertyWidget->GetPropertyManager()->AddFloatSpinnerProperty("Performance", "Engine Update Rate (Hz)", GetEngineUpdateRate(), GetEngineUpdateRate(), FLT_MIN, FLT_MAX);
+		mEngineThreadProperty = generalPropertyWidget->GetPropertyManager()->AddBoolProperty("Performance", "Engine Thread", IsEngineThreadEnabled(), false);
 		mInterfaceUpdateRateProperty = generalPropertyWidget->GetPropertyManager()->AddFloatSpinnerProperty("Performance", "Interface Update Rate (Hz)", GetInterfaceUpdateRate(), GetInterfaceUpdateRate(), FLT_MIN, FLT_MAX);
 		mRealtimeInterfaceUpdateRateProperty = generalPropertyWidget->GetPropertyManager()->AddFloatSpinnerProperty("Performance", "Realtime Interface Update Rate (Hz)", GetRealtimeUIUpdateRate(), GetRealtimeUIUpdateRate(), FLT_MIN, FLT_MAX);
 	
@@ -1454,6 +1456,8 @@ void MainWindow::OnValueChanged(Property* property)
 	// performance
 	if (property == mEngineUpdateRateProperty)
 		SetEngineUpdateRate(property->AsFloat());
+	if (property == mEngineThreadProperty)
+		SetEngineThreadEnabled(property->AsBool());
 	if (property == mInterfaceUpdateRateProperty)
 		SetInterfaceUpdateRate(property->AsFloat());
 	if (property == mRealtimeInterfaceUpdateRateProperty)
@@ -1652,6 +1656,8 @@ void MainWindow::OnLoadSettings()
 	// performance
 	const float engineUpdateRate = settings.value("engineUpdateRate", GetEngineUpdateRate()).toFloat();
 	SetEngineUpdateRate(engineUpdateRate);
+	const bool engineThreadEnabled = settings.value("engineThreadEnabled", IsEngineThreadEnabled()).toBool();
+	SetEngineThreadEnabled(engineThreadEnabled);
 	const float interfaceUpdateRate = settings.value("interfaceUpdateRate", GetInterfaceUpdateRate()).toFloat();
 	SetInterfaceUpdateRate(interfaceUpdateRate);
 	const float realtimeInterfaceUpdateRate = settings.value("realtimeInterfaceUpdateRate", GetRealtimeUIUpdateRate()).toFloat();
@@ -1769,6 +1775,7 @@ void MainWindow::OnSaveSettings()
 	
 	// performance
 	settings.setValue("engineUpdateRate", GetEngineUpdateRate());
+	settings.setValue("engineThreadEnabled", IsEngineThreadEnabled());
 	settings.setValue("interfaceUpdateRate", GetInterfaceUpdateRate());
 	settings.setValue("realtimeInterfaceUpdateRate", GetRealtimeUIUpdateRate());
 
@@ -118,6 +118,7 @@ class MainWindow : public MainWindowBase, public Core::EventHandler
 
 		// performance
 		Property*					mEngineUpdateRateProperty;
+		Property*					mEngineThreadProperty;
 		Property*					mRealtimeInterfaceUpdateRateProperty;
 		Property*					mInterfaceUpdateRateProperty;
 
@@ -58,6 +58,7 @@ bool BackendFileSystemPlugin::Init()
 
 	// attach to event system
 	LogDebug("Attaching backend file system plugin to event system ...");
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	LogDetailedInfo("Backend file system plugin successfully initialized");
@@ -44,6 +44,7 @@ LoretaPlugin::LoretaPlugin() : Plugin(GetStaticTypeUuid())
 	mLoretaThreadHandler = new LoretaThreadHandler(mLoretaWidget);
 	mThread = new Thread(mLoretaThreadHandler, "LoretaThread");
 
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 }
 
@@ -57,7 +57,8 @@ class EngineStatusPlugin : public Plugin
 		void UpdateInterface() override;
 
 		// log one line to the console textedit (used by log callback)
-		void LogLine( const char* text )												{ if (mLogOutput != NULL) mLogOutput->append( text ); }
+		// thread safe (log messages of the engine thread get queued)
+		void LogLine( const char* text )												{ if (mLogOutput != NULL) QMetaObject::invokeMethod( mLogOutput, "append", Qt::AutoConnection, Q_ARG(QString, QString(text)) ); }
 
 	private slots:
 		void OnTimerTimeout();
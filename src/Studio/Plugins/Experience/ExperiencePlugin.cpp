@@ -49,6 +49,7 @@ bool ExperiencePlugin::Init()
 {
 	LogDetailedInfo("Initializing experience plugin ...");
 
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	QWidget*		mainWidget		= NULL;
@@ -80,6 +80,7 @@ ExperienceWidget::ExperienceWidget(QWidget* parent) :
 
 	setLayout( mMainLayout );
 
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	// create gif animation timer
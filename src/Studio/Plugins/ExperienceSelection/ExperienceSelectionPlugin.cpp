@@ -58,6 +58,7 @@ bool ExperienceSelectionPlugin::Init()
 
 	// attach to event system
 	LogDebug("Attaching Experience selection pluginplugin to event system ...");
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	LogDetailedInfo("Experience selection plugin successfully initialized");
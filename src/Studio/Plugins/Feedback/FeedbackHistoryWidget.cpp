@@ -37,6 +37,8 @@ FeedbackHistoryWidget::FeedbackHistoryWidget(FeedbackPlugin* plugin, QWidget* pa
 	SetCallback( mRenderCallback );
 
 	mLeftTextWidth		= 0.0;
+	mHasClassifier		= false;
+	mElapsedTime		= 0.0;
 	mPlugin				= plugin;
 	mEmptyText			= "No active feedback";
 
@@ -62,26 +64,64 @@ Classifier* FeedbackHistoryWidget::GetClassifier() const
 }
 
 
-// render frame
-void FeedbackHistoryWidget::paintGL()
+// collect the feedback nodes and their output channels (the engine is locked while we process events)
+void FeedbackHistoryWidget::UpdateSnapshots()
 {
-	uint32 numCustomFeedbackNodes = 0;
+	mFeedbacks.Clear(false);
+	mSnapshots.Begin();
+
+	mElapsedTime = GetEngine()->GetElapsedTime().InSeconds();
+
 	Classifier* classifier = GetClassifier();
+	mHasClassifier = (classifier != NULL);
 	if (classifier != NULL)
 	{
-		double maxTextWidth = 0.0;
+		const double timeRange = mPlugin->GetTimeRange();
 
-		numCustomFeedbackNodes = classifier->GetNumCustomFeedbackNodes();
+		const uint32 numCustomFeedbackNodes = classifier->GetNumCustomFeedbackNodes();
 		for (uint32 i=0; i<numCustomFeedbackNodes; ++i)
 		{
 			CustomFeedbackNode* feedbackNode = classifier->GetCustomFeedbackNode(i);
 
+			Feedback feedback;
+			feedback.mRangeMin	= feedbackNode->GetRangeMin();
+			feedback.mRangeMax	= feedbackNode->GetRangeMax();
+			feedback.mColor		= feedbackNode->GetColor();
+			feedback.mName		= feedbackNode->GetName();
+			mFeedbacks.Add(feedback);
+
+			mSnapshots.Add( feedbackNode->GetOutputChannel(0), timeRange );
+		}
+	}
+
+	mSnapshots.End();
+}
+
+
+// render frame
+void FeedbackHistoryWidget::paintGL()
+{
+	// copy the displayed channels while the engine is locked, then render without holding the lock so the engine thread can continue
+	// (without the engine thread the engine runs on this thread and there is no lock to release)
+	UpdateSnapshots();
+	MainWindowBase* mainWindow = GetQtBaseManager()->GetMainWindow();
+	const bool releaseLock = mainWindow->IsEngineThreadEnabled();
+	if (releaseLock == true)
+		mainWindow->ReleaseEngineLock();
+
+	const uint32 numCustomFeedbackNodes = mFeedbacks.Size();
+	if (mHasClassifier == true)
+	{
+		double maxTextWidth = 0.0;
+
+		for (uint32 i=0; i<numCustomFeedbackNodes; ++i)
+		{
 			// calc range min text width
-			mTempString.Format( "%.2f", feedbackNode->GetRangeMin() );
+			mTempString.Format( "%.2f", mFeedbacks[i].mRangeMin );
 			maxTextWidth = Max<double>( maxTextWidth, mRenderCallback->CalcTextWidth(mTempString.AsChar()) );
 
 			// calc range max text width
-			mTempString.Format( "%.2f", feedbackNode->GetRangeMax() );
+			mTempString.Format( "%.2f", mFeedbacks[i].mRangeMax );
 			maxTextWidth = Max<double>( maxTextWidth, mRenderCallback->CalcTextWidth(mTempString.AsChar()) );
 		}
 
@@ -104,26 +144,26 @@ void FeedbackHistoryWidget::paintGL()
 	painter.setRenderHint(QPainter::HighQualityAntialiasing);
 
 	// pre rendering
-	if (PreRendering() == false)
-		return;
+	if (PreRendering() == true)
+	{
+		RenderSplitViews( numCustomFeedbackNodes );
 
-	RenderSplitViews( numCustomFeedbackNodes );
+		// post rendering
+		PostRendering();
+	}
 
-	// post rendering
-	PostRendering();
+	if (releaseLock == true)
+		mainWindow->AcquireEngineLock();
 }
 
 
 void FeedbackHistoryWidget::RenderCallback::Render(uint32 index, bool isHighlighted, double x, double y, double width, double height)
 {
-	Classifier* classifier = mFeedbackWidget->GetClassifier();
-
-	// feedback info
-	CustomFeedbackNode* feedbackNode	= classifier->GetCustomFeedbackNode(index);
-	//const bool			isRanged		= feedbackNode->IsRanged();
-	const double		rangeMin		= feedbackNode->GetRangeMin();
-	const double		rangeMax		= feedbackNode->GetRangeMax();
-	Channel<double>*	channel			= feedbackNode->GetOutputChannel(0);
+	// feedback info (rendered from the snapshots, the engine is not locked here)
+	const Feedback&		feedback		= mFeedbackWidget->mFeedbacks[index];
+	const double		rangeMin		= feedback.mRangeMin;
+	const double		rangeMax		= feedback.mRangeMax;
+	Channel<double>*	channel			= mFeedbackWidget->mSnapshots.Get(index)->Acquire();
 
 	// base class render
 	OpenGLWidgetCallback::Render( index, isHighlighted, x, y, width, height );
@@ -135,7 +175,7 @@ void FeedbackHistoryWidget::RenderCallback::Render(uint32 index, bool isHighligh
 	QColor feedbackNameColor= mFeedbackWidget->mFeedbackNameColor;
 	QColor backgroundColor	= mFeedbackWidget->mBackgroundColor;
 	QColor areaBgColor		= mFeedbackWidget->mAreaBgColor;
-	QColor feedbackColor	= ToQColor( feedbackNode->GetColor() );
+	QColor feedbackColor	= ToQColor( feedback.mColor );
 //	feedbackColor.setAlpha( 175 );
 
 	if (isHighlighted == true)
@@ -211,8 +251,7 @@ void FeedbackHistoryWidget::RenderCallback::Render(uint32 index, bool isHighligh
 	}
 
 	// render feedback name
-	mTempString.Format("%s", feedbackNode->GetName());
-	RenderText( mTempString.AsChar(), mParent->GetDefaultFontSize(), feedbackNameColor, areaStartX+textMarginX, 0, OpenGLWidget::ALIGN_TOP | OpenGLWidget::ALIGN_LEFT );
+	RenderText( feedback.mName.AsChar(), mParent->GetDefaultFontSize(), feedbackNameColor, areaStartX+textMarginX, 0, OpenGLWidget::ALIGN_TOP | OpenGLWidget::ALIGN_LEFT );
 }
 
 
@@ -225,8 +264,8 @@ void FeedbackHistoryWidget::RenderCallback::RenderTimeline(double x, double y, d
 	AddRect( 0, 0, width, height, FromQtColor(QColor(40,40,40)) );
 	RenderRects();
 
-	Classifier* classifier = mFeedbackWidget->GetClassifier();
-	if (classifier == NULL)
+	// the engine is not locked here
+	if (mFeedbackWidget->mHasClassifier == false)
 		return;
 	
 	// automatically calculated, do not change these
@@ -235,9 +274,9 @@ void FeedbackHistoryWidget::RenderCallback::RenderTimeline(double x, double y, d
 
 	QColor color = QColor(255,255,255);
 	const double timeRange = mFeedbackWidget->GetPlugin()->GetTimeRange();
-	const double maxTime = GetEngine()->GetElapsedTime().InSeconds();
+	const double maxTime = mFeedbackWidget->mElapsedTime;
 	
-	if (classifier->GetNumCustomFeedbackNodes() > 0)
+	if (mFeedbackWidget->mFeedbacks.Size() > 0)
 	{
 		OpenGLWidget2DHelpers::RenderTimeline( this, FromQtColor(color), timeRange, maxTime, areaStartX, y, areaWidth, height, mTempString );
 	}
@@ -27,6 +27,7 @@
 // include required headers
 #include "../../Config.h"
 #include <DSP/Channel.h>
+#include <DSP/ChannelSnapshot.h>
 #include <Graph/Classifier.h>
 #include "../../Rendering/OpenGLWidget.h"
 
@@ -61,6 +62,23 @@ class FeedbackHistoryWidget : public OpenGLWidget
 
 		friend class RenderCallback;
 
+		// copy what gets rendered while the engine is locked, so rendering doesn't have to lock the engine (see ChannelSnapshot)
+		void UpdateSnapshots();
+
+		// one per custom feedback node
+		struct Feedback
+		{
+			double			mRangeMin;
+			double			mRangeMax;
+			Core::Color		mColor;
+			Core::String	mName;
+		};
+
+		Core::Array<Feedback>	mFeedbacks;
+		ChannelSnapshotSet		mSnapshots;			// output channel of each feedback node
+		bool					mHasClassifier;
+		double					mElapsedTime;
+
 		FeedbackPlugin*		mPlugin;
 		RenderCallback*		mRenderCallback;
 		double				mLeftTextWidth;
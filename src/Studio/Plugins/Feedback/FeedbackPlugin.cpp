@@ -94,6 +94,7 @@ bool FeedbackPlugin::Init()
 
 	vWidget->show();
 	
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	LogDetailedInfo("Feedback plugin successfully initialized");
@@ -35,6 +35,7 @@ GraphInfoWidget::GraphInfoWidget(QWidget* parent, Classifier* classifier) : QWid
 	mClassifier = classifier;
 	
 	// register event handler
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	Init();
@@ -241,6 +241,7 @@ bool GraphPlugin::Init()
 
 	// attach to event system
 	LogDebug("Attaching graph widget to event system ...");
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	// show the active classifier
@@ -35,6 +35,9 @@ using namespace Core;
 GraphRenderer::GraphRenderer(GraphShared* shared)
 {
 	mShared = shared;
+	mNodeCacheIndicesGraph	= NULL;
+	mIsSpatialIndexValid	= false;
+	mNodeCacheScaling		= 0.0f;
 
 	// initialize the pixmap text rendering cache
 	mPixmapTextCache = new GraphTextPixmapCache(mShared);
@@ -97,12 +100,16 @@ void GraphRenderer::RenderNodes(Graph* graph, QPainter& painter, const GraphHelp
 	if (graph == NULL)
 		return;
 
+	// only visit the nodes inside the visible area (sorted by node index, so the drawing order stays the same)
+	UpdateSpatialIndex(graph);
+	mNodeSpatialIndex.Find( CalcVisibleGraphRect(visibleRect), mTempNodeIndices );
+
 	// render all annotation first (so they are on the bottom layer)
 	// TODO in the future we can replace this with correct Z sorting
-	const uint32 numNodes = graph->GetNumNodes();
-	for (uint32 i = 0; i < numNodes; ++i)
+	const uint32 numVisibleNodes = mTempNodeIndices.Size();
+	for (uint32 i = 0; i < numVisibleNodes; ++i)
 	{
-		Node* node = graph->GetNode(i);
+		Node* node = graph->GetNode( mTempNodeIndices[i] );
 		if (node->GetType() != AnnotationNode::TYPE_ID)
 			continue;
 
@@ -112,9 +119,9 @@ void GraphRenderer::RenderNodes(Graph* graph, QPainter& painter, const GraphHelp
 
 
 	// now draw all nodes that are not annotation nodes
-	for (uint32 i=0; i<numNodes; ++i)
+	for (uint32 i=0; i<numVisibleNodes; ++i)
 	{
-		Node* node = graph->GetNode(i);
+		Node* node = graph->GetNode( mTempNodeIndices[i] );
 		if (node->GetType() == AnnotationNode::TYPE_ID)
 			continue;
 
@@ -129,6 +136,7 @@ void GraphRenderer::RenderNode(Graph* graph, Node* node, QPainter& painter, cons
 	const float solidOpacity		 = 1.0f;
 	const float halfTransOpacity	 = 0.60f;
 	const float inactiveTransOpacity = 0.2f;
+	const float lowDetailScale		 = 0.3f;
 
 	const bool isSelected  = mShared->IsNodeSelected(node);
 	
@@ -194,7 +202,19 @@ void GraphRenderer::RenderNode(Graph* graph, Node* node, QPainter& painter, cons
 		bgColor		= borderColor;
 	}
 #endif
-	
+
+	// zoomed out far: text and ports are unreadable anyway, only draw the node body
+	if (mShared->GetScale() < lowDetailScale)
+	{
+		QPen borderPen = QPen(borderColor);
+		borderPen.setWidth(borderWidth);
+		painter.setPen(borderPen);
+		painter.setBrush(bgColor);
+		painter.setOpacity(halfTransOpacity);
+		painter.drawRect(rect);
+		painter.setOpacity(solidOpacity);
+		return;
+	}
 	
 
 	QColor bgColor2;
@@ -853,12 +873,17 @@ void GraphRenderer::RenderConnections(Graph* graph, QPainter& painter, const Gra
 	QPen connectionPen;
 	QBrush connectionBrush;
 	
-	// get the number of connections and iterate through them
-	const uint32 numConnections = graph->GetNumConnections();
-	for (uint32 i=0; i<numConnections; ++i)
+	// only visit the connections inside the visible area
+	UpdateSpatialIndex(graph);
+	mConnectionSpatialIndex.Find( CalcVisibleGraphRect(visibleRect), mTempConnectionIndices );
+
+	// iterate through the visible connections
+	const uint32 numVisibleConnections = mTempConnectionIndices.Size();
+	for (uint32 i=0; i<numVisibleConnections; ++i)
 	{
 		// get the connection
-		Connection* connection = graph->GetConnection(i);
+		const uint32 connectionIndex = mTempConnectionIndices[i];
+		Connection* connection = graph->GetConnection(connectionIndex);
 		
 		const bool isSelected = mShared->IsConnectionSelected(connection);
 		const bool isProcessed= true;
@@ -872,8 +897,8 @@ void GraphRenderer::RenderConnections(Graph* graph, QPainter& painter, const Gra
 				isHighlighted = true;
 		}
 
-		// in case the connection is not highlighted yet, check if we are over it with the mouse
-		if (isHighlighted == false && IsCloseToConnection(graph, globalMousePos, connection) == true)
+		// in case the connection is not highlighted yet, check if we are over it with the mouse (cheap bounds test first)
+		if (isHighlighted == false && mConnectionSpatialIndex.GetRect(connectionIndex).contains(globalMousePos) == true && IsCloseToConnection(graph, globalMousePos, connection) == true)
 			isHighlighted = true;
 
 		// render the connection
@@ -1164,6 +1189,9 @@ void GraphRenderer::ResetNodeCaches(Graph* graph)
 	const uint32 numNodes = graph->GetNumNodes();
 	for (uint32 i=0; i<numNodes; ++i)
 		mNodeCaches[i].Reset();
+
+	// the spatial index is built from the node rects, so it has to be rebuilt as well
+	mIsSpatialIndexValid = false;
 }
 
 
@@ -1177,14 +1205,239 @@ void GraphRenderer::UpdateNodeCaches(Graph* graph)
 	// make sure the array sizes are all correct
 	// get the number of nodes in the graph and make sure we have enough node caches
 	const uint32 numNodes = graph->GetNumNodes();
-	if (mNodeCaches.Size() != numNodes)
+	if (mNodeCaches.Size() != numNodes || mNodeCacheIndicesGraph != graph)
 	{
 		mNodeCaches.Resize(numNodes);
 
 		// reset all node caches
 		for (uint32 i=0; i<numNodes; ++i)
 			mNodeCaches[i].Reset();
+
+		// nodes got added or removed, forget the node indices
+		mNodeCacheIndices.clear();
+		mNodeCacheIndicesGraph	= graph;
+		mIsSpatialIndexValid	= false;
+	}
+}
+
+
+// count the visible ports and hash their names
+void GraphRenderer::NodeCache::CalcPortLayout(Node* node, uint32* outNumVisibleInputPorts, uint32* outNumVisibleOutputPorts, uint32* outPortNamesHash)
+{
+	uint32 hash = String::CalcHash("");
+
+	*outNumVisibleInputPorts = 0;
+	const uint32 numInputPorts = node->GetNumInputPorts();
+	for (uint32 i=0; i<numInputPorts; ++i)
+	{
+		const Port& port = node->GetInputPort(i);
+		if (port.IsVisible() == false)
+			continue;
+
+		(*outNumVisibleInputPorts)++;
+		hash = (hash ^ String::CalcHash(port.GetName())) * 16777619u;
+	}
+
+	*outNumVisibleOutputPorts = 0;
+	const uint32 numOutputPorts = node->GetNumOutputPorts();
+	for (uint32 i=0; i<numOutputPorts; ++i)
+	{
+		const Port& port = node->GetOutputPort(i);
+		if (port.IsVisible() == false)
+			continue;
+
+		(*outNumVisibleOutputPorts)++;
+		hash = (hash ^ String::CalcHash(port.GetName())) * 16777619u;
 	}
+
+	*outPortNamesHash = hash;
+}
+
+
+// remember the node state the cached rect is based on
+void GraphRenderer::NodeCache::SetLayout(Node* node)
+{
+	mPosX					= node->GetVisualPosX();
+	mPosY					= node->GetVisualPosY();
+	mCollapsedState			= node->GetCollapsedState();
+	mName					= node->GetName();
+
+	CalcPortLayout( node, &mNumVisibleInputPorts, &mNumVisibleOutputPorts, &mPortNamesHash );
+
+	// the size of annotations is set by the user
+	if (node->GetType() == AnnotationNode::TYPE_ID)
+	{
+		AnnotationNode* annotationNode = static_cast<AnnotationNode*>(node);
+		mNumVisibleInputPorts	= annotationNode->GetNodeWidth();
+		mNumVisibleOutputPorts	= annotationNode->GetNodeHeight();
+	}
+}
+
+
+// check if the node changed in a way that affects its rect
+bool GraphRenderer::NodeCache::HasLayoutChanged(Node* node) const
+{
+	if (mPosX != node->GetVisualPosX() || mPosY != node->GetVisualPosY() || mCollapsedState != (uint32)node->GetCollapsedState())
+		return true;
+
+	if (node->GetType() == AnnotationNode::TYPE_ID)
+	{
+		AnnotationNode* annotationNode = static_cast<AnnotationNode*>(node);
+		if (mNumVisibleInputPorts != (uint32)annotationNode->GetNodeWidth() || mNumVisibleOutputPorts != (uint32)annotationNode->GetNodeHeight())
+			return true;
+	}
+	else
+	{
+		// the port names define the node width (see CalcRequiredNodeWidth())
+		uint32 numVisibleInputPorts, numVisibleOutputPorts, portNamesHash;
+		CalcPortLayout( node, &numVisibleInputPorts, &numVisibleOutputPorts, &portNamesHash );
+
+		if (mNumVisibleInputPorts != numVisibleInputPorts || mNumVisibleOutputPorts != numVisibleOutputPorts || mPortNamesHash != portNamesHash)
+			return true;
+	}
+
+	return (mName.IsEqual(node->GetName()) == false);
+}
+
+
+// recalculate the caches of the changed nodes and update the spatial index incrementally
+void GraphRenderer::ValidateNodeCaches(Graph* graph)
+{
+	// if there is no valid graph, return directly
+	if (graph == NULL)
+		return;
+
+	// make sure the array sizes are all correct
+	UpdateNodeCaches(graph);
+
+	// nodes got replaced or the scaling changed: all rects have to be recalculated
+	const uint32 numNodes = graph->GetNumNodes();
+	bool nodesChanged = (mIndexedNodes.Size() != numNodes || mNodeCacheScaling != mShared->GetScreenScaling());
+	for (uint32 i=0; i<numNodes && nodesChanged == false; ++i)
+		nodesChanged = (mIndexedNodes[i] != graph->GetNode(i));
+
+	if (nodesChanged == true)
+	{
+		mIndexedNodes.Resize(numNodes);
+		for (uint32 i=0; i<numNodes; ++i)
+			mIndexedNodes[i] = graph->GetNode(i);
+
+		mNodeCacheScaling = mShared->GetScreenScaling();
+		ResetNodeCaches(graph);
+	}
+
+	// connections got added, removed or relinked: rebuild the connection part as well
+	const uint32 numConnections = graph->GetNumConnections();
+	bool connectionsChanged = (mIndexedConnections.Size() != numConnections);
+	for (uint32 i=0; i<numConnections && connectionsChanged == false; ++i)
+		connectionsChanged = (mIndexedConnections[i] != graph->GetConnection(i));
+
+	if (connectionsChanged == true)
+	{
+		mIndexedConnections.Resize(numConnections);
+		for (uint32 i=0; i<numConnections; ++i)
+			mIndexedConnections[i] = graph->GetConnection(i);
+
+		mIsSpatialIndexValid = false;
+	}
+
+	// only reset the caches of the nodes that moved or changed their layout
+	mIsNodeChanged.Resize(numNodes);
+	bool anyNodeChanged = false;
+	for (uint32 i=0; i<numNodes; ++i)
+	{
+		mIsNodeChanged[i] = (mNodeCaches[i].IsValid() == true && mNodeCaches[i].HasLayoutChanged(graph->GetNode(i)) == true);
+		if (mIsNodeChanged[i] == true)
+		{
+			mNodeCaches[i].Reset();
+			anyNodeChanged = true;
+		}
+	}
+
+	// the index gets rebuilt anyway
+	if (anyNodeChanged == false || mIsSpatialIndexValid == false)
+		return;
+
+	// update the rects of the changed nodes and of their connections
+	for (uint32 i=0; i<numNodes; ++i)
+		if (mIsNodeChanged[i] == true)
+			mNodeSpatialIndex.Update( i, CalcNodeRect(graph, graph->GetNode(i)) );
+
+	for (uint32 i=0; i<numConnections; ++i)
+	{
+		Connection* connection = graph->GetConnection(i);
+		const uint32 sourceIndex = FindNodeCacheIndex(graph, connection->GetSourceNode());
+		const uint32 targetIndex = FindNodeCacheIndex(graph, connection->GetTargetNode());
+		if ((sourceIndex < numNodes && mIsNodeChanged[sourceIndex] == true) || (targetIndex < numNodes && mIsNodeChanged[targetIndex] == true))
+			mConnectionSpatialIndex.Update( i, CalcConnectionBounds(graph, connection) );
+	}
+}
+
+
+// find the node cache index for the given node
+uint32 GraphRenderer::FindNodeCacheIndex(Graph* graph, Node* node)
+{
+	// use the remembered index if the node is still at that position
+	auto it = mNodeCacheIndices.find(node);
+	if (it != mNodeCacheIndices.end() && it->second < graph->GetNumNodes() && graph->GetNode(it->second) == node)
+		return it->second;
+
+	// fallback: search the node and remember its index
+	const uint32 nodeIndex = graph->FindNodeIndex(node);
+	mNodeCacheIndices[node] = nodeIndex;
+	return nodeIndex;
+}
+
+
+// rebuild the node and connection spatial index in case it is outdated
+void GraphRenderer::UpdateSpatialIndex(Graph* graph)
+{
+	// if there is no valid graph, return directly
+	if (graph == NULL)
+		return;
+
+	// make sure the array sizes are all correct
+	UpdateNodeCaches(graph);
+
+	const uint32 numNodes		= graph->GetNumNodes();
+	const uint32 numConnections	= graph->GetNumConnections();
+	if (mIsSpatialIndexValid == true && mNodeSpatialIndex.GetNumItems() == numNodes && mConnectionSpatialIndex.GetNumItems() == numConnections)
+		return;
+
+	// nodes
+	mNodeSpatialIndex.Clear();
+	for (uint32 i=0; i<numNodes; ++i)
+		mNodeSpatialIndex.Add( CalcNodeRect(graph, graph->GetNode(i)) );
+	mNodeSpatialIndex.Build();
+
+	// connections
+	mConnectionSpatialIndex.Clear();
+	for (uint32 i=0; i<numConnections; ++i)
+		mConnectionSpatialIndex.Add( CalcConnectionBounds(graph, graph->GetConnection(i)) );
+	mConnectionSpatialIndex.Build();
+
+	mIsSpatialIndexValid = true;
+}
+
+
+// calculate the area covered by the connection curve including the hit test tolerance
+QRect GraphRenderer::CalcConnectionBounds(Graph* graph, Connection* connection)
+{
+	const QRect rect = CalcConnectionRect(graph, connection);
+
+	// the bezier tangents bulge out horizontally by half the connection width in case the target is left of the source
+	const int32 bulge	= rect.width() / 2;
+	const int32 margin	= 8.0 * mShared->GetScreenScaling();
+
+	return rect.adjusted(-bulge - margin, -margin, bulge + margin, margin);
+}
+
+
+// map the visible widget area into graph space
+QRect GraphRenderer::CalcVisibleGraphRect(const QRect& visibleRect) const
+{
+	// add a few pixels so nothing at the border gets culled due to rounding
+	return mShared->GetTransform().inverted().mapRect( visibleRect.adjusted(-2, -2, 2, 2) );
 }
 
 
@@ -1195,7 +1448,7 @@ QRect GraphRenderer::CalcNodeRect(Graph* graph, Node* node, int32* outMaxInputWi
 	UpdateNodeCaches(graph);
 
 	// find the node index and check for a valid node cache
-	const uint32 nodeIndex = graph->FindNodeIndex(node);
+	const uint32 nodeIndex = FindNodeCacheIndex(graph, node);
 	if (mNodeCaches[nodeIndex].IsValid() == true)
 	{
 		if (outMaxInputWidth != NULL)	*outMaxInputWidth = mNodeCaches[nodeIndex].mMaxInputWidth;
@@ -1233,6 +1486,7 @@ QRect GraphRenderer::CalcNodeRect(Graph* graph, Node* node, int32* outMaxInputWi
 	mNodeCaches[nodeIndex].mMaxInputWidth	= maxInputWidth;
 	mNodeCaches[nodeIndex].mMaxOutputWidth	= maxOutputWidth;
 	mNodeCaches[nodeIndex].mIsValid = true;
+	mNodeCaches[nodeIndex].SetLayout(node);
 
 	return rect;
 }
@@ -1737,6 +1991,30 @@ bool GraphRenderer::IsPointOnNode(Graph* graph, Node* node, const QPoint& global
 }
 
 
+// find the node under the given point
+Node* GraphRenderer::FindNode(Graph* graph, const QPoint& globalPoint)
+{
+	// if there is no valid graph, return directly
+	if (graph == NULL)
+		return NULL;
+
+	// only test the nodes whose rect contains the point
+	UpdateSpatialIndex(graph);
+	mNodeSpatialIndex.Find( globalPoint, mTempNodeIndices );
+
+	const uint32 numCandidates = mTempNodeIndices.Size();
+	for (uint32 i=0; i<numCandidates; ++i)
+	{
+		Node* node = graph->GetNode( mTempNodeIndices[i] );
+		if (IsPointOnNode(graph, node, globalPoint) == true)
+			return node;
+	}
+
+	// not found
+	return NULL;
+}
+
+
 // find the port at a given location within a given node
 Port* GraphRenderer::FindPort(Graph* graph, Node* node, int32 x, int32 y, uint32* outPortNr, bool* outIsInputPort, bool includeInputPorts)
 {
@@ -1797,12 +2075,16 @@ Port* GraphRenderer::FindPort(Graph* graph, int32 x, int32 y, Node** outNode, ui
 	if (graph == NULL)
 		return NULL;
 
-	// get the number of nodes in the graph and iterate through them
-	const uint32 numNodes = graph->GetNumNodes();
-	for (uint32 n=0; n<numNodes; ++n)
+	// only test the nodes close to the point (the port interaction rects stick out of the node rect)
+	UpdateSpatialIndex(graph);
+	const int32 portMargin = mShared->GetPortDiameter() * mShared->GetScreenScaling() + 2;
+	mNodeSpatialIndex.Find( QRect(x - portMargin, y - portMargin, 2 * portMargin + 1, 2 * portMargin + 1), mTempNodeIndices );
+
+	const uint32 numCandidates = mTempNodeIndices.Size();
+	for (uint32 n=0; n<numCandidates; ++n)
 	{
 		// get a pointer to the graph node
-		Node* graphNode = graph->GetNode(n);
+		Node* graphNode = graph->GetNode( mTempNodeIndices[n] );
 
 		// skip the node in case it is collapsed
 		if (graphNode->GetCollapsedState() == Node::COLLAPSE_ALL)
@@ -1829,12 +2111,15 @@ Connection* GraphRenderer::FindConnection(Graph* graph, const QPoint& mousePos)
 	if (graph == NULL)
 		return NULL;
 
-	// get the number of connections and iterate through them
-	const uint32 numCons = graph->GetNumConnections();
-	for (uint32 i=0; i<numCons; ++i)
+	// only test the connections whose bounds contain the mouse position
+	UpdateSpatialIndex(graph);
+	mConnectionSpatialIndex.Find( mousePos, mTempConnectionIndices );
+
+	const uint32 numCandidates = mTempConnectionIndices.Size();
+	for (uint32 i=0; i<numCandidates; ++i)
 	{
 		// get the connection
-		Connection* connection = graph->GetConnection(i);
+		Connection* connection = graph->GetConnection( mTempConnectionIndices[i] );
 		
 		// return it if if mouse is close
 		if (IsCloseToConnection(graph, mousePos, connection) == true)
@@ -1859,14 +2144,18 @@ void GraphRenderer::SelectNodesAndConnectionsInRect(Graph* graph, const QRect& s
 	if (graph == NULL)
 		return;
 
+	// NOTE: only the nodes and connections near the selection rect have to be visited, in overwrite mode all others got unselected above already
+	UpdateSpatialIndex(graph);
+
 	// 1) select nodes
 
-	// get the number of nodes and iterate through them
-	const uint32 numNodes = graph->GetNumNodes();
+	// get the nodes intersecting the selection rect and iterate through them
+	mNodeSpatialIndex.Find( selectionRect, mTempNodeIndices );
+	const uint32 numNodes = mTempNodeIndices.Size();
 	for (uint32 i=0; i<numNodes; ++i)
 	{
 		// get the current node and calculate its rect
-		Node*	node		= graph->GetNode(i);
+		Node*	node		= graph->GetNode( mTempNodeIndices[i] );
 		QRect	nodeRect	= CalcNodeRect( graph, node );
 
 		// check if the node rect is inside the selection rect, if yes select the node
@@ -1887,12 +2176,13 @@ void GraphRenderer::SelectNodesAndConnectionsInRect(Graph* graph, const QRect& s
 
 	// 2) select connections
 	
-	// get the number of connections and iterate through them
-	const uint32 numCons = graph->GetNumConnections();
+	// get the connections whose bounds intersect the selection rect and iterate through them
+	mConnectionSpatialIndex.Find( selectionRect, mTempConnectionIndices );
+	const uint32 numCons = mTempConnectionIndices.Size();
 	for (uint32 i=0; i<numCons; ++i)
 	{
 		// get the connection
-		Connection* connection = graph->GetConnection(i);
+		Connection* connection = graph->GetConnection( mTempConnectionIndices[i] );
 		
 		// calc connection path
 		mPainterPath = QPainterPath();
@@ -36,8 +36,10 @@
 #include <QFont>
 #include <QFontMetrics>
 #include "GraphTextPixmapCache.h"
+#include "GraphSpatialIndex.h"
 #include <PainterStaticTextCache.h>
 #include <Graph/AnnotationNode.h>
+#include <unordered_map>
 
 
 class GraphRenderer
@@ -65,6 +67,7 @@ class GraphRenderer
 		virtual bool IsCloseToConnection(Graph* graph, const QPoint& point, Connection* connection);
 
 		virtual bool IsPointOnNode(Graph* graph, Node* node, const QPoint& globalPoint);
+		virtual Node* FindNode(Graph* graph, const QPoint& globalPoint);
 
 		// TODO: not a good place here
 		virtual void SelectNodesAndConnectionsInRect(Graph* graph, const QRect& selectionRect, bool overwriteCurSelection, bool select, bool toggleMode);
@@ -93,14 +96,35 @@ class GraphRenderer
 			int32						mMaxOutputWidth;
 			bool						mIsValid;
 
+			// the node state the rect was calculated from, the cache is only recalculated after one of them changed
+			int32						mPosX;
+			int32						mPosY;
+			uint32						mNumVisibleInputPorts;
+			uint32						mNumVisibleOutputPorts;
+			uint32						mPortNamesHash;			// hash of the names of the visible ports (they define the node width)
+			uint32						mCollapsedState;
+			Core::String				mName;
+
 			NodeCache()					{ Reset(); }
 			inline void Reset()			{ mIsValid = false; }
 			inline bool IsValid() const	{ return mIsValid; }
+
+			void SetLayout(Node* node);
+			bool HasLayoutChanged(Node* node) const;
+
+			static void CalcPortLayout(Node* node, uint32* outNumVisibleInputPorts, uint32* outNumVisibleOutputPorts, uint32* outPortNamesHash);
 		};
 
 		void ResetNodeCaches(Graph* graph);
 		void UpdateNodeCaches(Graph* graph);
 
+		// recalculate the caches of the nodes that got moved or changed their name or ports, and update their rects in the spatial index (call once per frame)
+		void ValidateNodeCaches(Graph* graph);
+
+		// spatial index over the node and connection rects, rebuilt lazily after the node caches got reset
+		void UpdateSpatialIndex(Graph* graph);
+		void InvalidateSpatialIndex()															{ mIsSpatialIndexValid = false; }
+
 		const QPixmap& FindNodeIcon(Node* node, uint32 pixmapSize);
 
 		GraphTextPixmapCache* GetPixmapTextCache()								{ return mPixmapTextCache; }
@@ -112,6 +136,8 @@ class GraphRenderer
 		QPainterPath				mPainterPath;
 		Core::Array<NodeCache>		mNodeCaches;
 
+		uint32 FindNodeCacheIndex(Graph* graph, Node* node);
+
 	private:
 		void RenderConnection(Graph* graph, Connection* connection, bool isWidgetEnabled, QPainter& painter, QPen& pen, QBrush& brush, const QRect& visibleRect, float opacity, bool isSelected, bool isHighlighted, bool isProcessed);
 		void RenderNode(Graph* graph, Node* node, QPainter& painter, const GraphHelpers::CreateConnectionInfo& createConnectionInfo, bool isWidgetEnabled, const QRect& visibleRect, const QPoint& mousePos);
@@ -136,6 +162,9 @@ class GraphRenderer
 		
 		QRect CalcInfoAreaRect(Node* node, uint32 targetPort, const QRect& nodeRect);
 
+		QRect CalcConnectionBounds(Graph* graph, Connection* connection);
+		QRect CalcVisibleGraphRect(const QRect& visibleRect) const;
+
 		struct NodeIconCache
 		{
 			NodeIconCache(QPixmap pixmap, uint32 nodeType);
@@ -148,6 +177,20 @@ class GraphRenderer
 
 		GraphTextPixmapCache*			mPixmapTextCache;
 		PainterStaticTextCache			mTextRenderingCache;
+
+		// node pointer to node cache index lookup (avoids the linear node search for every rect request)
+		std::unordered_map<Node*, uint32>	mNodeCacheIndices;
+		Graph*							mNodeCacheIndicesGraph;
+
+		GraphSpatialIndex				mNodeSpatialIndex;
+		GraphSpatialIndex				mConnectionSpatialIndex;
+		bool							mIsSpatialIndexValid;
+		Core::Array<Node*>				mIndexedNodes;			// the nodes and connections the caches and the spatial index were built for
+		Core::Array<Connection*>		mIndexedConnections;
+		float							mNodeCacheScaling;		// screen scaling the node caches were calculated with
+		Core::Array<bool>				mIsNodeChanged;
+		Core::Array<uint32>				mTempNodeIndices;
+		Core::Array<uint32>				mTempConnectionIndices;
 };
 
 
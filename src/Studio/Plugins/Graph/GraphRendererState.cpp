@@ -646,7 +646,7 @@ QRect GraphRendererState::CalcNodeRect(Graph* graph, Node* node, int32* outMaxIn
 	UpdateNodeCaches(graph);
 
 	// find the node index and check for a valid node cache
-	const uint32 nodeIndex = graph->FindNodeIndex(node);
+	const uint32 nodeIndex = FindNodeCacheIndex(graph, node);
 	if (mNodeCaches[nodeIndex].IsValid() == true)
 	{
 		if (outMaxInputWidth != NULL)	*outMaxInputWidth = mNodeCaches[nodeIndex].mMaxInputWidth;
@@ -670,6 +670,7 @@ QRect GraphRendererState::CalcNodeRect(Graph* graph, Node* node, int32* outMaxIn
 	mNodeCaches[nodeIndex].mMaxInputWidth	= maxInputWidth;
 	mNodeCaches[nodeIndex].mMaxOutputWidth	= maxOutputWidth;
 	mNodeCaches[nodeIndex].mIsValid = true;
+	mNodeCaches[nodeIndex].SetLayout(node);
 
 	return rect;
 }
@@ -891,6 +892,27 @@ bool GraphRendererState::IsPointOnNode(Graph* graph, Node* node, const QPoint& g
 }
 
 
+// find the node under the given point
+Node* GraphRendererState::FindNode(Graph* graph, const QPoint& globalPoint)
+{
+	// if there is no valid graph, return directly
+	if (graph == NULL)
+		return NULL;
+
+	// states are circles, test them all directly (state machines only have few states)
+	const uint32 numNodes = graph->GetNumNodes();
+	for (uint32 i=0; i<numNodes; ++i)
+	{
+		Node* node = graph->GetNode(i);
+		if (IsPointOnNode(graph, node, globalPoint) == true)
+			return node;
+	}
+
+	// not found
+	return NULL;
+}
+
+
 bool GraphRendererState::IsPointInInputPort(Graph* graph, Node* node, const QPoint& point)
 {
 	Vector2 center	= Vector2(node->GetVisualPosX(), node->GetVisualPosY()) + Vector2(GraphShared::GetStateRadius(), GraphShared::GetStateRadius());
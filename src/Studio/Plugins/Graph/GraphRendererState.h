@@ -57,6 +57,7 @@ class GraphRendererState : public GraphRenderer
 		bool IsPointOverNodeIcon(Graph* graph, Node* node, const QPoint& globalPoint) override final                    { return false; }
 		
 		bool IsPointOnNode(Graph* graph, Node* node, const QPoint& globalPoint) override;
+		Node* FindNode(Graph* graph, const QPoint& globalPoint) override final;
 		bool IsCloseToConnection(Graph* graph, const QPoint& point, Connection* connection) override final;
 
 		Connection* FindConnection(Graph* graph, const QPoint& mousePos) override final;
@@ -0,0 +1,241 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+// include precompiled header
+#include <Studio/Precompiled.h>
+
+// include required headers
+#include "GraphSpatialIndex.h"
+
+using namespace Core;
+
+// constructor
+GraphSpatialIndex::GraphSpatialIndex()
+{
+	mNumCellsX	= 0;
+	mNumCellsY	= 0;
+	mCellWidth	= 1;
+	mCellHeight	= 1;
+	mVisitStamp	= 0;
+}
+
+
+// destructor
+GraphSpatialIndex::~GraphSpatialIndex()
+{
+}
+
+
+// remove all items
+void GraphSpatialIndex::Clear()
+{
+	mRects.Clear(false);
+	mCellStarts.Clear(false);
+	mCellItems.Clear(false);
+	mIsMoved.Clear(false);
+	mMovedItems.Clear(false);
+	mBounds		= QRect();
+	mGridBounds	= QRect();
+	mNumCellsX	= 0;
+	mNumCellsY	= 0;
+}
+
+
+// add an item
+void GraphSpatialIndex::Add(const QRect& rect)
+{
+	mRects.Add( rect.normalized() );
+}
+
+
+// sort the items into the grid cells
+void GraphSpatialIndex::Build()
+{
+	mCellStarts.Clear(false);
+	mCellItems.Clear(false);
+	mMovedItems.Clear(false);
+	mNumCellsX = 0;
+	mNumCellsY = 0;
+
+	const uint32 numItems = mRects.Size();
+	mIsMoved.Resize( numItems );
+	for (uint32 i=0; i<numItems; ++i)
+		mIsMoved[i] = false;
+
+	if (numItems == 0)
+		return;
+
+	// rect around all items
+	mBounds = mRects[0];
+	for (uint32 i=1; i<numItems; ++i)
+		mBounds = mBounds.united( mRects[i] );
+	mGridBounds = mBounds;
+
+	// use about as many cells as there are items
+	const int32 numCellsPerAxis = Clamp<int32>( (int32)Math::Ceil(Math::Sqrt((float)numItems)), 1, 64 );
+	mNumCellsX	= numCellsPerAxis;
+	mNumCellsY	= numCellsPerAxis;
+	mCellWidth	= Max<int32>( 1, (mBounds.width() + mNumCellsX - 1) / mNumCellsX );
+	mCellHeight	= Max<int32>( 1, (mBounds.height() + mNumCellsY - 1) / mNumCellsY );
+
+	const uint32 numCells = mNumCellsX * mNumCellsY;
+	mCellStarts.Resize( numCells + 1 );
+	for (uint32 i=0; i<=numCells; ++i)
+		mCellStarts[i] = 0;
+
+	// 1) count the items per cell
+	int32 minX, minY, maxX, maxY;
+	for (uint32 i=0; i<numItems; ++i)
+	{
+		CalcCellRange( mRects[i], &minX, &minY, &maxX, &maxY );
+		for (int32 y=minY; y<=maxY; ++y)
+			for (int32 x=minX; x<=maxX; ++x)
+				mCellStarts[y * mNumCellsX + x + 1]++;
+	}
+
+	// 2) convert the counts into start offsets
+	for (uint32 i=0; i<numCells; ++i)
+		mCellStarts[i + 1] += mCellStarts[i];
+
+	// 3) fill the cells, uses the start offsets as write cursors and shifts them back afterwards
+	mCellItems.Resize( mCellStarts[numCells] );
+	for (uint32 i=0; i<numItems; ++i)
+	{
+		CalcCellRange( mRects[i], &minX, &minY, &maxX, &maxY );
+		for (int32 y=minY; y<=maxY; ++y)
+			for (int32 x=minX; x<=maxX; ++x)
+				mCellItems[ mCellStarts[y * mNumCellsX + x]++ ] = i;
+	}
+
+	for (uint32 i=numCells; i>0; --i)
+		mCellStarts[i] = mCellStarts[i - 1];
+	mCellStarts[0] = 0;
+
+	// reset the visit marks
+	mVisitMarks.Resize( numItems );
+	for (uint32 i=0; i<numItems; ++i)
+		mVisitMarks[i] = 0;
+	mVisitStamp = 0;
+}
+
+
+// change the rect of an item
+void GraphSpatialIndex::Update(uint32 index, const QRect& rect)
+{
+	mRects[index] = rect.normalized();
+	mBounds = mBounds.united( mRects[index] );
+
+	// the cell entries of the item are skipped from now on, it is tested separately
+	if (mIsMoved[index] == false)
+	{
+		mIsMoved[index] = true;
+		mMovedItems.Add(index);
+	}
+
+	// the separate list is searched linearly, rebuild the grid once it gets long
+	const uint32 maxNumMovedItems = Max<uint32>( 16, mRects.Size() / 4 );
+	if (mMovedItems.Size() > maxNumMovedItems)
+		Build();
+}
+
+
+// find all items intersecting the given rect
+void GraphSpatialIndex::Find(const QRect& rect, Array<uint32>& outItems) const
+{
+	FindInCells( rect.normalized(), NULL, outItems );
+}
+
+
+// find all items containing the given point
+void GraphSpatialIndex::Find(const QPoint& point, Array<uint32>& outItems) const
+{
+	FindInCells( QRect(point, point), &point, outItems );
+}
+
+
+// collect the items of all cells overlapping the given rect
+void GraphSpatialIndex::FindInCells(const QRect& rect, const QPoint* point, Array<uint32>& outItems) const
+{
+	outItems.Clear(false);
+
+	if (mNumCellsX == 0 || rect.intersects(mBounds) == false)
+		return;
+
+	// new visit stamp, reset the marks once it wraps around
+	mVisitStamp++;
+	if (mVisitStamp == 0)
+	{
+		const uint32 numItems = mVisitMarks.Size();
+		for (uint32 i=0; i<numItems; ++i)
+			mVisitMarks[i] = 0;
+		mVisitStamp = 1;
+	}
+
+	int32 minX, minY, maxX, maxY;
+	CalcCellRange( rect, &minX, &minY, &maxX, &maxY );
+	for (int32 y=minY; y<=maxY; ++y)
+	{
+		for (int32 x=minX; x<=maxX; ++x)
+		{
+			const uint32 cellIndex	= y * mNumCellsX + x;
+			const uint32 cellEnd	= mCellStarts[cellIndex + 1];
+			for (uint32 i=mCellStarts[cellIndex]; i<cellEnd; ++i)
+			{
+				const uint32 item = mCellItems[i];
+				if (mVisitMarks[item] == mVisitStamp || mIsMoved[item] == true)
+					continue;
+
+				mVisitMarks[item] = mVisitStamp;
+
+				const bool isHit = (point != NULL ? mRects[item].contains(*point) : mRects[item].intersects(rect));
+				if (isHit == true)
+					outItems.Add(item);
+			}
+		}
+	}
+
+	// the moved items are not in the cells they cover now
+	const uint32 numMovedItems = mMovedItems.Size();
+	for (uint32 i=0; i<numMovedItems; ++i)
+	{
+		const uint32 item = mMovedItems[i];
+		const bool isHit = (point != NULL ? mRects[item].contains(*point) : mRects[item].intersects(rect));
+		if (isHit == true)
+			outItems.Add(item);
+	}
+
+	// keep the order in which the items got added (e.g. the node drawing order)
+	if (outItems.Size() > 1)
+		outItems.Sort();
+}
+
+
+// calculate the range of cells overlapped by the given rect, clamped to the grid
+void GraphSpatialIndex::CalcCellRange(const QRect& rect, int32* outMinX, int32* outMinY, int32* outMaxX, int32* outMaxY) const
+{
+	*outMinX = Clamp<int32>( (rect.left()	- mGridBounds.left()) / mCellWidth,		0, mNumCellsX - 1 );
+	*outMinY = Clamp<int32>( (rect.top()	- mGridBounds.top()) / mCellHeight,		0, mNumCellsY - 1 );
+	*outMaxX = Clamp<int32>( (rect.right()	- mGridBounds.left()) / mCellWidth,		0, mNumCellsX - 1 );
+	*outMaxY = Clamp<int32>( (rect.bottom()	- mGridBounds.top()) / mCellHeight,		0, mNumCellsY - 1 );
+}
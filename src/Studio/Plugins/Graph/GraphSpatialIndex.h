@@ -0,0 +1,85 @@
+/****************************************************************************
+**
+** Copyright 2019 neuromore co
+** Contact: https://neuromore.com/contact
+**
+** Commercial License Usage
+** Licensees holding valid commercial neuromore licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and neuromore. For licensing terms
+** and conditions see https://neuromore.com/licensing. For further
+** information use the contact form at https://neuromore.com/contact.
+**
+** neuromore Public License Usage
+** Alternatively, this file may be used under the terms of the neuromore
+** Public License version 1 as published by neuromore co with exceptions as 
+** appearing in the file neuromore-class-exception.md included in the 
+** packaging of this file. Please review the following information to 
+** ensure the neuromore Public License requirements will be met: 
+** https://neuromore.com/npl
+**
+****************************************************************************/
+
+
+#ifndef __NEUROMORE_GRAPHSPATIALINDEX_H
+#define __NEUROMORE_GRAPHSPATIALINDEX_H
+
+// include required headers
+#include "../../Config.h"
+#include <Core/StandardHeaders.h>
+#include <Core/Array.h>
+#include <QRect>
+#include <QPoint>
+
+
+// uniform grid over axis aligned rects (node and connection bounds in graph space)
+// used to cull rendering to the visible area and to speed up hit tests in large graphs
+class GraphSpatialIndex
+{
+	public:
+		GraphSpatialIndex();
+		~GraphSpatialIndex();
+
+		// remove all items (keeps the allocated memory)
+		void Clear();
+
+		// add an item, the item index is the order in which the items got added
+		void Add(const QRect& rect);
+
+		// sort the added items into the grid cells, has to be called after adding the items and before searching
+		void Build();
+
+		// change the rect of an item after the grid got built; moved items are kept in a separate list until too many of them piled up, then the grid is rebuilt
+		void Update(uint32 index, const QRect& rect);
+
+		// find all items that intersect the given rect or contain the given point, the result is sorted by item index
+		void Find(const QRect& rect, Core::Array<uint32>& outItems) const;
+		void Find(const QPoint& point, Core::Array<uint32>& outItems) const;
+
+		uint32 GetNumItems() const																{ return mRects.Size(); }
+		const QRect& GetRect(uint32 index) const												{ return mRects[index]; }
+
+	private:
+		void FindInCells(const QRect& rect, const QPoint* point, Core::Array<uint32>& outItems) const;
+		void CalcCellRange(const QRect& rect, int32* outMinX, int32* outMinY, int32* outMaxX, int32* outMaxY) const;
+
+		Core::Array<QRect>		mRects;					// item rects
+		Core::Array<uint32>		mCellStarts;			// first entry of each cell in mCellItems, has one more element than there are cells
+		Core::Array<uint32>		mCellItems;				// item indices, sorted by cell
+		QRect					mBounds;				// rect around all items
+		QRect					mGridBounds;			// area covered by the grid cells (the bounds at the time the grid got built)
+		Core::Array<bool>		mIsMoved;				// items that were moved after the grid got built, their cell entries are outdated
+		Core::Array<uint32>		mMovedItems;			// indices of the moved items
+		int32					mNumCellsX;
+		int32					mNumCellsY;
+		int32					mCellWidth;
+		int32					mCellHeight;
+
+		// visit marks used to report items spanning multiple cells only once
+		mutable Core::Array<uint32>	mVisitMarks;
+		mutable uint32				mVisitStamp;
+};
+
+
+#endif
@@ -89,6 +89,7 @@ GraphWidget::GraphWidget(Type type, GraphPlugin* plugin, QWidget* parent) : QOpe
 	setAutoFillBackground(false);
 
 	// attach to event system
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	connect( &mShared, SIGNAL(SelectionChanged()), this, SLOT(OnEmitSelectionChangedSignal()) );
@@ -129,8 +130,9 @@ void GraphWidget::paintGL()
 			mShared.SetScreenInfo( screen->physicalSize().width(), screen->physicalSize().height(), screen->physicalDotsPerInch() );
 	}
 
+	// recalculate the rects of the nodes that changed since the last frame
 	if (mShownGraph != NULL)
-		mRenderer->ResetNodeCaches(mShownGraph);
+		mRenderer->ValidateNodeCaches(mShownGraph);
 
 	// allow editing, if classifier allows it and session is not running
 	if (mShownGraph != NULL && GetSession()->IsRunning() == false)
@@ -775,6 +777,9 @@ void GraphWidget::mouseReleaseEvent(QMouseEvent* event)
 
 				QPoint newEndOffset = mGlobalMousePos - QPoint(portNode->GetVisualPosX(), portNode->GetVisualPosY());
 				transition->SetVisualOffsets( transition->GetVisualStartOffsetX(), transition->GetVisualStartOffsetY(), newEndOffset.x(), newEndOffset.y() );
+
+				// the transition bounds changed
+				mRenderer->InvalidateSpatialIndex();
 			}
 		}
 
@@ -790,6 +795,9 @@ void GraphWidget::mouseReleaseEvent(QMouseEvent* event)
 
 				QPoint newStartOffset = mGlobalMousePos - QPoint(portNode->GetVisualPosX(), portNode->GetVisualPosY());
 				transition->SetVisualOffsets( newStartOffset.x(), newStartOffset.y(), transition->GetVisualEndOffsetX(), transition->GetVisualEndOffsetY() );
+
+				// the transition bounds changed
+				mRenderer->InvalidateSpatialIndex();
 			}
 		}
 	}
@@ -1016,6 +1024,9 @@ void GraphWidget::initializeGL()
 	// re-register OpenGL widget
 	GetOpenGLManager()->UnregisterOpenGLWidget(this);
 	GetOpenGLManager()->RegisterOpenGLWidget(this);
+
+	// let the engine thread run while the window is composed
+	GetQtBaseManager()->GetMainWindow()->ReleaseEngineLockWhileComposing(this);
 }
 
 
@@ -1654,18 +1665,8 @@ Node* GraphWidget::FindNode(const QPoint& globalPoint)
 	if (mShownGraph == NULL)
 		return NULL;
 
-	// get the number of nodes and iterate through them
-	const uint32 numNodes = mShownGraph->GetNumNodes();
-	for (uint32 i=0; i<numNodes; ++i)
-	{
-		Node* node = mShownGraph->GetNode(i);
-		
-		if (mRenderer->IsPointOnNode(mShownGraph, node, globalPoint) == true)
-			return node;
-	}
-
-	// not found
-	return NULL;
+	// the renderer uses its spatial index to find the node
+	return mRenderer->FindNode(mShownGraph, globalPoint);
 }
 
 
@@ -1974,6 +1975,10 @@ bool GraphWidget::event(QEvent* event)
 						mTempString.Format( "<tr><td><b><nobr>Buffer Size:</nobr></b></td><td><nobr>%i</nobr></td></tr>", channel->GetBufferSize());
 						toolTipString += mTempString;
 
+						// buffer high-water mark (most samples a reader required)
+						mTempString.Format( "<tr><td><b><nobr>Buffer High-Water Mark:</nobr></b></td><td><nobr>%i</nobr></td></tr>", channel->GetHighWaterMark());
+						toolTipString += mTempString;
+
 						// start time
 						mTempString.Format("<tr><td><b><nobr>Start Time:</nobr></b></td><td><nobr>%.4f</nobr></td></tr>", channel->GetStartTime().InSeconds());
 						toolTipString += mTempString;
@@ -2053,6 +2058,10 @@ bool GraphWidget::event(QEvent* event)
 						mTempString.Format( "<tr><td><b><nobr>Buffer Size:</nobr></b></td><td><nobr>%i</nobr></td></tr>", channel->GetBufferSize());
 						toolTipString += mTempString;
 
+						// buffer high-water mark (most samples a reader required)
+						mTempString.Format( "<tr><td><b><nobr>Buffer High-Water Mark:</nobr></b></td><td><nobr>%i</nobr></td></tr>", channel->GetHighWaterMark());
+						toolTipString += mTempString;
+
 						// num samples
 						mTempString.Format( "<tr><td><b><nobr>Num Samples:</nobr></b></td><td><nobr>%i</nobr></td></tr>", channel->GetNumSamples());
 						toolTipString += mTempString;
@@ -63,7 +63,8 @@ class NetworkTestClientPlugin : public Plugin
 		void UpdateInterface() override;
 
 		// log one line to the console textedit (used by log callback)
-		void LogLine( const char* text )												{ if (mLogOutput != NULL) mLogOutput->append( text ); }
+		// thread safe (log messages of the engine thread get queued)
+		void LogLine( const char* text )												{ if (mLogOutput != NULL) QMetaObject::invokeMethod( mLogOutput, "append", Qt::AutoConnection, Q_ARG(QString, QString(text)) ); }
 
 		// resize message and update timestamp
 		void PreparePacket(bool resize=false);
@@ -60,6 +60,7 @@ ParametersWidget::ParametersWidget(QWidget* parent) : QScrollArea(parent)
 	mSpacerWidget->setObjectName("TransparentWidget");
 
 	// add event handler
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	// add Widgets immediately
@@ -39,6 +39,9 @@ RawWaveformWidget::RawWaveformWidget(RawWaveformPlugin* plugin, QWidget* parent)
 
 	mPlugin		= plugin;
 	mEmptyText	= "No active device";
+
+	mNumSelectedChannels	= 0;
+	mHighlightedSensorIndex	= CORE_INVALIDINDEX32;
 }
 
 
@@ -50,6 +53,41 @@ RawWaveformWidget::~RawWaveformWidget()
 }
 
 
+// sync the snapshots with the selected channels of the headset (the engine is locked while we process events)
+void RawWaveformWidget::UpdateSnapshots(BciDevice* headset)
+{
+	ChannelMultiSelectionWidget* channelSelectionWidget = mPlugin->GetChannelSelectionWidget();
+
+	mNumSelectedChannels	= channelSelectionWidget->GetNumSelectedChannels();
+	mHighlightedSensorIndex	= channelSelectionWidget->GetHighlightedIndex();
+
+	mSnapshots.Begin();
+	mSnapshotSensorIndices.Clear(false);
+
+	if (headset != NULL)
+	{
+		const double timeRange = mPlugin->GetTimeRange();
+
+		const uint32 numSensors = headset->GetNumSensors();
+		for (uint32 i=0; i<numSensors; ++i)
+		{
+			Sensor* sensor = headset->GetSensor(i);
+			if (sensor == NULL)
+				continue;
+
+			Channel<double>* channel = sensor->GetChannel();
+			if (channelSelectionWidget->IsChannelSelected(channel) == false)
+				continue;
+
+			mSnapshots.Add(channel, timeRange);
+			mSnapshotSensorIndices.Add(i);
+		}
+	}
+
+	mSnapshots.End();
+}
+
+
 // render frame
 void RawWaveformWidget::paintGL()
 {
@@ -69,12 +107,23 @@ void RawWaveformWidget::paintGL()
 	if (selectedDevice != NULL && selectedDevice->GetBaseType() == BciDevice::BASE_TYPE_ID)
 		headset = static_cast<BciDevice*>(selectedDevice);
 
+	// copy the displayed channels while the engine is locked, then render without holding the lock so the engine thread can continue
+	// (without the engine thread the engine runs on this thread and there is no lock to release)
+	UpdateSnapshots(headset);
+	MainWindowBase* mainWindow = GetQtBaseManager()->GetMainWindow();
+	const bool releaseLock = mainWindow->IsEngineThreadEnabled();
+	if (releaseLock == true)
+		mainWindow->ReleaseEngineLock();
+
 	// render single view
 	if (headset == NULL)
 		RenderEmpty();
 	else
 		Render();
 
+	if (releaseLock == true)
+		mainWindow->AcquireEngineLock();
+
 	// post rendering
 	PostRendering();
 }
@@ -84,6 +133,7 @@ void RawWaveformWidget::paintGL()
 RawWaveformWidget::RenderCallback::RenderCallback(RawWaveformWidget* parent) : OpenGLWidgetCallback(parent)
 {
 	mParent			= parent;
+	mChannelID		= CORE_INVALIDINDEX32;
 
 	mLineWidth		= 1.1f;
 	mTextColor		= ColorPalette::Shared::GetTextColor();
@@ -93,6 +143,59 @@ RawWaveformWidget::RenderCallback::RenderCallback(RawWaveformWidget* parent) : O
 }
 
 
+// destructor
+RawWaveformWidget::RenderCallback::~RenderCallback()
+{
+	// destroy the pyramids
+	const uint32 numPyramids = mPyramids.Size();
+	for (uint32 i=0; i<numPyramids; ++i)
+		delete mPyramids[i];
+}
+
+
+// find the pyramid of the given channel, create it if there is none yet
+MinMaxPyramid* RawWaveformWidget::RenderCallback::FindPyramid(Channel<double>* channel, uint32 channelID)
+{
+	const uint32 numPyramids = mPyramids.Size();
+	for (uint32 i=0; i<numPyramids; ++i)
+	{
+		if (mPyramids[i]->GetChannelID() == channelID)
+		{
+			mIsPyramidUsed[i] = true;
+			return mPyramids[i];
+		}
+	}
+
+	// the pyramid gets bound to the channel on the first update
+	MinMaxPyramid* pyramid = new MinMaxPyramid();
+	pyramid->Update(channel, channelID);
+
+	mPyramids.Add(pyramid);
+	mIsPyramidUsed.Add(true);
+	return pyramid;
+}
+
+
+// destroy the pyramids of all channels that were not rendered since the last call
+void RawWaveformWidget::RenderCallback::RemoveUnusedPyramids()
+{
+	for (uint32 i=0; i<mPyramids.Size(); )
+	{
+		if (mIsPyramidUsed[i] == false)
+		{
+			delete mPyramids[i];
+			mPyramids.Remove(i);
+			mIsPyramidUsed.Remove(i);
+		}
+		else
+		{
+			mIsPyramidUsed[i] = false;
+			++i;
+		}
+	}
+}
+
+
 // render callback
 void RawWaveformWidget::RenderCallback::Render(uint32 index, bool isHighlighted, double x, double y, double width, double height)
 {
@@ -106,27 +209,20 @@ void RawWaveformWidget::RenderCallback::Render(uint32 index, bool isHighlighted,
 	AddRect( 0, 0, width, height, ColorPalette::Shared::GetDarkBackgroundColor() );
 	RenderRects();
 
-	ChannelMultiSelectionWidget* channelSelectionWidget = mParent->mPlugin->GetChannelSelectionWidget();
-
-	// get access to the active headset
-	BciDevice* headset = NULL;
-	Device* selectedDevice = channelSelectionWidget->GetSelectedDevice();
-	if (selectedDevice != NULL && selectedDevice->GetBaseType() == BciDevice::BASE_TYPE_ID)
-		headset = static_cast<BciDevice*>(selectedDevice);
+	// render the waves of the selected channels
+	RenderWaves(width, height);
 
-	// render callback per sensor
-	Render( headset, NULL, width, height);
+	// forget about the channels that are not displayed anymore
+	RemoveUnusedPyramids();
 }
 
 
-// render callback
-void RawWaveformWidget::RenderCallback::Render(BciDevice* headset, Sensor* sensor, double windowWidth, double windowHeight)
+// render the waves of the selected channels (from the snapshots, the engine is not locked here)
+void RawWaveformWidget::RenderCallback::RenderWaves(double windowWidth, double windowHeight)
 {
-	if (headset == NULL || windowHeight == 0 || windowWidth == 0)
+	if (windowHeight == 0 || windowWidth == 0)
 		return;
 
-	ChannelMultiSelectionWidget* channelSelectionWidget = mParent->mPlugin->GetChannelSelectionWidget();
-
 	const double	settingsTimeRange		= mParent->mPlugin->GetTimeRange();
 	const bool		showVoltages			= mParent->mPlugin->GetShowVoltages();
 	const bool		showTimes				= mParent->mPlugin->GetShowTimes();
@@ -135,22 +231,23 @@ void RawWaveformWidget::RenderCallback::Render(BciDevice* headset, Sensor* senso
 	const bool		showSignalName			= true;
 
 	// get the number of visible sensors (number of checked checkboxes)
-	const uint32 numVisibleSensors = channelSelectionWidget->GetNumSelectedChannels();
+	const uint32 numVisibleSensors = mParent->mNumSelectedChannels;
 
 	// time or x-axis scaling
 	//double sampleRate = headset->GetSampleRate();
 
 	const double timeRange = settingsTimeRange;
 
-	// get elapsed time from first sensors (assume they all have same elapsed time)
+	// get the latest published version of the channels
+	const uint32 numChannels = mParent->mSnapshots.Size();
+	mChannels.Resize(numChannels);
+	for (uint32 i=0; i<numChannels; ++i)
+		mChannels[i] = mParent->mSnapshots.Get(i)->Acquire();
+
+	// get elapsed time from first channel (assume they all have same elapsed time)
 	double elapsedTime = 0;
-	const uint32 numSensors = headset->GetNumSensors();
-	if (numSensors > 0)
-	{
-		Sensor* sensor = headset->GetSensor(0);
-		if (sensor != NULL)
-			elapsedTime = sensor->GetChannel()->GetElapsedTime().InSeconds();
-	}
+	if (numChannels > 0)
+		elapsedTime = mChannels[0]->GetElapsedTime().InSeconds();
 
 	// reduce some from the usable height cause of the times text rendering at the bottom
 	uint32 usableHeight = windowHeight;
@@ -180,27 +277,16 @@ void RawWaveformWidget::RenderCallback::Render(BciDevice* headset, Sensor* senso
 	// render the grid
 	RenderGrid(numVisibleSensors, (uint32)numVerticalDivs, waveCellHeight, xStart, xEnd, windowHeight, mGridColor, mGridSubColor, timeRange, elapsedTime);
 
-	// return directly after rendering the grid in case there is no neuro headset
-	if (headset == NULL)
-		return;
-
 	// get the sensor index whose checkbox is on mouse overed
-	const uint32 highlightedSensorIndex = channelSelectionWidget->GetHighlightedIndex();
+	const uint32 highlightedSensorIndex = mParent->mHighlightedSensorIndex;
 	uint32 numActuallyRendered = 0;
 
-	// get the number of sensors and iterate through them
-	for (uint32 i = 0; i < numSensors; ++i)
+	// iterate through the selected channels
+	for (uint32 c = 0; c < numChannels; ++c)
 	{
-		// get the current sensor and skip it in case it is no valid neuro sensor
-		Sensor* sensor = headset->GetSensor(i);
-		if (sensor == NULL)
-			continue;
-
-		Channel<double>* channel = sensor->GetChannel();
-
-		// check if we need to render the signal for the given sensor
-		if (channelSelectionWidget->IsChannelSelected(channel) == false)
-			continue;
+		Channel<double>* channel = mChannels[c];
+		const uint32 i = mParent->mSnapshotSensorIndices[c];
+		mChannelID = mParent->mSnapshots.Get(c)->GetSourceChannelID();
 
 		if (channel->IsEmpty() == true)
 			continue;
@@ -371,21 +457,14 @@ void RawWaveformWidget::RenderCallback::RenderWave2D(Channel<double>* channel, b
 
 	CORE_ASSERT(maxSampleIndex >= minSampleIndex);
 
+	// bring the min/max pyramid of the channel up to date (only adds the new samples)
+	MinMaxPyramid* pyramid = FindPyramid(channel, mChannelID);
+	pyramid->Update(channel, mChannelID);
+
 	// find max/min of all displayed values for scaling
-	double rawMin = DBL_MAX;
-	double rawMax = -DBL_MAX;
-	double mean = 0;
-	uint32 numVals = 0;
-	for (uint32 i=minSampleIndex; i<=maxSampleIndex; ++i)
-	{
-		double* rawValue = channel->GetSampleRef(i);
-		rawMin = (*rawValue) < rawMin ? (*rawValue) : rawMin;
-		rawMax = (*rawValue) > rawMax ? (*rawValue) : rawMax;
-		mean += (*rawValue);
-		numVals++;
-	}
-	if (numVals != 0)
-		mean /= numVals;
+	double rawMin, rawMax, mean;
+	pyramid->FindMinMax(channel, minSampleIndex, maxSampleIndex, &rawMin, &rawMax, &mean);
+	mean /= (double)(maxSampleIndex - minSampleIndex + 1);
 
 	// calculate waveform scaling parmeters
 	if (useAutoScale == true)
@@ -442,35 +521,87 @@ void RawWaveformWidget::RenderCallback::RenderWave2D(Channel<double>* channel, b
 		previousY = (int32)previousY + 0.375;
 	}
 
+	// number of samples that fall onto one pixel column
+	const double samplesPerPixel = (maxSampleIndex - minSampleIndex + 1) / Max(1.0, xEnd - xStart);
+
 	//////////////////////////////////////////////////////////////////
-	// 1) draw all middle samples
-	for (uint32 i = minSampleIndex; i <= maxSampleIndex; i++)
+	// 1a) few samples per pixel: draw all middle samples
+	if (samplesPerPixel <= 2.0)
 	{
-		// get time of sample
-		time = channel->GetSampleTime(i).InSeconds();
+		for (uint32 i = minSampleIndex; i <= maxSampleIndex; i++)
+		{
+			// get time of sample
+			time = channel->GetSampleTime(i).InSeconds();
 
-		// map time to pixel x-coordinate
-		x = RemapRange(time, minTime, maxTime, xStart,  xEnd);
+			// map time to pixel x-coordinate
+			x = RemapRange(time, minTime, maxTime, xStart,  xEnd);
 
-		// clamp and remap value to y coordinate
-		value = channel->GetSample(i);
-		y = yCenter + valueScale * (value - mean);
+			// clamp and remap value to y coordinate
+			value = channel->GetSample(i);
+			y = yCenter + valueScale * (value - mean);
 
-		// FIX due to antialiasing problems : round the coords to int and add the twiddle factor
-		//x = (int32)x + 0.375;
-		y = (int32)y + 0.375;
+			// FIX due to antialiasing problems : round the coords to int and add the twiddle factor
+			//x = (int32)x + 0.375;
+			y = (int32)y + 0.375;
 
-		// calculate the color for the top point (value) of the line
-		float normalizedValue = ClampedRemapRange( value, rawMin, rawMax, 0.0, 1.0 );
-		valueColor = LinearInterpolate<Color>( darkerColor, lighterColor, normalizedValue );
+			// calculate the color for the top point (value) of the line
+			float normalizedValue = ClampedRemapRange( value, rawMin, rawMax, 0.0, 1.0 );
+			valueColor = LinearInterpolate<Color>( darkerColor, lighterColor, normalizedValue );
 
-		// draw the sample
-		AddLine( previousX, previousY, previousColor, x, y, valueColor );
-	
-		// store the current x and y pos for the next cycle
-		previousX		= x;
-		previousY		= y;
-		previousColor	= valueColor;
+			// draw the sample
+			AddLine( previousX, previousY, previousColor, x, y, valueColor );
+		
+			// store the current x and y pos for the next cycle
+			previousX		= x;
+			previousY		= y;
+			previousColor	= valueColor;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////
+	// 1b) many samples per pixel: draw one vertical min/max line per pixel column
+	else
+	{
+		const double sampleRate = channel->GetSampleRate();
+		const double minSampleTime = channel->GetSampleTime(minSampleIndex).InSeconds();
+
+		uint32 firstIndex = minSampleIndex;
+		double columnX = Math::FloorD( RemapRange(minSampleTime, minTime, maxTime, xStart, xEnd) );
+		while (firstIndex <= maxSampleIndex)
+		{
+			// last sample that lies left of the next pixel column
+			const double nextColumnTime = RemapRange(columnX + 1.0, xStart, xEnd, minTime, maxTime);
+			const double numColumnSamples = Math::CeilD( (nextColumnTime - minSampleTime) * sampleRate );
+			uint32 lastIndex = minSampleIndex + (uint32)Max(0.0, numColumnSamples - 1.0);
+			lastIndex = Clamp<uint32>(lastIndex, firstIndex, maxSampleIndex);
+
+			// include the last sample of the previous column, so the columns are connected
+			const uint32 rangeStart = (firstIndex > minSampleIndex ? firstIndex - 1 : firstIndex);
+
+			double columnMin, columnMax;
+			pyramid->FindMinMax(channel, rangeStart, lastIndex, &columnMin, &columnMax);
+
+			// remap the value range to y coordinates (inverted, so the minimum is at the bottom)
+			const double yMin = (int32)(yCenter + valueScale * (columnMin - mean)) + 0.375;
+			double yMax = (int32)(yCenter + valueScale * (columnMax - mean)) + 0.375;
+
+			// make sure flat signal segments are still visible
+			if (yMin - yMax < 1.0)
+				yMax = yMin - 1.0;
+
+			const Color minColor = LinearInterpolate<Color>( darkerColor, lighterColor, ClampedRemapRange(columnMin, rawMin, rawMax, 0.0, 1.0) );
+			const Color maxColor = LinearInterpolate<Color>( darkerColor, lighterColor, ClampedRemapRange(columnMax, rawMin, rawMax, 0.0, 1.0) );
+
+			x = columnX + 0.375;
+			AddLine( x, yMin, minColor, x, yMax, maxColor );
+
+			firstIndex = lastIndex + 1;
+			columnX += 1.0;
+		}
+
+		// the circle indicator sits on the newest sample
+		previousX = RemapRange(channel->GetSampleTime(maxSampleIndex).InSeconds(), minTime, maxTime, xStart, xEnd);
+		previousY = (int32)(yCenter + valueScale * (channel->GetSample(maxSampleIndex) - mean)) + 0.375;
 	}
 
 	//// draw a circle indicator on the newest sample
@@ -28,6 +28,8 @@
 #include "../../Config.h"
 #include "../../Rendering/OpenGLWidget.h"
 #include <BciDevice.h>
+#include <DSP/MinMaxPyramid.h>
+#include <DSP/ChannelSnapshot.h>
 
 
 // forward declaration
@@ -49,10 +51,11 @@ class RawWaveformWidget : public OpenGLWidget
 		{
 			public:
 				RenderCallback(RawWaveformWidget* parent);
+				~RenderCallback();
 				void Render(uint32 index, bool isHighlighted, double x, double y, double width, double height) override;
 
 				// waveform
-				void Render(BciDevice* headset, Sensor* sensor, double windowWidth, double windowHeight);
+				void RenderWaves(double windowWidth, double windowHeight);
 				void RenderWave2D(Channel<double>* channel, bool useAutoScale, double amplitudeScale, double timeRange, double height, double yCenter, double xStart, double xEnd, double windowHeight);
 				void Render2DCircle(double posX, double posY, double radius, uint32 numSteps, const Core::Color& color);
 
@@ -63,8 +66,18 @@ class RawWaveformWidget : public OpenGLWidget
 				void RenderTimeAxis(uint32 xEnd, uint32 xStart, uint32 windowHeight, double maxTime, double timeRange);
 
 			private:
+				// min/max pyramids of the rendered channels (used for decimating the waveforms to pixel columns)
+				MinMaxPyramid* FindPyramid(Channel<double>* channel, uint32 channelID);
+				void RemoveUnusedPyramids();
+
+				Core::Array<MinMaxPyramid*>	mPyramids;
+				Core::Array<bool>			mIsPyramidUsed;
+
+				Core::Array<Channel<double>*>	mChannels;		// the snapshot channels acquired for the current frame
+
 				RawWaveformWidget*	mParent;
 				Core::String		mTempString;
+				uint32				mChannelID;			// id of the engine channel the rendered snapshot was copied from
 
 				// style
 				float				mLineWidth;
@@ -74,6 +87,14 @@ class RawWaveformWidget : public OpenGLWidget
 				Core::Color		mAxisColor;
 		};
 
+		// copies of the displayed channels, so rendering doesn't have to lock the engine (see ChannelSnapshot)
+		void UpdateSnapshots(BciDevice* headset);
+
+		ChannelSnapshotSet				mSnapshots;					// one per displayed channel, in display order
+		Core::Array<uint32>				mSnapshotSensorIndices;		// index of the sensor each snapshot belongs to
+		uint32							mNumSelectedChannels;
+		uint32							mHighlightedSensorIndex;
+
 		RawWaveformPlugin*		mPlugin;
 		RenderCallback*			mRenderCallback;
 };
@@ -145,6 +145,7 @@ bool SessionControlPlugin::Init()
 	mDock->update();
 
 	// register with event handler
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	LogDetailedInfo("Session control plugin successfully initialized");
@@ -58,6 +58,7 @@ SessionInfoWidget::SessionInfoWidget(QWidget* parent) : QWidget(parent)
 
 	UpdateLayout();
 
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 }
 
@@ -181,11 +181,8 @@ void SpectrogramBandsPlugin::ChannelBandsDataProxy::ReInit()
 	// re-init data array
 	mData->clear();
 
-	// clear spectrum analyzers (better would be: reuse them)
-	const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
-	for (uint32 i=0; i<numAnalyzers; i++)
-		delete mSpectrumAnalyzers[i];
-	mSpectrumAnalyzers.Clear();
+	// unsubscribe from the spectrum analyzers
+	ReleaseAnalyzers();
 
 	// remember frequency resolution
 	mNumBins = GetEngine()->GetSpectrumAnalyzerSettings()->GetNumFFTBins();
@@ -211,13 +208,8 @@ void SpectrogramBandsPlugin::ChannelBandsDataProxy::ReInit()
 			LogError("Samplerate of the channels do not match while initializing ChannelBandsDataProxy!");
 		}
 
-		// create a spectrum analyzer
-		FFTProcessor* analyzer = new FFTProcessor();
-		analyzer->SetInput(channel);
-		analyzer->Setup(GetEngine()->GetSpectrumAnalyzerSettings()->GetFFTSettings());
-		analyzer->ReInit();
-
-		mSpectrumAnalyzers.Add(analyzer);
+		// subscribe to the shared spectrum analyzer of the channel
+		mSpectrumAnalyzers.Add( GetEngine()->GetSpectrumAnalyzerService()->Acquire(channel, GetEngine()->GetSpectrumAnalyzerSettings()->GetFFTSettings()) );
 
 		// init data array row by row
 		QBarDataRow* row = new QBarDataRow(GetNumBins());
@@ -228,6 +220,16 @@ void SpectrogramBandsPlugin::ChannelBandsDataProxy::ReInit()
 }
 
 
+// unsubscribe from the shared spectrum analyzers
+void SpectrogramBandsPlugin::ChannelBandsDataProxy::ReleaseAnalyzers()
+{
+	const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
+	for (uint32 i=0; i<numAnalyzers; i++)
+		GetEngine()->GetSpectrumAnalyzerService()->Release(mSpectrumAnalyzers[i]);
+	mSpectrumAnalyzers.Clear();
+}
+
+
 // data proxy update : fill visualization arrays with data
 void SpectrogramBandsPlugin::ChannelBandsDataProxy::Update()
 {
@@ -241,11 +243,6 @@ void SpectrogramBandsPlugin::ChannelBandsDataProxy::Update()
 	if (settings->GetNumFFTBins() != mNumBins || settings->GetNumWindowShiftSamples() != mNumShiftSamples || settings->GetWindowFunction()->GetType() != mWindowFunctionType)
 		ReInit();
 
-	// update spectrum analyzer
-	const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
-	for (uint32 i=0; i<numAnalyzers; i++)
-		mSpectrumAnalyzers[i]->Update();
-
 	// reset to extremes
 	mMinValue = DBL_MAX;
 	mMaxValue = -DBL_MAX;
@@ -254,7 +251,7 @@ void SpectrogramBandsPlugin::ChannelBandsDataProxy::Update()
 	for (int c = 0; c < numChannels; c++)
 	{
 		Channel<double>* channel = mChannels[c];
-		Channel<Spectrum>* output = mSpectrumAnalyzers[c]->GetOutput()->AsType<Spectrum>();
+		const Channel<Spectrum>* output = mSpectrumAnalyzers[c]->GetSpectra();
 		
 		if (output->GetNumSamples() == 0)
 			continue; 
@@ -356,7 +353,7 @@ void SpectrogramBandsPlugin::OnChannelSelectionChanged()
 	// check that max frequency is consitent for all channels
 	for (int i = 0; i < numSelected; i++)
 	{
-		const double currentMaxFrequency = mDataProxy->GetSpectrumAnalyzer(i)->GetOutput()->GetSampleRate() / 2.0;
+		const double currentMaxFrequency = mDataProxy->GetSpectrumAnalyzer(i)->GetSpectra()->GetSampleRate() / 2.0;
 		if (maxFrequency == -1)
 		{
 			maxFrequency = currentMaxFrequency;
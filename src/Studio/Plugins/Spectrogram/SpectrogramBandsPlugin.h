@@ -31,6 +31,7 @@
 #include <Core/String.h>
 #include <Sensor.h>
 #include <DSP/FFTProcessor.h>
+#include <DSP/SpectrumAnalyzerService.h>
 
 #ifdef USE_QTDATAVISUALIZATION
 
@@ -57,10 +58,7 @@ class SpectrogramBandsPlugin : public SpectrogramPlugin
 			}
 			~ChannelBandsDataProxy()
 			{
-				const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
-				for (uint32 i=0; i<numAnalyzers; i++)
-					delete mSpectrumAnalyzers[i];
-				mSpectrumAnalyzers.Clear();
+				ReleaseAnalyzers();
 			}
 			
 			void ReInit();
@@ -70,7 +68,7 @@ class SpectrogramBandsPlugin : public SpectrogramPlugin
 			Channel<double>* GetChannel(uint32 index)			{ return mChannels[index]; }
 			void Clear()										{ mChannels.Clear(); }
 
-			FFTProcessor* GetSpectrumAnalyzer(uint32 index)		{ return mSpectrumAnalyzers[index]; }
+			SpectrumAnalyzerService::Analyzer* GetSpectrumAnalyzer(uint32 index)		{ return mSpectrumAnalyzers[index]; }
 			
 			inline uint32 GetNumBins() const					{ return GetEngine()->GetSpectrumAnalyzerSettings()->GetNumFrequencyBands(); }
 			inline uint32 GetNumChannels() const				{ return (uint32)(mChannels.Size()); }
@@ -78,9 +76,11 @@ class SpectrogramBandsPlugin : public SpectrogramPlugin
 			void SetConvertToDezibel(bool enable = true)		{ mConvertToDezibel = enable; }
 
 		private:
+			void ReleaseAnalyzers();
+
 			QBarDataArray*						mData;				// deallocated by QT
 			Core::Array<Channel<double>*>		mChannels;
-			Core::Array<FFTProcessor*>			mSpectrumAnalyzers;
+			Core::Array<SpectrumAnalyzerService::Analyzer*> mSpectrumAnalyzers;	// shared spectrum analyzers (updated by the engine)
 			double								mMaxFrequency;
 			bool								mConvertToDezibel;	// convert spectrum values from uV to uVdB for rendering
 			uint32								mNumBins;			// number of frequency bins (size of mesh in frequency direction)
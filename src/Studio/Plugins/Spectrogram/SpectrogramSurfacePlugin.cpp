@@ -252,7 +252,11 @@ void SpectrogramSurfacePlugin::SurfaceDataProxy::ReInit()
 {
 	// nothing to do (yet)
 	if (mChannel == NULL)
+	{
+		GetEngine()->GetSpectrumAnalyzerService()->Release(mSpectrumAnalyzer);
+		mSpectrumAnalyzer = NULL;
 		return;
+	}
 
 	// clear render array
 	Clear();
@@ -266,18 +270,17 @@ void SpectrogramSurfacePlugin::SurfaceDataProxy::ReInit()
 	// remember window function
 	mWindowFunctionType = GetEngine()->GetSpectrumAnalyzerSettings()->GetWindowFunction()->GetType();
 
-	// remember sampling rate
-	const double inputSampleRate = mSpectrumAnalyzer.GetOutput()->GetSampleRate();
-	mSampleRate = inputSampleRate;
+	// remember sampling rate (of the spectra)
+	const FFTProcessor::FFTSettings& fftSettings = GetEngine()->GetSpectrumAnalyzerSettings()->GetFFTSettings();
+	mSampleRate = mChannel->GetSampleRate() / (double)Max<uint32>(fftSettings.mEpochShift, 1);
 
 	// calculate number of (downsampled) spectrums to keep in the display buffer
 	mNumSamples = (uint32)(mSampleRate * mDuration) + 1;
 
-	// configure spectrum analyzer
-	mSpectrumAnalyzer.SetInput(mChannel);
-	mSpectrumAnalyzer.GetOutput()->SetBufferSize(2*mNumSamples);
-	mSpectrumAnalyzer.Setup(GetEngine()->GetSpectrumAnalyzerSettings()->GetFFTSettings());
-	mSpectrumAnalyzer.ReInit();
+	// subscribe to the shared spectrum analyzer of the channel
+	SpectrumAnalyzerService* service = GetEngine()->GetSpectrumAnalyzerService();
+	service->Release(mSpectrumAnalyzer);
+	mSpectrumAnalyzer = service->Acquire(mChannel, fftSettings, 2*mNumSamples);
 
 	
 	// pre-allocate surface data array
@@ -293,14 +296,14 @@ void SpectrogramSurfacePlugin::SurfaceDataProxy::Update()
 	if (mChannel == NULL)
 		return;
 
-	mSpectrumAnalyzer.Update();
-	Channel<Spectrum>* output = mSpectrumAnalyzer.GetOutput()->AsType<Spectrum>();
 	SpectrumAnalyzerSettings* settings = GetEngine()->GetSpectrumAnalyzerSettings();
 
 	// force reinit if FFT settings have changed
-	if (settings->GetNumFFTBins() != mNumBins || output->GetSampleRate() != mSampleRate || settings->GetNumWindowShiftSamples() != mNumShiftSamples || settings->GetWindowFunction()->GetType() != mWindowFunctionType)
+	if (mSpectrumAnalyzer == NULL || settings->GetNumFFTBins() != mNumBins || mSpectrumAnalyzer->GetSpectra()->GetSampleRate() != mSampleRate || settings->GetNumWindowShiftSamples() != mNumShiftSamples || settings->GetWindowFunction()->GetType() != mWindowFunctionType)
 		ReInit();
 
+	const Channel<Spectrum>* output = mSpectrumAnalyzer->GetSpectra();
+
 	// current number of rows (time axis)
 	uint32 numRows = (uint32)mData->size();
 
@@ -324,7 +327,7 @@ void SpectrogramSurfacePlugin::SurfaceDataProxy::Update()
 		for (int s = 0; s < numToAdd; s++)
 		{
 			const int spectrumIndex = output->GetMaxSampleIndex()+1 - (numToAdd - s);
-			Spectrum* spectrum = output->GetSampleRef(spectrumIndex);
+			const Spectrum* spectrum = &output->GetSample(spectrumIndex);
 		
 			// get first data row, remove it from list, change values, append to back of array
 			QSurfaceDataRow* row;
@@ -465,8 +468,8 @@ void SpectrogramSurfacePlugin::UpdateTimeAxis()
 
 	float currentTime = 0.0;
 	if (mDataProxy->GetChannel() != NULL)
-		if (mDataProxy->GetSpectrumAnalyzer()->GetOutput()->GetNumSamples() > 0)
-			currentTime = mDataProxy->GetSpectrumAnalyzer()->GetOutput()->AsType<Spectrum>()->GetLastSample().GetTime();
+		if (mDataProxy->GetSpectrumAnalyzer() != NULL && mDataProxy->GetSpectrumAnalyzer()->GetSpectra()->GetNumSamples() > 0)
+			currentTime = mDataProxy->GetSpectrumAnalyzer()->GetSpectra()->GetLastSample().GetTime();
 
 	mGraph->axisZ()->setRange(currentTime - mIntervalLength, currentTime);
 }
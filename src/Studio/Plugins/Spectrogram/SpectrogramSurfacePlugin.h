@@ -34,6 +34,7 @@
 
 #include <QtDataVisualization/q3dsurface.h>
 #include <DSP/FFTProcessor.h>
+#include <DSP/SpectrumAnalyzerService.h>
 
 using namespace QtDataVisualization;
 
@@ -77,13 +78,12 @@ class SpectrogramSurfacePlugin : public SpectrogramPlugin
 				mConvertToDezibel = false;
 				mLastTime = 0.0;
 				mLastIndex = 0;
-					
-				mSpectrumAnalyzer.Init();
-				mSpectrumAnalyzer.GetOutput()->SetBufferSize(0);
+				mSpectrumAnalyzer = NULL;
 			}
 
 			~SurfaceDataProxy() 
 			{
+				GetEngine()->GetSpectrumAnalyzerService()->Release(mSpectrumAnalyzer);
 			}
 
 			virtual void Update();								// copy new spectrum values to data proxy
@@ -98,13 +98,13 @@ class SpectrogramSurfacePlugin : public SpectrogramPlugin
 
 			void SetConvertToDezibel(bool enable = true)		{ if (mConvertToDezibel != enable) { mConvertToDezibel = enable; ReInit(); } }
 
-			FFTProcessor* GetSpectrumAnalyzer()					{ return &mSpectrumAnalyzer; }
+			SpectrumAnalyzerService::Analyzer* GetSpectrumAnalyzer()	{ return mSpectrumAnalyzer; }
 				
 		private:
 			QSurfaceDataArray*	mData;						// deallocated by QT
 
 			Channel<double>*	mChannel;					// the displayed channel
-			FFTProcessor		mSpectrumAnalyzer;			// one spectrum analyzer for each channel
+			SpectrumAnalyzerService::Analyzer* mSpectrumAnalyzer;	// shared spectrum analyzer of the channel (updated by the engine)
 			double				mSampleRate;				// sampling rate of the spectrum sampler
 				
 			double				mDuration;					// displayed intervalsize in seconds
@@ -36,6 +36,7 @@ Spectrogram2DPlugin::Spectrogram2DPlugin() : Plugin(GetStaticTypeUuid())
 
 	mChannelSelectionWidget	= NULL;
 	mSpectrumWidget			= NULL;
+	mNumAveragedSpectra		= 1;
 }
 
 
@@ -44,12 +45,8 @@ Spectrogram2DPlugin::~Spectrogram2DPlugin()
 {
 	LogDetailedInfo("Destructing raw spectrum plugin ...");
 	
-	// dealloc spectrum analyzers (simple solution)
-	const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
-	for (uint32 i=0; i<numAnalyzers; ++i)
-		delete mSpectrumAnalyzers[i];
-
-	mSpectrumAnalyzers.Clear();
+	// unsubscribe from the shared spectrum analyzers
+	ReleaseAnalyzers();
 	mAverageSpectra.Clear();
 }
 
@@ -189,11 +186,8 @@ void Spectrogram2DPlugin::RealtimeUpdate()
 {
 
 	udpateSelectedChannels();
-	// must always update spectrum analyzers
-	const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
-	for (uint32 i = 0; i < numAnalyzers; ++i)
-		mSpectrumAnalyzers[i]->Update();
 
+	// note: the spectrum analyzers are updated by the engine
 	if (mSpectrumWidget != NULL && mSpectrumWidget->isVisible() == true)
 		mSpectrumWidget->update();
 }
@@ -204,34 +198,19 @@ void Spectrogram2DPlugin::ReInit()
 	// clear channel list
 	mChannels.Clear();
 
-	// dealloc spectrum analyzers
-	const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
-	for (uint32 i = 0; i < numAnalyzers; ++i)
-		delete mSpectrumAnalyzers[i];
-	mSpectrumAnalyzers.Clear();
+	// unsubscribe from the spectrum analyzers
+	ReleaseAnalyzers();
 
 	mAverageSpectra.Clear();
 
 	Array<Channel<double>*> channels = mChannelSelectionWidget->GetSelectedChannels();
-	const FFTProcessor::FFTSettings& settings = GetEngine()->GetSpectrumAnalyzerSettings()->GetFFTSettings();
 
 	// put each channel in a separate chartform
 	const int numSelected = channels.Size();
 	for (int i = 0; i < numSelected; i++)
 	{
-		// get channel and create the spectrum analyzer, add it to waveform
-		Channel<double>* channel = channels[i];
-		FFTProcessor* analyzer = new FFTProcessor();
-
-		// connect and configure FFT
-		analyzer->SetInput(channel);
-		analyzer->Setup(settings);
-		analyzer->SetUseZeroPadding(true);
-		analyzer->ReInit();
-
-		// store everythin in the lists
-		mChannels.Add(channel);
-		mSpectrumAnalyzers.Add(analyzer);
+		// store everythin in the lists (the spectrum analyzers are acquired in SetAverageInterval())
+		mChannels.Add(channels[i]);
 		mAverageSpectra.AddEmpty();
 	}
 
@@ -260,7 +239,7 @@ void Spectrogram2DPlugin::ReInit()
 	// remember window function
 	mWindowFunctionType = GetEngine()->GetSpectrumAnalyzerSettings()->GetWindowFunction()->GetType();
 
-	// set the current channel spectrum analyzer statistic size
+	// acquire the spectrum analyzers with the current statistic size
 	SetAverageInterval( GetAverageInterval() );
 
 	SetMultiView( GetMultiView() );
@@ -285,14 +264,19 @@ void Spectrogram2DPlugin::UpdateInterface()
 	Array<Spectrum*> mViewedSpectrums;
 	mViewedSpectrums.Resize(numAnalyzers);
 
-	// update spectrum analyzers and calculate averages
+	// calculate averages over the last spectra (the shared analyzers may keep more spectra than we need)
 	for (uint32 i=0; i<numAnalyzers; ++i)
 	{
-		mSpectrumAnalyzers[i]->Update();
+		const Channel<Spectrum>* spectra = mSpectrumAnalyzers[i]->GetSpectra();
 
-		// calculate average and (uses output channel spectrum directly)
-		Channel<Spectrum>* spectra = mSpectrumAnalyzers[i]->GetOutput()->AsType<Spectrum>();
-		spectra->CalculateAverage(&mAverageSpectra[i]);
+		// the channels fill up independently, so the range is limited by the spectra this channel actually holds
+		if (spectra->GetNumSamples() > 0)
+		{
+			const uint64 maxSampleIndex = spectra->GetMaxSampleIndex();
+			const uint64 numAveragedSpectra = Min<uint64>(mNumAveragedSpectra, spectra->GetNumSamples());
+			const uint64 minSampleIndex = Max<uint64>(maxSampleIndex + 1 - numAveragedSpectra, spectra->GetMinSampleIndex());
+			spectra->CalculateAverage(&mAverageSpectra[i], minSampleIndex, maxSampleIndex);
+		}
 
 		mSpectrumWidget->UpdateSpectrum(i, &mAverageSpectra[i]);
 		mViewedSpectrums[i] = &mAverageSpectra[i];
@@ -308,27 +292,39 @@ void Spectrogram2DPlugin::OnChannelSelectionChanged()
 
 void Spectrogram2DPlugin::SetAverageInterval(double length)
 {
+	// the analyzers have to keep at least as many spectra as we want to average: subscribe again
+	ReleaseAnalyzers();
+
+	FFTProcessor::FFTSettings settings = GetEngine()->GetSpectrumAnalyzerSettings()->GetFFTSettings();
+	settings.mUseZeroPadding = true;
+
+	SpectrumAnalyzerService* service = GetEngine()->GetSpectrumAnalyzerService();
+
+	mNumAveragedSpectra = 1;
 	const uint32 numChannels = mChannels.Size();
 	for (uint32 i = 0; i < numChannels; i++)
 	{
-		FFTProcessor* analyzer = mSpectrumAnalyzers[i];
-		const uint32 sampleRate = analyzer->GetOutput()->GetSampleRate();
-		
-		uint32 numSamples = length * sampleRate;
-		if (length == 0)
-			numSamples = 1;
-
-		// set buffer size of fft processor output channel to the number of samples we want to average
-		ChannelBase* output = mSpectrumAnalyzers[i]->GetOutput();
-		
-		// resize the output channel which holds the samples for averaging
-		output->Reset();
-		output->Clear(true);					// deallocate, so SetBufferSize() will shrink the array
-		output->SetBufferSize(numSamples);		// resize the buffer to the interval
-		output->Reset();
+		const double sampleRate = mChannels[i]->GetSampleRate() / (double)Core::Max<uint32>(settings.mEpochShift, 1);
+		const uint32 numSpectra = Core::Max<uint32>(length * sampleRate, 1);
+		mNumAveragedSpectra = Core::Max(mNumAveragedSpectra, numSpectra);
+
+		mSpectrumAnalyzers.Add( service->Acquire(mChannels[i], settings, numSpectra) );
 	}
 }
 
+
+// unsubscribe from the shared spectrum analyzers
+void Spectrogram2DPlugin::ReleaseAnalyzers()
+{
+	SpectrumAnalyzerService* service = GetEngine()->GetSpectrumAnalyzerService();
+
+	const uint32 numAnalyzers = mSpectrumAnalyzers.Size();
+	for (uint32 i = 0; i < numAnalyzers; ++i)
+		service->Release(mSpectrumAnalyzers[i]);
+
+	mSpectrumAnalyzers.Clear();
+}
+
 void Spectrogram2DPlugin::udpateSelectedChannels()
 {
 	if (auto classifier = GetEngine()->GetActiveClassifier(); classifier)
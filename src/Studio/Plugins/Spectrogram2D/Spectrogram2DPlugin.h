@@ -31,6 +31,7 @@
 #include <AttributeWidgets/Property.h>
 #include "../../Widgets/ChannelMultiSelectionWidget.h"
 #include <DSP/FFTProcessor.h>
+#include <DSP/SpectrumAnalyzerService.h>
 
 
 // universal waveform plugin
@@ -75,11 +76,13 @@ class Spectrogram2DPlugin : public Plugin
 	private:
 		void enableHorizontalViewCheckbox(bool enable);
 		void udpateSelectedChannels();
+		void ReleaseAnalyzers();
 	
 	private:
 		// selected channels
 		Core::Array<Channel<double>*>		mChannels;					// list of the selected channels				// TODO get rid of these
-		Core::Array<FFTProcessor*>			mSpectrumAnalyzers;			// one FFT processor for each channel
+		Core::Array<SpectrumAnalyzerService::Analyzer*> mSpectrumAnalyzers;	// one shared spectrum analyzer for each channel
+		uint32								mNumAveragedSpectra;		// number of spectra in the average interval
 		Core::Array<Spectrum>				mAverageSpectra;			// holds the current average (the display values)
 
 		ChannelMultiSelectionWidget*		mChannelSelectionWidget;
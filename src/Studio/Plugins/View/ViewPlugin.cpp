@@ -95,6 +95,7 @@ bool ViewPlugin::Init()
 
 	vWidget->show();
 	
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	LogDetailedInfo("Signal View plugin successfully initialized");
@@ -94,6 +94,7 @@ bool ViewSpectrumPlugin::Init()
 
 	vWidget->show();
 	
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 
 	LogDetailedInfo("Spectrum View plugin successfully initialized");
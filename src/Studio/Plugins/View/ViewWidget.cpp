@@ -37,6 +37,9 @@ ViewWidget::ViewWidget(ViewPlugin* plugin, QWidget* parent) : OpenGLWidget(paren
 	SetCallback( mRenderCallback );
 
 	mLeftTextWidth		= 0.0;
+	mHasClassifier		= false;
+	mMaxTime			= 0.0;
+	mTimeRange			= 0.0;
 	mPlugin				= plugin;
 	mEmptyText			= "No signals";
 }
@@ -55,27 +58,83 @@ Classifier* ViewWidget::GetClassifier() const
 }
 
 
+// collect the channels and properties of the multichannels (the engine is locked while we process events)
+void ViewWidget::UpdateSnapshots()
+{
+	mViews.Clear(false);
+	mChannelColors.Clear(false);
+	mChannelLabels.Clear(false);
+
+	mSnapshots.Begin();
+
+	// the displayed time range (fixed length is kept in mins)
+	mMaxTime	= mPlugin->GetFixedLength() * 60;
+	mTimeRange	= mPlugin->GetTimeRange();
+	if (mMaxTime < 0.)
+		mMaxTime = GetEngine()->GetElapsedTime().InSeconds();
+	else
+		mTimeRange = mMaxTime;
+
+	mHasClassifier = (GetClassifier() != NULL);
+	if (mHasClassifier == true)
+	{
+		const uint32 numMultiChannels = mPlugin->GetNumMultiChannels();
+		for (uint32 i=0; i<numMultiChannels; ++i)
+		{
+			const MultiChannel& channels = mPlugin->GetMultiChannel(i);
+
+			View view;
+			view.mRangeMin		= channels.GetMinValue();
+			view.mRangeMax		= channels.GetMaxValue();
+			view.mIsHighlighted	= channels.IsHighlighted();
+			view.mFirstChannel	= mSnapshots.Size();
+			view.mNumChannels	= channels.GetNumChannels();
+
+			for (uint32 j=0; j<view.mNumChannels; ++j)
+			{
+				Channel<double>* channel = channels.GetChannel(j)->AsType<double>();
+				mSnapshots.Add(channel, mTimeRange);
+				mChannelColors.Add( mPlugin->GetChannelColor(i, j) );
+
+				if (channel->GetSourceNameString().IsEmpty() == false)
+					mTempString.Format("%s - %s", channel->GetSourceName(), channel->GetName());
+				else
+					mTempString.Format("%s", channel->GetName());
+				mChannelLabels.Add(mTempString);
+			}
+
+			mViews.Add(view);
+		}
+	}
+
+	mSnapshots.End();
+}
+
+
 // render frame
 void ViewWidget::paintGL()
 {
-	uint32 numMultiChannels = 0;
-	Classifier* classifier = GetClassifier();
-	if (classifier != NULL)
+	// copy the displayed channels while the engine is locked, then render without holding the lock so the engine thread can continue
+	// (without the engine thread the engine runs on this thread and there is no lock to release)
+	UpdateSnapshots();
+	MainWindowBase* mainWindow = GetQtBaseManager()->GetMainWindow();
+	const bool releaseLock = mainWindow->IsEngineThreadEnabled();
+	if (releaseLock == true)
+		mainWindow->ReleaseEngineLock();
+
+	const uint32 numMultiChannels = mViews.Size();
+	if (mHasClassifier == true)
 	{
 		double maxTextWidth = 0.0;
 
-		// get the channels to render
-		numMultiChannels = mPlugin->GetNumMultiChannels();
 		for (uint32 i = 0; i<numMultiChannels; ++i)
 		{
-			const MultiChannel& channels = mPlugin->GetMultiChannel(i);
-
 			// calc range min text width
-			mTempString.Format( "%.2f", channels.GetMinValue() );
+			mTempString.Format( "%.2f", mViews[i].mRangeMin );
 			maxTextWidth = Max<double>( maxTextWidth, mRenderCallback->CalcTextWidth(mTempString.AsChar()) );
 
 			// calc range max text width
-			mTempString.Format("%.2f", channels.GetMaxValue() );
+			mTempString.Format("%.2f", mViews[i].mRangeMax );
 			maxTextWidth = Max<double>( maxTextWidth, mRenderCallback->CalcTextWidth(mTempString.AsChar()) );
 		}
 
@@ -102,34 +161,33 @@ void ViewWidget::paintGL()
 	painter.setRenderHint(QPainter::HighQualityAntialiasing);
 
 	// pre rendering
-	if (PreRendering() == false)
-		return;
+	if (PreRendering() == true)
+	{
+		RenderSplitViews(numMultiChannels);
 
-	RenderSplitViews(numMultiChannels);
+		// post rendering
+		PostRendering();
+	}
 
-	// post rendering
-	PostRendering();
+	if (releaseLock == true)
+		mainWindow->AcquireEngineLock();
 }
 
 
 void ViewWidget::RenderCallback::Render(uint32 index, bool isHighlighted, double x, double y, double width, double height)
 {
-	//Classifier* classifier = mViewWidget->GetClassifier();
+	// rendered from the snapshots, the engine is not locked here
 	ViewPlugin* plugin = mViewWidget->GetPlugin();
 
-	double maxTime = plugin->GetFixedLength() * 60; // fixed length is kept in mins
-	double timeRange = plugin->GetTimeRange();
-	if (maxTime < 0.)
-		maxTime = GetEngine()->GetElapsedTime().InSeconds();
-	else
-		timeRange = maxTime;
+	const double maxTime = mViewWidget->mMaxTime;
+	const double timeRange = mViewWidget->mTimeRange;
 	
-	// get channel and its properties
-	const MultiChannel& channels = plugin->GetMultiChannel(index);
+	// get the multichannel and its properties
+	const View& view = mViewWidget->mViews[index];
 	
 	// channel signal range
-	double rangeMin = channels.GetMinValue();
-	double rangeMax = channels.GetMaxValue();
+	double rangeMin = view.mRangeMin;
+	double rangeMax = view.mRangeMax;
 
 	//CORE_ASSERT(rangeMin < rangeMax);
 	if (rangeMin >= rangeMax)
@@ -141,7 +199,7 @@ void ViewWidget::RenderCallback::Render(uint32 index, bool isHighlighted, double
 	}
 
 	// channel highlight flag overrides mouse highlight
-	isHighlighted |= channels.IsHighlighted();
+	isHighlighted |= view.mIsHighlighted;
 
 	// base class render
 	OpenGLWidgetCallback::Render( index, isHighlighted, x, y, width, height );
@@ -192,24 +250,20 @@ void ViewWidget::RenderCallback::Render(uint32 index, bool isHighlighted, double
 	// render the multichannel signals
 	const OpenGLWidget2DHelpers::EChartRenderStyle style = (OpenGLWidget2DHelpers::EChartRenderStyle)plugin->GetSampleStyle();
 
-	const uint32 numChannels = channels.GetNumChannels();
+	const uint32 numChannels = view.mNumChannels;
 
 	float textY = 0.f;
 	const float textMargin = 2.0f;
 
 	for (uint32 i=0; i<numChannels; ++i )
 	{
-		Channel<double>* channel = channels.GetChannel(i)->AsType<double>();
-		const Color& color = mViewWidget->mPlugin->GetChannelColor(index, i);
+		const uint32 snapshotIndex = view.mFirstChannel + i;
+		Channel<double>* channel = mViewWidget->mSnapshots.Get(snapshotIndex)->Acquire();
+		const Color& color = mViewWidget->mChannelColors[snapshotIndex];
 		OpenGLWidget2DHelpers::RenderChart( this, channel, color, style, timeRange, maxTime, rangeMin, rangeMax, areaStartX, width, height, height,  drawLatencyMarker);
 
 		// Render channels text
-		if (channel->GetSourceNameString().IsEmpty() == false)
-			mTempString.Format("%s - %s", channel->GetSourceName(), channel->GetName());
-		else
-			mTempString.Format("%s", channel->GetName());
-
-		RenderText( mTempString.AsChar(), GetOpenGLWidget()->GetDefaultFontSize(), color, areaStartX+textMargin, textY, OpenGLWidget::ALIGN_TOP | OpenGLWidget::ALIGN_LEFT );
+		RenderText( mViewWidget->mChannelLabels[snapshotIndex].AsChar(), GetOpenGLWidget()->GetDefaultFontSize(), color, areaStartX+textMargin, textY, OpenGLWidget::ALIGN_TOP | OpenGLWidget::ALIGN_LEFT );
 		textY = textY + GetTextHeight() + textMargin;
 	}
 
@@ -255,8 +309,8 @@ void ViewWidget::RenderCallback::RenderTimeline(double x, double y, double width
 	AddRect( 0, 0, width, height, FromQtColor(QColor(40,40,40)) );
 	RenderRects();
 
-	Classifier* classifier = mViewWidget->GetClassifier();
-	if (classifier == NULL)
+	// the engine is not locked here
+	if (mViewWidget->mHasClassifier == false)
 		return;
 	
 	// automatically calculated, do not change these
@@ -264,17 +318,16 @@ void ViewWidget::RenderCallback::RenderTimeline(double x, double y, double width
 	const double areaWidth		= width - areaStartX;
 		
 	QColor color = ColorPalette::Shared::GetTextQColor();
-	double timeRange = mViewWidget->GetPlugin()->GetTimeRange();
-	ViewPlugin* plugin = mViewWidget->GetPlugin();
+	double timeRange = mViewWidget->mTimeRange;
+	double maxTime = mViewWidget->mMaxTime;
 
-	double maxTime = plugin->GetFixedLength();
+	// fixed length is displayed in mins
 	bool scaleInMins = false;
-	if (maxTime < 0.)
-		maxTime = GetEngine()->GetElapsedTime().InSeconds();
-	else
+	if (mViewWidget->GetPlugin()->GetFixedLength() >= 0.)
 	{
 		scaleInMins = true;
-		timeRange = maxTime;
+		timeRange /= 60;
+		maxTime /= 60;
 	}
 	
 	OpenGLWidget2DHelpers::RenderTimeline( this, FromQtColor(color), timeRange, maxTime, areaStartX, y, areaWidth, height, mTempString, scaleInMins);
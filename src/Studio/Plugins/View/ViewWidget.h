@@ -27,6 +27,7 @@
 // include required headers
 #include "../../Config.h"
 #include <DSP/Channel.h>
+#include <DSP/ChannelSnapshot.h>
 #include <Graph/Classifier.h>
 #include "../../Rendering/OpenGLWidget.h"
 
@@ -61,6 +62,27 @@ class ViewWidget : public OpenGLWidget
 
 		friend class RenderCallback;
 
+		// copy what gets rendered while the engine is locked, so rendering doesn't have to lock the engine (see ChannelSnapshot)
+		void UpdateSnapshots();
+
+		// one per multichannel
+		struct View
+		{
+			double		mRangeMin;
+			double		mRangeMax;
+			bool		mIsHighlighted;
+			uint32		mFirstChannel;		// index of the first snapshot of the multichannel
+			uint32		mNumChannels;
+		};
+
+		Core::Array<View>			mViews;
+		ChannelSnapshotSet			mSnapshots;
+		Core::Array<Core::Color>	mChannelColors;		// one per snapshot
+		Core::Array<Core::String>	mChannelLabels;		// one per snapshot
+		bool						mHasClassifier;
+		double						mMaxTime;			// time at the right border
+		double						mTimeRange;
+
 		ViewPlugin*			mPlugin;
 		RenderCallback*		mRenderCallback;
 		double				mLeftTextWidth;
@@ -178,6 +178,9 @@ void OpenGLWidget::initializeGL()
 	GetOpenGLManager()->UnregisterOpenGLWidget(this);
 	GetOpenGLManager()->RegisterOpenGLWidget(this, this);
 
+	// let the engine thread run while the window is composed
+	GetQtBaseManager()->GetMainWindow()->ReleaseEngineLockWhileComposing(this);
+
 	mAsyncNeedsReInit = true;
 
 	// schedule async reinitialization for all OpenGL widgets
@@ -37,6 +37,10 @@ OpenGLWidgetCallback::OpenGLWidgetCallback(OpenGLWidget* parent)
 	mLines.Reserve(1024*4);
 	mRects.Reserve(1024*4);
 
+	mLineBuffer		= QOpenGLBuffer(QOpenGLBuffer::VertexBuffer);
+	mLineBufferSize	= 0;
+	mHasLineBufferFailed = false;
+
 	mSphereMesh = NULL;
 	InitSphereMesh();
 
@@ -52,6 +56,14 @@ OpenGLWidgetCallback::~OpenGLWidgetCallback()
 	delete mFontMetrics;
 	delete mFont;
 	delete mSphereMesh;
+
+	// the vertex buffer has to be destroyed in the context it was created in
+	if (mLineBuffer.isCreated() == true)
+	{
+		mParent->makeCurrent();
+		mLineBuffer.destroy();
+		mParent->doneCurrent();
+	}
 }
 
 
@@ -101,35 +113,69 @@ void OpenGLWidgetCallback::RenderLines(double lineWidth)
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	glEnable( GL_BLEND );
 
-	// new version
-#ifdef NEUROMORE_PLATFORM_WINDOWS
+	// create the vertex buffer on first use
+	if (mLineBuffer.isCreated() == false && mHasLineBufferFailed == false)
+	{
+		if (mLineBuffer.create() == true)
+			mLineBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
+		else
+		{
+			LogError("OpenGL: Cannot create line vertex buffer, drawing lines from client-side vertex arrays.");
+			mHasLineBufferFailed = true;
+		}
+	}
+
+	const bool useLineBuffer = mLineBuffer.isCreated();
+
+	// convert the lines into vertices
+	const uint32 numVertices = numLines * 2;
+	mLineVertices.Resize(numVertices);
+	for (uint32 i=0; i<numLines; ++i)
+	{
+		const Line2D& line = mLines[i];
+
+		LineVertex& vertex1 = mLineVertices[i*2];
+		vertex1.x		= line.x1;
+		vertex1.y		= line.y1;
+		vertex1.color	= line.color1;
+
+		LineVertex& vertex2 = mLineVertices[i*2+1];
+		vertex2.x		= line.x2;
+		vertex2.y		= line.y2;
+		vertex2.color	= line.color2;
+	}
+
+	// vertex attributes are offsets into the bound buffer, or pointers to the vertices without buffer
+	uintptr_t vertexData = 0;
+	if (useLineBuffer == true)
+	{
+		// upload the vertices, only reallocate the buffer in case it is too small
+		const uint32 numBytes = numVertices * sizeof(LineVertex);
+		mLineBuffer.bind();
+		if (numBytes > mLineBufferSize)
+		{
+			mLineBufferSize = Max<uint32>(numBytes, mLineBufferSize * 2);
+			mLineBuffer.allocate( mLineBufferSize );
+		}
+		mLineBuffer.write( 0, mLineVertices.GetPtr(), numBytes );
+	}
+	else
+		vertexData = (uintptr_t)mLineVertices.GetPtr();
+
 	glEnableClientState(GL_VERTEX_ARRAY);
 	glEnableClientState(GL_COLOR_ARRAY);
 
-	const uint32 stride = sizeof(double)*2 + sizeof(Color);
-	glVertexPointer( 2, GL_DOUBLE, stride, mLines.GetPtr() );
-	glColorPointer( 4, GL_FLOAT, stride, &(mLines[0].color1) );
+	const uint32 stride = sizeof(LineVertex);
+	glVertexPointer( 2, GL_FLOAT, stride, (const void*)vertexData );
+	glColorPointer( 4, GL_FLOAT, stride, (const void*)(vertexData + sizeof(float)*2) );
 
-	glDrawArrays( GL_LINES, 0, numLines*2 );
+	glDrawArrays( GL_LINES, 0, numVertices );
 
 	glDisableClientState(GL_VERTEX_ARRAY);
 	glDisableClientState(GL_COLOR_ARRAY);
-#else
-	// OpenGL 1 version
-	glBegin(GL_LINES);
-		for (uint32 i=0; i<numLines; ++i)
-		{
-            const Color& color1 = mLines[i].color1;
-            const Color& color2 = mLines[i].color2;
-            
-			glColor4f(color1.r, color1.g, color1.b, color1.a);
-			glVertex2d(mLines[i].x1, mLines[i].y1);
-
-			glColor4f(color2.r, color2.g, color2.b, color2.a);
-			glVertex2d(mLines[i].x2, mLines[i].y2);
-		}
-	glEnd();
-#endif
+
+	if (useLineBuffer == true)
+		mLineBuffer.release();
 
 	glDisable( GL_BLEND );
 
@@ -31,6 +31,7 @@
 #include <DSP/Channel.h>
 #include <QOpenGLWidget>
 #include <QOpenGLFunctions>
+#include <QOpenGLBuffer>
 #include <QMatrix4x4>
 
 
@@ -140,6 +141,19 @@ class OpenGLWidgetCallback
 		Core::Array<Line2D>			mLines;
 		Core::Array<Rect>			mRects;
 
+		// line vertex buffer (persistent, only grows)
+		struct LineVertex
+		{
+			float				x;
+			float				y;
+			Core::Color		color;
+		};
+
+		Core::Array<LineVertex>		mLineVertices;
+		QOpenGLBuffer				mLineBuffer;
+		uint32						mLineBufferSize;	// allocated size in bytes
+		bool						mHasLineBufferFailed;	// the buffer could not be created, the lines are drawn from client-side arrays
+
 		// sphere
 		void InitSphereMesh();
 		SimpleMesh*					mSphereMesh;
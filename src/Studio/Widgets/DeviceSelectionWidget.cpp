@@ -32,6 +32,7 @@ using namespace Core;
 // constructor
 DeviceSelectionWidget::DeviceSelectionWidget(QWidget* parent) : QComboBox(parent)
 {
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 	connect(this, SIGNAL(activated(int)), this, SLOT(OnCurrentIndexChanged(int)));
 
@@ -33,6 +33,7 @@ using namespace Core;
 SensorCheckboxWidget::SensorCheckboxWidget(QWidget* parent) : HMultiCheckboxWidget(parent)
 {
 	mBciDevice = NULL;
+	SetIsMainThreadOnly();
 	CORE_EVENTMANAGER.AddEventHandler(this);
 }
 